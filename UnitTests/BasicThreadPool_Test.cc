@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include "BasicThreadPool.h"
+
+
+class Foundations_BasicThreadPool_Happy : public ::testing::Test
+{
+public:
+
+    const uint64_t inTestDelayInMicroseconds{ 20000u };
+};
+
+class Foundations_BasicThreadPool_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_BasicThreadPool_Happy, addTask)
+{
+    // Case with first come first served policy
+    {
+        std::atomic<uint32_t> numberOfExecutedTasks{ 0u };
+        BasicThreadPool<FirstComeFirstServedPolicy, std::function<void()>, true> threadPool{ 4u };
+
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            EXPECT_EQ(threadPool.addTask([&numberOfExecutedTasks] { ++numberOfExecutedTasks; }), Result::OK);
+        }
+
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(-1), Result::OK);
+        EXPECT_EQ(numberOfExecutedTasks.load(), 100u);
+        EXPECT_EQ(threadPool.getTasksSize(), 0u);
+        EXPECT_EQ(threadPool.getWorkersSize(), 4u);
+
+        const auto statistic = threadPool.getStatistic();
+        EXPECT_EQ(statistic.totalNumberOfAddedTasks, 100u);
+        EXPECT_EQ(statistic.totalNumberOfExecutedTasks, 100u);
+        EXPECT_EQ(statistic.totalNumberOfNotExecutedTasks, 0u);
+    }
+
+    // Case with priority policy, tasks are added while the only worker is busy
+    {
+        std::mutex orderMutex;
+        std::vector<Priority> order;
+        BasicThreadPool<PriorityPolicy, BasicPriorityTask<>> threadPool{ 1u };
+
+        threadPool.addTask(BasicPriorityTask<>{ Priority::NORMAL, [this] { OSAL::Thread::delay(inTestDelayInMicroseconds); } });
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 4u);
+
+        for (const Priority priority : { Priority::LOW, Priority::NORMAL, Priority::HIGH })
+        {
+            threadPool.addTask(BasicPriorityTask<>{ priority, [&orderMutex, &order, priority]
+                                                              {
+                                                                  std::lock_guard<std::mutex> lock{ orderMutex };
+                                                                  order.push_back(priority);
+                                                              } });
+        }
+
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(-1), Result::OK);
+        EXPECT_EQ(order, (std::vector<Priority>{ Priority::HIGH, Priority::NORMAL, Priority::LOW }));
+
+        // Statistic is compiled out
+        EXPECT_EQ(threadPool.getStatistic().totalNumberOfAddedTasks, 0u);
+    }
+}
+
+
+TEST_F(Foundations_BasicThreadPool_Happy, addTasks)
+{
+    // Case with shortest job first policy, tasks are added at once before any is taken
+    {
+        std::vector<BurstTime> order;
+        BasicThreadPool<ShortestJobFirstPolicy, BasicBurstTimeTask<>> threadPool{ 1u };
+
+        threadPool.addTask(BasicBurstTimeTask<>{ BurstTime::SHORT, [this] { OSAL::Thread::delay(inTestDelayInMicroseconds); } });
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 4u);
+
+        std::vector<BasicBurstTimeTask<>> tasks;
+        for (const BurstTime burstTime : { BurstTime::LONG, BurstTime::UNDEFINED, BurstTime::SHORT })
+        {
+            tasks.emplace_back(burstTime, [&order, burstTime] { order.push_back(burstTime); });
+        }
+
+        EXPECT_EQ(threadPool.addTasks(std::move(tasks)), Result::OK);
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(-1), Result::OK);
+
+        // Undefined burst time is scheduled as medium one
+        EXPECT_EQ(order, (std::vector<BurstTime>{ BurstTime::SHORT, BurstTime::UNDEFINED, BurstTime::LONG }));
+    }
+}
+
+
+TEST_F(Foundations_BasicThreadPool_Unhappy, addTask)
+{
+    // Case with thread pool without workers
+    {
+        BasicThreadPool<FirstComeFirstServedPolicy> threadPool{ 0u };
+
+        EXPECT_EQ(threadPool.addTask([] {}), Result::ERROR);
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(0), Result::OK);
+    }
+
+    // Case with task throwing exception
+    {
+        BasicThreadPool<FirstComeFirstServedPolicy, std::function<void()>, true> threadPool{ 1u };
+
+        threadPool.addTask([] { throw std::runtime_error{ "test" }; });
+        threadPool.addTask([] {});
+
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(-1), Result::OK);
+        EXPECT_EQ(threadPool.getStatistic().totalNumberOfExecutedTasks, 1u);
+        EXPECT_EQ(threadPool.getStatistic().totalNumberOfNotExecutedTasks, 1u);
+    }
+}
+
+
+TEST_F(Foundations_BasicThreadPool_Unhappy, waitAllTasksExecutionFinished)
+{
+    // Case with timeout expired before the task is finished
+    {
+        BasicThreadPool<FirstComeFirstServedPolicy> threadPool{ 1u };
+
+        threadPool.addTask([] { OSAL::Thread::delay(100000u); });
+
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(1000), Result::TIMEOUT);
+        EXPECT_EQ(threadPool.waitAllTasksExecutionFinished(-1), Result::OK);
+    }
+}
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "OSAL.h"
+
+
+class Foundations_OSAL_CpuTopology_Happy : public ::testing::Test
+{
+public:
+
+    // 2 packages x 2 cores x 2 hardware threads, siblings are numbered like on Linux (cpu, cpu + 4)
+    OSAL::CpuTopology getTwoPackagesTopology() const
+    {
+        std::vector<OSAL::CpuTopology::Cpu> cpus;
+
+        for (uint32_t id = 0u; id < 8u; ++id)
+        {
+            OSAL::CpuTopology::Cpu cpu{};
+            cpu.id = id;
+            cpu.packageId = (id % 4u) / 2u;
+            cpu.coreId = id % 2u;
+            cpu.l2CacheId = id % 4u;
+            cpu.l3CacheId = cpu.packageId * 2u;
+            cpu.numaNodeId = cpu.packageId;
+
+            cpus.push_back(cpu);
+        }
+
+        return OSAL::CpuTopology{ cpus };
+    }
+};
+
+class Foundations_OSAL_CpuTopology_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Happy, parseCpuList)
+{
+    // Case with ranges and single CPUs
+    {
+        const std::vector<uint32_t> cpus{ OSAL::CpuTopology::parseCpuList("0-2,5,7-8\n") };
+
+        EXPECT_EQ(cpus, (std::vector<uint32_t>{ 0u, 1u, 2u, 5u, 7u, 8u }));
+    }
+}
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Unhappy, parseCpuList)
+{
+    // Case with empty list
+    {
+        EXPECT_TRUE(OSAL::CpuTopology::parseCpuList("").empty());
+    }
+}
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Happy, getOrder)
+{
+    const OSAL::CpuTopology topology{ getTwoPackagesTopology() };
+
+    // Case with compact order
+    {
+        EXPECT_EQ(topology.getCompactOrder(), (std::vector<uint32_t>{ 0u, 4u, 1u, 5u, 2u, 6u, 3u, 7u }));
+    }
+
+    // Case with scatter order
+    {
+        EXPECT_EQ(topology.getScatterOrder(), (std::vector<uint32_t>{ 0u, 2u, 1u, 3u, 4u, 6u, 5u, 7u }));
+    }
+
+    // Case with one CPU per physical core
+    {
+        EXPECT_EQ(topology.getPhysicalCoresOrder(), (std::vector<uint32_t>{ 0u, 1u, 2u, 3u }));
+    }
+}
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Happy, areSharingCache)
+{
+    const OSAL::CpuTopology topology{ getTwoPackagesTopology() };
+
+    // Case with hardware thread siblings and CPUs of one package
+    {
+        EXPECT_TRUE(topology.areSharingCache(0, 4));
+        EXPECT_TRUE(topology.areSharingCache(0, 1));
+    }
+
+    // Case with CPUs of different packages
+    {
+        EXPECT_FALSE(topology.areSharingCache(0, 2));
+    }
+}
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Happy, getNumaNode)
+{
+    const OSAL::CpuTopology topology{ getTwoPackagesTopology() };
+
+    // Case with node per package
+    {
+        EXPECT_EQ(topology.getNumaNodes(), (std::vector<uint32_t>{ 0u, 1u }));
+        EXPECT_EQ(topology.getNumaNode(6), 1);
+    }
+
+    // Case with unknown CPU
+    {
+        EXPECT_EQ(topology.getNumaNode(100), OSAL::CpuTopology::UNKNOWN_NUMA_NODE);
+    }
+}
+
+
+TEST_F(Foundations_OSAL_CpuTopology_Unhappy, read)
+{
+    // Case with missing sysfs, topology falls back to hardware concurrency
+    {
+        const OSAL::CpuTopology topology{ OSAL::CpuTopology::read("/nonexistent") };
+
+        EXPECT_GT(topology.getSize(), 0u);
+        EXPECT_FALSE(topology.areSharingCache(0, OSAL::Thread::NO_AFFINITY));
+    }
+}
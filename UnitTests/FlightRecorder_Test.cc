@@ -0,0 +1,125 @@
+#include "gtest/gtest.h"
+#include <sstream>
+#include "FlightRecorder.h"
+
+
+class Foundations_ThreadPoolFlightRecorder_Happy : public ::testing::Test
+{
+};
+
+class Foundations_ThreadPoolFlightRecorder_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_ThreadPoolFlightRecorder_Happy, record)
+{
+    // Case with events of workers, manager and producers
+    {
+        FlightRecorder flightRecorder{ 2u, 8u };
+
+        EXPECT_EQ(flightRecorder.getNumberOfTracks(), 4u);
+        EXPECT_EQ(flightRecorder.getManagerTrack(), 2u);
+        EXPECT_EQ(flightRecorder.getProducersTrack(), 3u);
+
+        flightRecorder.record(flightRecorder.getProducersTrack(), FlightRecorder::EventType::SUBMIT, 7u, 0u, 100u);
+        flightRecorder.record(flightRecorder.getManagerTrack(), FlightRecorder::EventType::DISPATCH, 7u, 1u, 110u);
+        flightRecorder.record(1u, FlightRecorder::EventType::START, 7u, 0u, 120u);
+        flightRecorder.record(1u, FlightRecorder::EventType::END, 7u, 0u, 150u);
+
+        const std::vector<FlightRecorder::Event> events{ flightRecorder.getEvents() };
+
+        ASSERT_EQ(events.size(), 4u);
+
+        EXPECT_EQ(events[0].track, 1u);
+        EXPECT_EQ(events[0].type, FlightRecorder::EventType::START);
+        EXPECT_EQ(events[0].time, 120u);
+        EXPECT_EQ(events[1].type, FlightRecorder::EventType::END);
+        EXPECT_EQ(events[2].type, FlightRecorder::EventType::DISPATCH);
+        EXPECT_EQ(events[2].argument, 1u);
+        EXPECT_EQ(events[3].type, FlightRecorder::EventType::SUBMIT);
+        EXPECT_EQ(events[3].taskId, 7u);
+    }
+
+    // Case with overwritten oldest events
+    {
+        FlightRecorder flightRecorder{ 1u, 3u };
+
+        EXPECT_EQ(flightRecorder.getCapacityPerTrack(), 4u);
+
+        for (uint64_t taskId = 1u; taskId <= 10u; ++taskId)
+        {
+            flightRecorder.record(0u, FlightRecorder::EventType::START, taskId, 0u, taskId);
+        }
+
+        const std::vector<FlightRecorder::Event> events{ flightRecorder.getEvents() };
+
+        ASSERT_EQ(events.size(), 4u);
+        EXPECT_EQ(events.front().taskId, 7u);
+        EXPECT_EQ(events.back().taskId, 10u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFlightRecorder_Unhappy, record)
+{
+    // Case with disabled recorder
+    {
+        FlightRecorder flightRecorder{ 1u, 0u };
+        flightRecorder.record(0u, FlightRecorder::EventType::START, 1u);
+
+        EXPECT_TRUE(flightRecorder.getEvents().empty());
+    }
+
+    // Case with not existing track
+    {
+        FlightRecorder flightRecorder{ 1u, 4u };
+        flightRecorder.record(flightRecorder.getNumberOfTracks(), FlightRecorder::EventType::START, 1u);
+
+        EXPECT_TRUE(flightRecorder.getEvents().empty());
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFlightRecorder_Happy, writeChromeTrace)
+{
+    // Case with execution and waiting slices
+    {
+        FlightRecorder flightRecorder{ 1u, 8u };
+        flightRecorder.record(0u, FlightRecorder::EventType::PARK, 0u, 0u, 100u);
+        flightRecorder.record(0u, FlightRecorder::EventType::UNPARK, 0u, 0u, 130u);
+        flightRecorder.record(0u, FlightRecorder::EventType::START, 5u, 0u, 140u);
+        flightRecorder.record(0u, FlightRecorder::EventType::END, 5u, 0u, 190u);
+        flightRecorder.record(0u, FlightRecorder::EventType::START, 6u, 0u, 200u);
+
+        std::stringstream trace;
+        flightRecorder.writeChromeTrace(trace, 3u, { "Worker \"first\"" });
+
+        EXPECT_NE(trace.str().find("\"args\":{\"name\":\"Worker \\\"first\\\"\"}"), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"idle\",\"cat\":\"park\",\"ph\":\"X\",\"pid\":3,\"tid\":0,\"ts\":100,\"dur\":30"), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"task 5\",\"cat\":\"task\",\"ph\":\"X\",\"pid\":3,\"tid\":0,\"ts\":140,\"dur\":50"), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"task 6\",\"cat\":\"task\",\"ph\":\"B\",\"pid\":3,\"tid\":0,\"ts\":200"), std::string::npos);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFlightRecorder_Unhappy, writeChromeTrace)
+{
+    // Case with end of the task, which start is overwritten
+    {
+        FlightRecorder flightRecorder{ 1u, 2u };
+        flightRecorder.record(0u, FlightRecorder::EventType::START, 5u, 0u, 100u);
+        flightRecorder.record(0u, FlightRecorder::EventType::END, 5u, 0u, 150u);
+        flightRecorder.record(0u, FlightRecorder::EventType::START, 6u, 0u, 160u);
+        flightRecorder.record(0u, FlightRecorder::EventType::END, 6u, 0u, 170u);
+        flightRecorder.record(0u, FlightRecorder::EventType::END, 7u, 0u, 180u);
+
+        std::stringstream trace;
+        flightRecorder.writeChromeTrace(trace, 1u);
+
+        EXPECT_EQ(trace.str().find("\"name\":\"task 5\""), std::string::npos);
+        EXPECT_EQ(trace.str().find("\"name\":\"task 6\""), std::string::npos);
+        EXPECT_EQ(trace.str().find("\"name\":\"task 7\""), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"Worker slot 0\""), std::string::npos);
+    }
+}
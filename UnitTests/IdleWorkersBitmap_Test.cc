@@ -0,0 +1,116 @@
+#include "gtest/gtest.h"
+#include "IdleWorkersBitmap.h"
+
+
+class Foundations_ThreadPoolIdleWorkersBitmap_Happy : public ::testing::Test
+{
+};
+
+class Foundations_ThreadPoolIdleWorkersBitmap_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Happy, set)
+{
+    // Case with slots in different words
+    {
+        IdleWorkersBitmap bitmap{ 130u };
+        bitmap.set(3u);
+        bitmap.set(64u);
+        bitmap.set(129u);
+
+        EXPECT_TRUE(bitmap.isSet(3u));
+        EXPECT_TRUE(bitmap.isSet(64u));
+        EXPECT_TRUE(bitmap.isSet(129u));
+        EXPECT_FALSE(bitmap.isSet(4u));
+        EXPECT_EQ(bitmap.count(), 3u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Unhappy, set)
+{
+    // Case with slot out of capacity
+    {
+        IdleWorkersBitmap bitmap{ 10u };
+        bitmap.set(10u);
+
+        EXPECT_FALSE(bitmap.isSet(10u));
+        EXPECT_EQ(bitmap.count(), 0u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Happy, acquireFirst)
+{
+    // Case with lowest slot acquired first and cleared after acquiring
+    {
+        IdleWorkersBitmap bitmap{ 200u };
+        bitmap.set(150u);
+        bitmap.set(70u);
+
+        EXPECT_EQ(bitmap.acquireFirst(), 70);
+        EXPECT_FALSE(bitmap.isSet(70u));
+        EXPECT_EQ(bitmap.acquireFirst(), 150);
+        EXPECT_EQ(bitmap.count(), 0u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Unhappy, acquireFirst)
+{
+    // Case with no idle slots
+    {
+        IdleWorkersBitmap bitmap{ 64u };
+
+        EXPECT_EQ(bitmap.acquireFirst(), IdleWorkersBitmap::INVALID_SLOT);
+    }
+
+    // Case with zero capacity
+    {
+        IdleWorkersBitmap bitmap{ 0u };
+
+        EXPECT_EQ(bitmap.acquireFirst(), IdleWorkersBitmap::INVALID_SLOT);
+    }
+
+    // Case with reset slot
+    {
+        IdleWorkersBitmap bitmap{ 8u };
+        bitmap.set(5u);
+        bitmap.reset(5u);
+
+        EXPECT_EQ(bitmap.acquireFirst(), IdleWorkersBitmap::INVALID_SLOT);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Happy, acquire)
+{
+    // Case with idle slot acquired only once
+    {
+        IdleWorkersBitmap bitmap{ 100u };
+        bitmap.set(65u);
+
+        EXPECT_TRUE(bitmap.acquire(65u));
+        EXPECT_FALSE(bitmap.acquire(65u));
+        EXPECT_FALSE(bitmap.isSet(65u));
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolIdleWorkersBitmap_Happy, acquireFirstExcept)
+{
+    // Case with excluded lowest slot
+    {
+        IdleWorkersBitmap bitmap{ 16u };
+        IdleWorkersBitmap excludedSlots{ 16u };
+        bitmap.set(1u);
+        bitmap.set(9u);
+        excludedSlots.set(1u);
+
+        EXPECT_EQ(bitmap.acquireFirstExcept(excludedSlots), 9);
+        EXPECT_EQ(bitmap.acquireFirstExcept(excludedSlots), IdleWorkersBitmap::INVALID_SLOT);
+        EXPECT_TRUE(bitmap.isSet(1u));
+    }
+}
@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+#include "LatencyHistogram.h"
+
+
+class Foundations_ThreadPoolLatencyHistogram_Happy : public ::testing::Test
+{
+};
+
+class Foundations_ThreadPoolLatencyHistogram_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Happy, getBucketIndex)
+{
+    // Case with exact small values
+    {
+        for (uint64_t value = 0u; value < LatencyHistogram::SUB_BUCKETS; ++value)
+        {
+            EXPECT_EQ(LatencyHistogram::getBucketHighestValue(LatencyHistogram::getBucketIndex(value)), value);
+        }
+    }
+
+    // Case with relative error bound of large values
+    {
+        for (uint64_t value = LatencyHistogram::SUB_BUCKETS; value < 10000000u; value = value * 3u / 2u + 1u)
+        {
+            const uint64_t highestValue{ LatencyHistogram::getBucketHighestValue(LatencyHistogram::getBucketIndex(value)) };
+
+            EXPECT_GE(highestValue, value);
+            EXPECT_LE(highestValue - value, value / LatencyHistogram::SUB_BUCKETS);
+        }
+    }
+
+    // Case with monotonic buckets
+    {
+        EXPECT_LT(LatencyHistogram::getBucketIndex(31u), LatencyHistogram::getBucketIndex(32u));
+        EXPECT_EQ(LatencyHistogram::getBucketIndex(32u), LatencyHistogram::getBucketIndex(33u));
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Unhappy, getBucketIndex)
+{
+    // Case with value above max exponent
+    {
+        EXPECT_EQ(LatencyHistogram::getBucketIndex(UINT64_MAX), LatencyHistogram::NUMBER_OF_BUCKETS - 1u);
+        EXPECT_EQ(LatencyHistogram::getBucketIndex(1ull << LatencyHistogram::MAX_EXPONENT), LatencyHistogram::NUMBER_OF_BUCKETS - 1u);
+        EXPECT_EQ(LatencyHistogram::getBucketIndex((1ull << LatencyHistogram::MAX_EXPONENT) - 1u), LatencyHistogram::NUMBER_OF_BUCKETS - 1u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Happy, getPercentile)
+{
+    // Case with uniform values
+    {
+        LatencyHistogram histogram{};
+        for (uint64_t value = 1u; value <= 100u; ++value)
+        {
+            histogram.record(value);
+        }
+
+        const LatencyHistogram::Snapshot snapshot{ histogram.getSnapshot() };
+
+        EXPECT_EQ(snapshot.getCount(), 100u);
+        EXPECT_EQ(snapshot.getSum(), 5050u);
+        EXPECT_DOUBLE_EQ(snapshot.getMean(), 50.5);
+        EXPECT_NEAR(static_cast<double>(snapshot.getPercentile(50.0)), 50.0, 50.0 / LatencyHistogram::SUB_BUCKETS);
+        EXPECT_NEAR(static_cast<double>(snapshot.getPercentile(99.0)), 99.0, 99.0 / LatencyHistogram::SUB_BUCKETS);
+        EXPECT_EQ(snapshot.getPercentile(0.0), 1u);
+        EXPECT_GE(snapshot.getPercentile(100.0), 100u);
+    }
+
+    // Case with rank rounded up
+    {
+        LatencyHistogram histogram{};
+        for (uint64_t value = 1u; value <= 10u; ++value)
+        {
+            histogram.record(value);
+        }
+
+        const LatencyHistogram::Snapshot snapshot{ histogram.getSnapshot() };
+
+        EXPECT_EQ(snapshot.getPercentile(14.0), 2u);
+        EXPECT_EQ(snapshot.getPercentile(30.0), 3u);
+        EXPECT_EQ(snapshot.getPercentile(41.0), 5u);
+        EXPECT_EQ(snapshot.getPercentile(100.0), 10u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Happy, getCountAtOrBelow)
+{
+    // Case with cumulative counts of exact and approximated values
+    {
+        LatencyHistogram histogram{};
+        for (uint64_t value = 1u; value <= 100u; ++value)
+        {
+            histogram.record(value);
+        }
+
+        const LatencyHistogram::Snapshot snapshot{ histogram.getSnapshot() };
+
+        EXPECT_EQ(snapshot.getCountAtOrBelow(0u), 0u);
+        EXPECT_EQ(snapshot.getCountAtOrBelow(10u), 10u);
+        EXPECT_LE(snapshot.getCountAtOrBelow(50u), 50u);
+        EXPECT_GE(snapshot.getCountAtOrBelow(50u), 50u - 50u / LatencyHistogram::SUB_BUCKETS);
+        EXPECT_EQ(snapshot.getCountAtOrBelow(1000u), 100u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Unhappy, getPercentile)
+{
+    // Case with empty histogram
+    {
+        LatencyHistogram histogram{};
+
+        EXPECT_EQ(histogram.getSnapshot().getPercentile(50.0), 0u);
+        EXPECT_DOUBLE_EQ(histogram.getSnapshot().getMean(), 0.0);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLatencyHistogram_Happy, merge)
+{
+    // Case with snapshots of two histograms
+    {
+        LatencyHistogram fastHistogram{};
+        LatencyHistogram slowHistogram{};
+
+        for (uint32_t i = 0u; i < 90u; ++i)
+        {
+            fastHistogram.record(10u);
+        }
+        for (uint32_t i = 0u; i < 10u; ++i)
+        {
+            slowHistogram.record(1000u);
+        }
+
+        LatencyHistogram::Snapshot snapshot{ fastHistogram.getSnapshot() };
+        snapshot.merge(slowHistogram.getSnapshot());
+
+        EXPECT_EQ(snapshot.getCount(), 100u);
+        EXPECT_EQ(snapshot.getPercentile(90.0), 10u);
+        EXPECT_GE(snapshot.getPercentile(95.0), 1000u);
+    }
+
+    // Case with histogram merged into another one and reset
+    {
+        LatencyHistogram histogram{};
+        LatencyHistogram otherHistogram{};
+        histogram.record(5u);
+        otherHistogram.record(7u);
+
+        histogram.merge(otherHistogram);
+        otherHistogram.reset();
+
+        EXPECT_EQ(histogram.getSnapshot().getCount(), 2u);
+        EXPECT_EQ(histogram.getSnapshot().getSum(), 12u);
+        EXPECT_EQ(otherHistogram.getSnapshot().getCount(), 0u);
+    }
+}
@@ -0,0 +1,138 @@
+#include "gtest/gtest.h"
+#include <thread>
+#include "OSAL.h"
+#include "Logging.h"
+
+
+class Foundations_OSAL_LockProfiler_Happy : public ::testing::Test
+{
+public:
+
+    const OSAL::LockProfiler::LockStatistic * findStatistic(const std::vector<OSAL::LockProfiler::LockStatistic> & statistics,
+                                                            const std::string & name) const
+    {
+        for (auto && statistic : statistics)
+        {
+            if (statistic.name == name)
+            {
+                return &statistic;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+class Foundations_OSAL_LockProfiler_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_OSAL_LockProfiler_Happy, registerLock)
+{
+    // Case with locks sharing the name
+    {
+        OSAL::LockProfiler & lockProfiler = OSAL::LockProfiler::getInstance();
+
+        const uint32_t lockId{ lockProfiler.registerLock("LockProfilerTest(Shared)") };
+
+        EXPECT_NE(lockId, OSAL::LockProfiler::INVALID_LOCK_ID);
+        EXPECT_EQ(lockId, lockProfiler.registerLock("LockProfilerTest(Shared)"));
+        EXPECT_NE(lockId, lockProfiler.registerLock("LockProfilerTest(Other)"));
+    }
+}
+
+
+TEST_F(Foundations_OSAL_LockProfiler_Happy, getStatistics)
+{
+    // Case with records of the current and already finished thread
+    {
+        OSAL::LockProfiler & lockProfiler = OSAL::LockProfiler::getInstance();
+        const uint32_t lockId{ lockProfiler.registerLock("LockProfilerTest(Statistics)") };
+
+        lockProfiler.recordAcquisition(lockId, false, 0u);
+        lockProfiler.recordRelease(lockId, 100u);
+
+        std::thread thread{ [&lockProfiler, lockId]
+                            {
+                                lockProfiler.recordAcquisition(lockId, true, 3000u);
+                                lockProfiler.recordRelease(lockId, 50u);
+                                lockProfiler.recordAcquisition(lockId, true, 1000u);
+                                lockProfiler.recordRelease(lockId, 400u);
+                            } };
+        thread.join();
+
+        const std::vector<OSAL::LockProfiler::LockStatistic> statistics{ lockProfiler.getStatistics() };
+        const OSAL::LockProfiler::LockStatistic * statistic{ findStatistic(statistics, "LockProfilerTest(Statistics)") };
+
+        ASSERT_NE(statistic, nullptr);
+        EXPECT_EQ(statistic->numberOfAcquisitions, 3u);
+        EXPECT_EQ(statistic->numberOfContendedAcquisitions, 2u);
+        EXPECT_EQ(statistic->totalWaitTime, 4000u);
+        EXPECT_EQ(statistic->maxWaitTime, 3000u);
+        EXPECT_EQ(statistic->totalHoldTime, 550u);
+        EXPECT_EQ(statistic->maxHoldTime, 400u);
+
+        EXPECT_NE(lockProfiler.getReport().find("LockProfilerTest(Statistics)"), std::string::npos);
+    }
+
+    // Case with mutex recording its own contention
+    if (OSAL::LockProfiler::isEnabled())
+    {
+        OSAL::Mutex mutex{ Logging::getInstance("LockProfilerTest(Mutex)") };
+
+        mutex.lock();
+        std::thread thread{ [&mutex]
+                            {
+                                mutex.lock();
+                                mutex.unlock();
+                            } };
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        mutex.unlock();
+        thread.join();
+
+        const std::vector<OSAL::LockProfiler::LockStatistic> statistics{ OSAL::LockProfiler::getInstance().getStatistics() };
+        const OSAL::LockProfiler::LockStatistic * statistic{ findStatistic(statistics, "LockProfilerTest(Mutex)") };
+
+        ASSERT_NE(statistic, nullptr);
+        EXPECT_EQ(statistic->numberOfAcquisitions, 2u);
+        EXPECT_EQ(statistic->numberOfContendedAcquisitions, 1u);
+        EXPECT_GT(statistic->maxWaitTime, 0u);
+        EXPECT_GT(statistic->maxHoldTime, 0u);
+    }
+
+    // Case with monitor, which reacquires its mutex after waiting
+    if (OSAL::LockProfiler::isEnabled())
+    {
+        OSAL::Monitor monitor{ Logging::getInstance("LockProfilerTest(Monitor)") };
+
+        monitor.lock();
+        monitor.wait(1000);
+        monitor.wait(1000);
+        monitor.unlock();
+
+        const std::vector<OSAL::LockProfiler::LockStatistic> statistics{ OSAL::LockProfiler::getInstance().getStatistics() };
+        const OSAL::LockProfiler::LockStatistic * statistic{ findStatistic(statistics, "LockProfilerTest(Monitor)") };
+
+        ASSERT_NE(statistic, nullptr);
+        EXPECT_EQ(statistic->numberOfAcquisitions, 1u);
+        EXPECT_EQ(statistic->numberOfContendedAcquisitions, 0u);
+    }
+}
+
+
+TEST_F(Foundations_OSAL_LockProfiler_Unhappy, recordAcquisition)
+{
+    // Case with lock, which isn't registered
+    {
+        OSAL::LockProfiler & lockProfiler = OSAL::LockProfiler::getInstance();
+
+        lockProfiler.recordAcquisition(OSAL::LockProfiler::INVALID_LOCK_ID, true, 1000u);
+        lockProfiler.recordRelease(OSAL::LockProfiler::INVALID_LOCK_ID, 1000u);
+
+        for (auto && statistic : lockProfiler.getStatistics())
+        {
+            EXPECT_FALSE(statistic.name.empty());
+        }
+    }
+}
@@ -0,0 +1,204 @@
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include "Logging.h"
+
+
+class Foundations_ThreadPoolLogging_Happy : public ::testing::Test
+{
+};
+
+class Foundations_ThreadPoolLogging_Unhappy : public ::testing::Test
+{
+};
+
+
+TEST_F(Foundations_ThreadPoolLogging_Happy, isEnabled)
+{
+    // Case with default levels
+    {
+        EXPECT_TRUE(Logging::isEnabled(Logging::LOG_ERROR));
+        EXPECT_TRUE(Logging::isEnabled(Logging::LOG_WARNING));
+        EXPECT_TRUE(Logging::isEnabled(Logging::LOG_INFO));
+        EXPECT_FALSE(Logging::isEnabled(Logging::LOG_DEBUG));
+    }
+
+    // Case with all levels disabled at once
+    {
+        Logging::enableLoggingLevel(Logging::LOG_DISABLED);
+
+        EXPECT_FALSE(Logging::isEnabled(Logging::LOG_ERROR));
+
+        Logging::disableLoggingLevel(Logging::LOG_DISABLED);
+
+        EXPECT_TRUE(Logging::isEnabled(Logging::LOG_ERROR));
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLogging_Unhappy, isEnabled)
+{
+    // Case with arguments of disabled level, which must not be evaluated
+    {
+        std::unique_ptr<Logging> logging{ new Logging{ "Test" } };
+        uint32_t numberOfEvaluations{ 0u };
+
+        Logging::disableLoggingLevel(Logging::LOG_WARNING);
+        LOGGING_WARNING(logging, "%" PRIu32, ++numberOfEvaluations);
+        LOGGING_DEBUG(logging, "%" PRIu32, ++numberOfEvaluations);
+        Logging::enableLoggingLevel(Logging::LOG_WARNING);
+
+        EXPECT_EQ(numberOfEvaluations, 0u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLogging_Happy, getInstance)
+{
+    // Case with the same name interned once
+    {
+        Logging * logging{ Logging::getInstance("InternedTest") };
+
+        EXPECT_EQ(logging, Logging::getInstance("InternedTest"));
+        EXPECT_NE(logging, Logging::getInstance("OtherInternedTest"));
+    }
+
+    // Case with sub instance shared with the instance of the full name
+    {
+        Logging * logging{ Logging::getInstance("InternedTest") };
+        Logging * subInstance{ logging->getSubInstance("Worker") };
+
+        EXPECT_EQ(subInstance, logging->getSubInstance("Worker"));
+        EXPECT_EQ(subInstance, Logging::getInstance("InternedTest(Worker)"));
+        EXPECT_NE(subInstance, logging->getSubInstance("WorkersMutex"));
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLogging_Happy, enableAsyncLogging)
+{
+    // Case with records of several threads written to the file
+    {
+        const std::string filePath{ "Foundations_ThreadPoolLogging_enableAsyncLogging.log" };
+        std::remove(filePath.c_str());
+
+        ASSERT_TRUE(Logging::enableAsyncLogging(filePath, 64u));
+        EXPECT_FALSE(Logging::enableAsyncLogging(filePath, 64u));
+
+        const uint64_t numberOfDroppedRecordsBefore{ Logging::getNumberOfDroppedRecords() };
+        const uint32_t numberOfThreads{ 4u };
+        const uint32_t numberOfRecordsPerThread{ 100u };
+
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0u; i < numberOfThreads; ++i)
+        {
+            threads.emplace_back([i, numberOfRecordsPerThread]
+                                 {
+                                     Logging logging{ "AsyncTest" };
+                                     for (uint32_t j = 0u; j < numberOfRecordsPerThread; ++j)
+                                     {
+                                         logging.logInfo("thread %" PRIu32 " record %" PRIu32, i, j);
+                                     }
+                                 });
+        }
+
+        for (auto && thread : threads)
+        {
+            thread.join();
+        }
+
+        Logging::disableAsyncLogging();
+
+        std::ifstream file{ filePath };
+        std::string line;
+        uint64_t numberOfLines{ 0u };
+
+        while (std::getline(file, line))
+        {
+            EXPECT_NE(line.find("AsyncTest INFO > thread "), std::string::npos);
+            ++numberOfLines;
+        }
+
+        // Records, which don't fit into the ring till it's drained, are dropped instead of blocking the thread
+        EXPECT_EQ(numberOfLines + Logging::getNumberOfDroppedRecords() - numberOfDroppedRecordsBefore, numberOfThreads * numberOfRecordsPerThread);
+        EXPECT_GT(numberOfLines, 0u);
+
+        file.close();
+        std::remove(filePath.c_str());
+    }
+
+    // Case with records of threads, which keep logging while async logging is disabled
+    {
+        const std::string filePath{ "Foundations_ThreadPoolLogging_disableAsyncLogging.log" };
+        std::remove(filePath.c_str());
+
+        ASSERT_TRUE(Logging::enableAsyncLogging(filePath, 4096u));
+
+        const uint64_t numberOfDroppedRecordsBefore{ Logging::getNumberOfDroppedRecords() };
+        const uint32_t numberOfThreads{ 4u };
+        const uint32_t numberOfRecordsPerThread{ 2000u };
+        std::atomic<uint32_t> numberOfStartedThreads{ 0u };
+
+        testing::internal::CaptureStdout();
+
+        std::vector<std::thread> threads;
+        for (uint32_t i = 0u; i < numberOfThreads; ++i)
+        {
+            threads.emplace_back([i, numberOfRecordsPerThread, &numberOfStartedThreads]
+                                 {
+                                     Logging logging{ "AsyncStopTest" };
+                                     ++numberOfStartedThreads;
+                                     for (uint32_t j = 0u; j < numberOfRecordsPerThread; ++j)
+                                     {
+                                         logging.logInfo("thread %" PRIu32 " record %" PRIu32, i, j);
+                                     }
+                                 });
+        }
+
+        while (numberOfStartedThreads.load() != numberOfThreads)
+        {
+            std::this_thread::yield();
+        }
+
+        Logging::disableAsyncLogging();
+
+        for (auto && thread : threads)
+        {
+            thread.join();
+        }
+
+        const std::string output{ testing::internal::GetCapturedStdout() };
+
+        uint64_t numberOfLines{ 0u };
+        for (size_t position = output.find("AsyncStopTest INFO"); position != std::string::npos; position = output.find("AsyncStopTest INFO", position + 1u))
+        {
+            ++numberOfLines;
+        }
+
+        std::ifstream file{ filePath };
+        std::string line;
+
+        while (std::getline(file, line))
+        {
+            EXPECT_NE(line.find("AsyncStopTest INFO > thread "), std::string::npos);
+            ++numberOfLines;
+        }
+
+        // Every record is written either by the backend before it stops or synchronously after that
+        EXPECT_EQ(numberOfLines + Logging::getNumberOfDroppedRecords() - numberOfDroppedRecordsBefore, numberOfThreads * numberOfRecordsPerThread);
+
+        file.close();
+        std::remove(filePath.c_str());
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolLogging_Unhappy, enableAsyncLogging)
+{
+    // Case with file, which can't be opened
+    {
+        EXPECT_FALSE(Logging::enableAsyncLogging("/not/existing/directory/async.log"));
+    }
+}
@@ -1,11 +1,13 @@
 #include "gtest/gtest.h"
 
 #include <utility>
+#include <thread>
 
 #include "ThreadPoolTask.h"
 #include "FirstComeFirstServedTaskScheduler.h"
 #include "PriorityTaskScheduler.h"
 #include "ShortestJobFirstTaskScheduler.h"
+#include "FairShareTaskScheduler.h"
 
 
 class TestTask : public ThreadPoolTask
@@ -121,7 +123,33 @@ protected: // getTaskForExecution
     void testGetTaskForExecutionWithAlreadyCanceledTask(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testGetTaskForExecutionWithCorrectTask(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        std::shared_ptr<IThreadPoolTask> gotTaskForExecution = taskScheduler->getTaskForExecution();
+
+        EXPECT_WRONG_TASK(taskScheduler, gotTaskForExecution);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfGotForExecutionTasks, 0u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfReclaimedTasks, 1u);
+    }
+
+    void testGetTaskForExecutionWithTaskCanceledWhileScheduled(ITaskScheduler * const taskScheduler,
+                                                               const std::shared_ptr<IThreadPoolTask> & task1, const std::shared_ptr<IThreadPoolTask> & task2)
+    {
+        taskScheduler->schedule(task1);
+        taskScheduler->schedule(task2);
+
+        task1->cancel();
+
+        EXPECT_EQ(taskScheduler->getSize(), 1u);
+        EXPECT_EQ(taskScheduler->getApproximateSize(), 1u);
+        EXPECT_FALSE(taskScheduler->isScheduled(task1->getId()));
+
+        std::shared_ptr<IThreadPoolTask> gotTaskForExecution = taskScheduler->getTaskForExecution();
+
+        EXPECT_CORRECT_TASK(taskScheduler, gotTaskForExecution);
+        EXPECT_EQ(gotTaskForExecution, task2);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfGotForExecutionTasks, 1u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfReclaimedTasks, 1u);
     }
 
 
@@ -173,6 +201,7 @@ protected: // waitTaskForExecution
         schedulerThread.create();
 
         waiterThread.waitFinished(waitTimeoutInMicroseconds);
+        schedulerThread.waitFinished(waitTimeoutInMicroseconds);
     }
 
     void testWaitTaskForExecutionWithNotScheduledTask(ITaskScheduler * const taskScheduler)
@@ -221,7 +250,13 @@ protected: // steal
     void testStealWithAlreadyCanceledTask(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testStealWithCorrectTask(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        std::shared_ptr<IThreadPoolTask> stolenTask = taskScheduler->steal();
+
+        EXPECT_WRONG_TASK(taskScheduler, stolenTask);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfStolenTasks, 0u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfReclaimedTasks, 1u);
     }
 
 
@@ -259,7 +294,14 @@ protected: // schedule
     void testScheduleWithAlreadyCanceledTask(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testScheduleWithCorrectTask(taskScheduler, task);
+
+        const Result result = taskScheduler->schedule(task);
+
+        // Canceled task is accepted as a tombstone, which isn't counted
+        EXPECT_EQ(result, Result::OK);
+        EXPECT_EQ(taskScheduler->getSize(), 0u);
+        EXPECT_FALSE(taskScheduler->isScheduled(task->getId()));
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfScheduledTasks, 1u);
     }
 
 
@@ -317,7 +359,12 @@ protected: // unscheduleOne
     void testUnscheduleOneWithAlreadyCanceledTask(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testUnscheduleOneWithCorrectTask(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        std::shared_ptr<IThreadPoolTask> unscheduledTask = taskScheduler->unscheduleOne(task->getId());
+
+        EXPECT_WRONG_TASK(taskScheduler, unscheduledTask);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfUnscheduledTasks, 0u);
     }
 
 
@@ -376,7 +423,13 @@ protected: // unscheduleAll
     void testUnscheduleAllWithAlreadyCanceledTasks(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testUnscheduleAllWithCorrectSameTasks(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        std::vector<std::shared_ptr<IThreadPoolTask>> unscheduledTasks = taskScheduler->unscheduleAll();
+
+        EXPECT_TASKS_EMPTY(taskScheduler, unscheduledTasks);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfUnscheduledTasks, 0u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfReclaimedTasks, 1u);
     }
 
 
@@ -435,7 +488,14 @@ protected: // clearAll
     void testClearAllWithAlreadyCanceledTasks(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testClearAllWithCorrectSameTasks(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        const Result result = taskScheduler->clearAll();
+
+        ASSERT_EQ(result, Result::ERROR);
+        EXPECT_EQ(taskScheduler->getSize(), 0u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfUnscheduledTasks, 0u);
+        EXPECT_EQ(taskScheduler->getStatistic().totalNumberOfReclaimedTasks, 1u);
     }
 
 
@@ -486,7 +546,9 @@ protected: // isScheduled
     void testIsScheduledWithAlreadyCanceledTask(ITaskScheduler * const taskScheduler, const std::shared_ptr<IThreadPoolTask> & task)
     {
         task->cancel();
-        testIsScheduledWithCorrectTask(taskScheduler, task);
+        taskScheduler->schedule(task);
+
+        EXPECT_FALSE(taskScheduler->isScheduled(task->getId()));
     }
 };
 
@@ -726,6 +788,29 @@ class Foundations_ThreadPoolBurstTimeTaskScheduler_Unhappy: public Foundations_T
 };
 
 
+class Foundations_ThreadPoolFairShareTaskScheduler_Happy: public Foundations_TaskSchedulerBase
+{
+protected:
+
+    std::string getTenantsOrder(FairShareTaskScheduler * const taskScheduler)
+    {
+        std::string tenantsOrder;
+
+        for (auto task = taskScheduler->getTaskForExecution(); task != nullptr; task = taskScheduler->getTaskForExecution())
+        {
+            tenantsOrder += std::dynamic_pointer_cast<TenantTask>(task)->getTenant();
+        }
+
+        return tenantsOrder;
+    }
+};
+
+class Foundations_ThreadPoolFairShareTaskScheduler_Unhappy: public Foundations_TaskSchedulerBase
+{
+
+};
+
+
 
 /////////////////////////////////////////////////////////////////////////////////////// FCFS
 
@@ -747,6 +832,15 @@ TEST_F(Foundations_ThreadPoolFirstComeFirstServedTaskScheduler_Happy, getTaskFor
         Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTaskDoubleCall(&taskScheduler, task);
     }
 
+    // Case with task canceled while scheduled
+    {
+        FirstComeFirstServedTaskScheduler taskScheduler{nullptr};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TestTask>();
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TestTask>();
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithTaskCanceledWhileScheduled(&taskScheduler, task1, task2);
+    }
+
     // Case with algorithm specifics
     {
         FirstComeFirstServedTaskScheduler taskScheduler{nullptr};
@@ -1181,6 +1275,57 @@ TEST_F(Foundations_ThreadPoolFirstComeFirstServedTaskScheduler_Unhappy, isSchedu
 
 
 
+TEST_F(Foundations_ThreadPoolFirstComeFirstServedTaskScheduler_Happy, getApproximateSize)
+{
+    // Case with published size following schedule, steal and getTaskForExecution
+    {
+        FirstComeFirstServedTaskScheduler taskScheduler{nullptr};
+
+        taskScheduler.schedule(std::vector<std::shared_ptr<IThreadPoolTask>>{ std::make_shared<TestTask>(), std::make_shared<TestTask>(), std::make_shared<TestTask>() });
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 3u);
+        EXPECT_EQ(taskScheduler.getApproximateWork(), 3u);
+
+        taskScheduler.steal();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 2u);
+
+        taskScheduler.getTaskForExecution();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 1u);
+
+        taskScheduler.clearAll();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 0u);
+        EXPECT_EQ(taskScheduler.getApproximateWork(), 0u);
+    }
+}
+
+
+
+
+TEST_F(Foundations_ThreadPoolFirstComeFirstServedTaskScheduler_Happy, unscheduleOldest)
+{
+    // Case with the first scheduled task
+    {
+        FirstComeFirstServedTaskScheduler taskScheduler{nullptr};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TestTask>();
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TestTask>();
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+
+        EXPECT_EQ(taskScheduler.unscheduleOldest(), task1);
+        EXPECT_EQ(taskScheduler.getSize(), 1u);
+        EXPECT_EQ(taskScheduler.getStatistic().totalNumberOfUnscheduledTasks, 1u);
+    }
+
+    // Case with not scheduled task
+    {
+        FirstComeFirstServedTaskScheduler taskScheduler{nullptr};
+
+        EXPECT_EQ(taskScheduler.unscheduleOldest(), nullptr);
+    }
+}
+
+
+
 
 /////////////////////////////////////////////////////////////////////////////////////// PriorityTask
 
@@ -1202,6 +1347,15 @@ TEST_F(Foundations_ThreadPoolPriorityTaskScheduler_Happy, getTaskForExecution)
         Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTaskDoubleCall(&taskScheduler, task);
     }
 
+    // Case with task canceled while scheduled
+    {
+        PriorityTaskScheduler taskScheduler{nullptr};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<PriorityTask>();
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<PriorityTask>();
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithTaskCanceledWhileScheduled(&taskScheduler, task1, task2);
+    }
+
     // Case with scheduling first lower then higher priority task
     {
         PriorityTaskScheduler taskScheduler{nullptr};
@@ -1683,6 +1837,15 @@ TEST_F(Foundations_ThreadPoolBurstTimeTaskScheduler_Happy, getTaskForExecution)
         Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTaskDoubleCall(&taskScheduler, task);
     }
 
+    // Case with task canceled while scheduled
+    {
+        ShortestJobFirstTaskScheduler taskScheduler{nullptr};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<BurstTimeTask>();
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<BurstTimeTask>();
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithTaskCanceledWhileScheduled(&taskScheduler, task1, task2);
+    }
+
     // Case with scheduling first longer then shorter burst time task
     {
         ShortestJobFirstTaskScheduler taskScheduler{nullptr};
@@ -2147,4 +2310,333 @@ TEST_F(Foundations_ThreadPoolBurstTimeTaskScheduler_Unhappy, isScheduled)
 
         Foundations_TaskSchedulerBase::testIsScheduledWithAlreadyCanceledTask(&taskScheduler, task);
     }
-}
\ No newline at end of file
+}
+
+
+TEST_F(Foundations_ThreadPoolBurstTimeTaskScheduler_Happy, getApproximateWork)
+{
+    // Case with work weighted by burst time
+    {
+        ShortestJobFirstTaskScheduler taskScheduler{nullptr};
+
+        taskScheduler.schedule(std::make_shared<BurstTimeTask>(BurstTime::SHORT));
+        taskScheduler.schedule(std::make_shared<BurstTimeTask>(BurstTime::LONG));
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 2u);
+        EXPECT_EQ(taskScheduler.getApproximateWork(), 5u);
+
+        taskScheduler.getTaskForExecution();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 1u);
+        EXPECT_EQ(taskScheduler.getApproximateWork(), 4u);
+
+        taskScheduler.unscheduleAll();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 0u);
+        EXPECT_EQ(taskScheduler.getApproximateWork(), 0u);
+    }
+}
+
+
+
+
+TEST_F(Foundations_ThreadPoolPriorityTaskScheduler_Happy, unscheduleOldest)
+{
+    // Case with the oldest task of lower priority
+    {
+        PriorityTaskScheduler taskScheduler{nullptr};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<PriorityTask>(Priority::LOW);
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<PriorityTask>(Priority::HIGH);
+        task1->setAddedTime(10u);
+        task2->setAddedTime(20u);
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+
+        EXPECT_EQ(taskScheduler.unscheduleOldest(), task1);
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task2);
+    }
+}
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////////////// FairShare
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Happy, getTaskForExecution)
+{
+    // Case with correct task
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTask(&taskScheduler, task);
+    }
+
+    // Case with correct task double call
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTaskDoubleCall(&taskScheduler, task);
+    }
+
+    // Case with task canceled while scheduled
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("b");
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithTaskCanceledWhileScheduled(&taskScheduler, task1, task2);
+    }
+
+    // Case with task without tenant
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TestTask>();
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithCorrectTask(&taskScheduler, task);
+    }
+
+    // Case with flooding tenant scheduled first
+    {
+        FairShareTaskScheduler taskScheduler{};
+
+        for (uint32_t i = 0u; i < 4u; ++i)
+        {
+            taskScheduler.schedule(std::make_shared<TenantTask>("a"));
+        }
+        taskScheduler.schedule(std::make_shared<TenantTask>("b"));
+        taskScheduler.schedule(std::make_shared<TenantTask>("b"));
+
+        EXPECT_EQ(getTenantsOrder(&taskScheduler), "ababaa");
+    }
+
+    // Case with weighted tenants
+    {
+        FairShareTaskScheduler taskScheduler{ { { "a", 1u }, { "b", 3u } } };
+
+        for (uint32_t i = 0u; i < 4u; ++i)
+        {
+            taskScheduler.schedule(std::make_shared<TenantTask>("a"));
+            taskScheduler.schedule(std::make_shared<TenantTask>("b"));
+        }
+
+        EXPECT_EQ(getTenantsOrder(&taskScheduler), "abbbab" "aa");
+    }
+
+    // Case with tasks of one tenant in FCFS order
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("a");
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task1);
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task2);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Unhappy, getTaskForExecution)
+{
+    // Case with not scheduled task
+    {
+        FairShareTaskScheduler taskScheduler{};
+
+        Foundations_TaskSchedulerBase::testGetTaskForExecutionWithNotScheduledTask(&taskScheduler);
+    }
+
+    // Case with zero weight
+    {
+        FairShareTaskScheduler taskScheduler{ { { "a", 0u } } };
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task3 = std::make_shared<TenantTask>("b");
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+        taskScheduler.schedule(task3);
+
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task1);
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task3);
+        EXPECT_EQ(taskScheduler.getTaskForExecution(), task2);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Happy, steal)
+{
+    // Case with correct task
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testStealWithCorrectTask(&taskScheduler, task);
+    }
+
+    // Case with the newest task of the biggest tenant
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("b");
+        std::shared_ptr<IThreadPoolTask> task3 = std::make_shared<TenantTask>("b");
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+        taskScheduler.schedule(task3);
+
+        EXPECT_EQ(taskScheduler.steal(), task3);
+        EXPECT_EQ(taskScheduler.getSize(), 2u);
+        EXPECT_EQ(taskScheduler.getStatistic().totalNumberOfStolenTasks, 1u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Unhappy, steal)
+{
+    // Case with not scheduled task
+    {
+        FairShareTaskScheduler taskScheduler{};
+
+        Foundations_TaskSchedulerBase::testStealWithNotScheduledTask(&taskScheduler);
+    }
+
+    // Case with canceled tasks of the biggest tenant and then of all tenants
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("b");
+        std::shared_ptr<IThreadPoolTask> task3 = std::make_shared<TenantTask>("b");
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+        taskScheduler.schedule(task3);
+
+        task2->cancel();
+        task3->cancel();
+
+        EXPECT_EQ(taskScheduler.steal(), task1);
+
+        taskScheduler.schedule(task1);
+        task1->cancel();
+
+        EXPECT_EQ(taskScheduler.steal(), nullptr);
+        EXPECT_EQ(taskScheduler.getSize(), 0u);
+        EXPECT_EQ(taskScheduler.getStatistic().totalNumberOfStolenTasks, 1u);
+    }
+
+    // Case with tasks canceled concurrently with stealing
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::vector<std::shared_ptr<IThreadPoolTask>> tasks;
+
+        for (uint32_t i = 0u; i < 1000u; ++i)
+        {
+            tasks.push_back(std::make_shared<TenantTask>(i % 2u == 0u ? "a" : "b"));
+            taskScheduler.schedule(tasks.back());
+        }
+
+        std::thread canceler{ [&tasks] {
+            for (auto && task : tasks)
+            {
+                task->cancel();
+            }
+            } };
+
+        uint32_t numberOfStolenTasks{ 0u };
+        while (taskScheduler.steal() != nullptr)
+        {
+            ++numberOfStolenTasks;
+        }
+
+        canceler.join();
+
+        EXPECT_EQ(taskScheduler.steal(), nullptr);
+        EXPECT_EQ(taskScheduler.getSize(), 0u);
+        EXPECT_EQ(taskScheduler.getStatistic().totalNumberOfStolenTasks, numberOfStolenTasks);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Happy, unscheduleOne)
+{
+    // Case with correct task
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testUnscheduleOneWithCorrectTask(&taskScheduler, task);
+    }
+
+    // Case with emptied tenant leaving the round
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        taskScheduler.schedule(task);
+        taskScheduler.schedule(std::make_shared<TenantTask>("b"));
+        taskScheduler.schedule(std::make_shared<TenantTask>("b"));
+
+        EXPECT_EQ(taskScheduler.unscheduleOne(task->getId()), task);
+        EXPECT_EQ(getTenantsOrder(&taskScheduler), "bb");
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Unhappy, unscheduleOne)
+{
+    // Case with wrong task id
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testUnscheduleOneWithWrongTaskId(&taskScheduler, task);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Happy, unscheduleAll)
+{
+    // Case with correct different tasks
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("b");
+
+        Foundations_TaskSchedulerBase::testUnscheduleAllWithCorrectDifferentTasks(&taskScheduler, task1, task2);
+    }
+
+    // Case with clear all
+    {
+        FairShareTaskScheduler taskScheduler{};
+        std::shared_ptr<IThreadPoolTask> task = std::make_shared<TenantTask>("a");
+
+        Foundations_TaskSchedulerBase::testClearAllWithCorrectSameTasks(&taskScheduler, task);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolFairShareTaskScheduler_Happy, getApproximateSize)
+{
+    // Case with tasks of several tenants
+    {
+        FairShareTaskScheduler taskScheduler{};
+
+        std::shared_ptr<IThreadPoolTask> task1 = std::make_shared<TenantTask>("a");
+        std::shared_ptr<IThreadPoolTask> task2 = std::make_shared<TenantTask>("b");
+        task1->setAddedTime(20u);
+        task2->setAddedTime(10u);
+
+        taskScheduler.schedule(task1);
+        taskScheduler.schedule(task2);
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 2u);
+        EXPECT_EQ(taskScheduler.getApproximateOldestTaskAddedTime(), 10u);
+
+        taskScheduler.steal();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 1u);
+
+        taskScheduler.clearAll();
+        EXPECT_EQ(taskScheduler.getApproximateSize(), 0u);
+        EXPECT_EQ(taskScheduler.getApproximateOldestTaskAddedTime(), 0u);
+    }
+}
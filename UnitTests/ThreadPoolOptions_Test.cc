@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "ThreadPoolOptions.h"
+#include "PrometheusExporter.h"
 
 
 class Foundations_ThreadPoolThreadPoolOptions_Happy : public ::testing::Test
@@ -223,4 +224,191 @@ TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setWaitAllTasksExecutionFi
 TEST_F(Foundations_ThreadPoolThreadPoolOptions_Unhappy, setWaitAllTasksExecutionFinished)
 {
     // Nothing to test for now
-}
\ No newline at end of file
+}
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setWorkersAutoScaling)
+{
+    // Case with default values
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getQueueDelayToIncreaseWorkers(), 0u);
+        EXPECT_EQ(options.getWorkerKeepAliveTime(), 0u);
+        EXPECT_FALSE(options.isWorkersAutoScalingEnabled());
+    }
+
+    // Case with queue delay and keep alive time
+    {
+        ThreadPoolOptions options{};
+        options.setQueueDelayToIncreaseWorkers(10000u);
+        options.setWorkerKeepAliveTime(20000u);
+        options.setWorkersScalingCooldown(30000u);
+
+        EXPECT_EQ(options.getQueueDelayToIncreaseWorkers(), 10000u);
+        EXPECT_EQ(options.getWorkerKeepAliveTime(), 20000u);
+        EXPECT_EQ(options.getWorkersScalingCooldown(), 30000u);
+        EXPECT_TRUE(options.isWorkersAutoScalingEnabled());
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setAffinityPolicy)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getAffinityPolicy(), ThreadPoolOptions::AffinityPolicy::NONE);
+    }
+
+    // Case with explicit CPUs
+    {
+        ThreadPoolOptions options{};
+        options.setAffinityCpus({ 1u, 3u });
+
+        EXPECT_EQ(options.getAffinityPolicy(), ThreadPoolOptions::AffinityPolicy::EXPLICIT);
+        EXPECT_EQ(options.getAffinityCpus(), (std::vector<uint32_t>{ 1u, 3u }));
+    }
+
+    // Case with NUMA aware workers
+    {
+        ThreadPoolOptions options{};
+        options.setNumaAware();
+
+        EXPECT_TRUE(options.isNumaAware());
+        EXPECT_EQ(options.getAffinityPolicy(), ThreadPoolOptions::AffinityPolicy::NONE);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setMaxNumberOfBlockingWorkers)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getMaxNumberOfBlockingWorkers(), 0u);
+    }
+
+    // Case with blocking workers
+    {
+        ThreadPoolOptions options{};
+        options.setMaxNumberOfBlockingWorkers(16u);
+        options.setBlockingWorkerKeepAliveTime(1000u);
+
+        EXPECT_EQ(options.getMaxNumberOfBlockingWorkers(), 16u);
+        EXPECT_EQ(options.getBlockingWorkerKeepAliveTime(), 1000u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setReservedWorkers)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getNumberOfReservedWorkers(), 0u);
+    }
+
+    // Case with workers reserved for high priority
+    {
+        ThreadPoolOptions options{};
+        options.setReservedWorkers(2u, Priority::HIGH);
+
+        EXPECT_EQ(options.getNumberOfReservedWorkers(), 2u);
+        EXPECT_EQ(options.getReservedWorkersPriority(), Priority::HIGH);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setTenantWeight)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_TRUE(options.getTenantWeights().empty());
+    }
+
+    // Case with weights of several tenants
+    {
+        ThreadPoolOptions options{};
+        options.setSchedulerType(ThreadPoolOptions::SchedulerType::FAIR_SHARE);
+        options.setTenantWeight("billing", 3u);
+        options.setTenantWeight("search", 1u);
+
+        EXPECT_EQ(options.getSchedulerType(), ThreadPoolOptions::SchedulerType::FAIR_SHARE);
+        ASSERT_EQ(options.getTenantWeights().size(), 2u);
+        EXPECT_EQ(options.getTenantWeights().at("billing"), 3u);
+        EXPECT_EQ(options.getTenantWeights().at("search"), 1u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setQueueCapacity)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getQueueCapacity(), 0u);
+        EXPECT_EQ(options.getQueueOverflowPolicy(), ThreadPoolOptions::QueueOverflowPolicy::BLOCK);
+        EXPECT_EQ(options.getQueueBlockTimeout(), -1);
+    }
+
+    // Case with bounded queue dropping the oldest tasks
+    {
+        ThreadPoolOptions options{};
+        options.setQueueCapacity(1000u, ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST);
+        options.setQueueBlockTimeout(500000);
+
+        EXPECT_EQ(options.getQueueCapacity(), 1000u);
+        EXPECT_EQ(options.getQueueOverflowPolicy(), ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST);
+        EXPECT_EQ(options.getQueueBlockTimeout(), 500000);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setFlightRecorderCapacity)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getFlightRecorderCapacity(), 1024u);
+        EXPECT_TRUE(options.getTraceFilePath().empty());
+    }
+
+    // Case with disabled recorder and trace dumped at destruction
+    {
+        ThreadPoolOptions options{};
+        options.setFlightRecorderCapacity(0u);
+        options.setTraceFilePath("threadpool.trace.json");
+
+        EXPECT_EQ(options.getFlightRecorderCapacity(), 0u);
+        EXPECT_EQ(options.getTraceFilePath(), "threadpool.trace.json");
+    }
+}
+
+
+TEST_F(Foundations_ThreadPoolThreadPoolOptions_Happy, setMetricsExporter)
+{
+    // Case with default value
+    {
+        ThreadPoolOptions options{};
+
+        EXPECT_EQ(options.getMetricsExporter(), nullptr);
+        EXPECT_EQ(options.getMetricsExportPeriod(), 1000000u);
+    }
+
+    // Case with exporter to the file
+    {
+        std::shared_ptr<IMetricsExporter> metricsExporter = std::make_shared<PrometheusExporter>(std::string{ "threadpool.prom" });
+        ThreadPoolOptions options{};
+        options.setMetricsExporter(metricsExporter, 5000u);
+
+        EXPECT_EQ(options.getMetricsExporter(), metricsExporter);
+        EXPECT_EQ(options.getMetricsExportPeriod(), 5000u);
+    }
+}
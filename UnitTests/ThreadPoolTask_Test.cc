@@ -56,6 +56,32 @@ protected: // cancel
         EXPECT_EQ(task->getState(), IThreadPoolTask::State::CANCELED);
     }
 
+    void testSubmittedCancelation(ThreadPoolTask * const task)
+    {
+        const std::shared_ptr<uint32_t> resource = std::make_shared<uint32_t>(1u);
+        const std::weak_ptr<uint32_t> weakResource = resource;
+
+        std::future<uint32_t> future = task->submitOne([resource]{ return *resource; });
+
+        const Result result = task->cancel();
+
+        // Captures are released by cancelation, not by destruction of the task
+        EXPECT_EQ(result, Result::OK);
+        EXPECT_EQ(weakResource.use_count(), 1);
+        EXPECT_THROW(future.get(), std::future_error);
+    }
+
+    void testExecutedCancelation(ThreadPoolTask * const task)
+    {
+        task->submitOne([]{});
+        task->execute();
+
+        const Result result = task->cancel();
+
+        EXPECT_EQ(result, Result::ERROR);
+        EXPECT_EQ(task->getState(), IThreadPoolTask::State::EXECUTED);
+    }
+
     void testDoubleCancelation(IThreadPoolTask * const task)
     {
         testCancelation(task);
@@ -67,6 +93,37 @@ protected: // cancel
     }
 
 
+protected: // setCancellationToken, setDeadline
+
+    void testCancellationToken(IThreadPoolTask * const task)
+    {
+        CancellationSource cancellationSource;
+        const CancellationToken cancellationToken{ cancellationSource.getToken() };
+
+        EXPECT_FALSE(task->isCancellationRequested());
+
+        task->setCancellationToken(cancellationToken);
+        EXPECT_FALSE(task->isCancellationRequested());
+
+        cancellationSource.cancel();
+        EXPECT_TRUE(task->isCancellationRequested());
+        EXPECT_TRUE(cancellationToken.isCancellationRequested());
+
+        // Token doesn't cancel the task itself, the worker does it
+        EXPECT_NE(task->getState(), IThreadPoolTask::State::CANCELED);
+    }
+
+    void testDeadline(IThreadPoolTask * const task)
+    {
+        const uint64_t deadline{ OSAL::Time::getCurrentTime() + 1000u };
+
+        EXPECT_EQ(task->getDeadline(), 0u);
+
+        task->setDeadline(deadline);
+        EXPECT_EQ(task->getDeadline(), deadline);
+    }
+
+
 protected: // submitOne
 
     void testSubmission(ThreadPoolTask * const task)
@@ -176,18 +233,36 @@ TEST_F(Foundations_ThreadPoolPriorityTask_Unhappy, execute)
 TEST_F(Foundations_ThreadPoolPriorityTask_Happy, cancel)
 {
     // Case with single cancelation
-    PriorityTask task;
+    {
+        PriorityTask task;
 
-    testCancelation(&task);
+        testCancelation(&task);
+    }
+
+    // Case with submitted cancelation
+    {
+        PriorityTask task;
+
+        testSubmittedCancelation(&task);
+    }
 }
 
 
 TEST_F(Foundations_ThreadPoolPriorityTask_Unhappy, cancel)
 {
     // Case with double cancelation
-    PriorityTask task;
+    {
+        PriorityTask task;
+
+        testDoubleCancelation(&task);
+    }
 
-    testDoubleCancelation(&task);
+    // Case with executed cancelation
+    {
+        PriorityTask task;
+
+        testExecutedCancelation(&task);
+    }
 }
 
 
@@ -227,6 +302,24 @@ TEST_F(Foundations_ThreadPoolPriorityTask_Unhappy, submitOne)
 }
 
 
+TEST_F(Foundations_ThreadPoolPriorityTask_Happy, setCancellationToken)
+{
+    // Case with token canceled by its source
+    PriorityTask task;
+
+    testCancellationToken(&task);
+}
+
+
+TEST_F(Foundations_ThreadPoolPriorityTask_Happy, setDeadline)
+{
+    // Case with default and set deadline
+    PriorityTask task;
+
+    testDeadline(&task);
+}
+
+
 TEST_F(Foundations_ThreadPoolPriorityTask_Happy, getId)
 {
     PriorityTask task1;
@@ -275,18 +368,36 @@ TEST_F(Foundations_ThreadPoolBurstTimeTask_Unhappy, execute)
 TEST_F(Foundations_ThreadPoolBurstTimeTask_Happy, cancel)
 {
     // Case with single cancelation
-    BurstTimeTask task;
+    {
+        BurstTimeTask task;
+
+        testCancelation(&task);
+    }
+
+    // Case with submitted cancelation
+    {
+        BurstTimeTask task;
 
-    testCancelation(&task);
+        testSubmittedCancelation(&task);
+    }
 }
 
 
 TEST_F(Foundations_ThreadPoolBurstTimeTask_Unhappy, cancel)
 {
     // Case with double cancelation
-    BurstTimeTask task;
+    {
+        BurstTimeTask task;
+
+        testDoubleCancelation(&task);
+    }
+
+    // Case with executed cancelation
+    {
+        BurstTimeTask task;
 
-    testDoubleCancelation(&task);
+        testExecutedCancelation(&task);
+    }
 }
 
 
@@ -326,6 +437,24 @@ TEST_F(Foundations_ThreadPoolBurstTimeTask_Unhappy, submitOne)
 }
 
 
+TEST_F(Foundations_ThreadPoolBurstTimeTask_Happy, setCancellationToken)
+{
+    // Case with token canceled by its source
+    BurstTimeTask task;
+
+    testCancellationToken(&task);
+}
+
+
+TEST_F(Foundations_ThreadPoolBurstTimeTask_Happy, setDeadline)
+{
+    // Case with default and set deadline
+    BurstTimeTask task;
+
+    testDeadline(&task);
+}
+
+
 TEST_F(Foundations_ThreadPoolBurstTimeTask_Happy, getId)
 {
     BurstTimeTask task1;
@@ -1,6 +1,12 @@
 #include "gtest/gtest.h"
+#include <mutex>
+#include <sstream>
+#include <thread>
 #include "ThreadPoolTask.h"
 #include "ThreadPool.h"
+#include "BlockingRegion.h"
+#include "TenantTask.h"
+#include "PrometheusExporter.h"
 
 
 class TestTask : public ThreadPoolTask
@@ -1102,6 +1108,852 @@ TEST_F(Foundations_ThreadPool_Unhappy, waitAllTasksExecutionFinished)
 }
 
 
+TEST_F(Foundations_ThreadPool_Happy, getStatistic)
+{
+    // Case with executed and canceled tasks
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+        TasksContainer tasks{ getSubmittedTasks(4u, 1000u) };
+        tasks.front()->cancel();
+
+        threadPool->addTasks(tasks);
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.currentNumberOfAllWorkers, 2u);
+        EXPECT_EQ(statistic.totalNumberOfAddedTasks, 4u);
+        EXPECT_EQ(statistic.totalNumberOfExecutedTasks, 3u);
+        EXPECT_EQ(statistic.totalNumberOfNotExecutedTasks, 0u); // Canceled task is reclaimed by the scheduler, workers never get it
+        EXPECT_GT(statistic.uptimeInMicroseconds, 0u);
+        EXPECT_GT(statistic.executedTasksPerSecond, 0.0);
+    }
+
+    // Case with counters kept after workers decreased
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_1_3);
+
+        threadPool->addTasks(getSubmittedTasks(2u, 1000u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        threadPool->decreaseWorkers(1u);
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.currentNumberOfAllWorkers, 1u);
+        EXPECT_EQ(statistic.totalNumberOfExecutedTasks, 2u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, autoScale)
+{
+    // Case with workers scaled up by queue delay and retired after keep alive time
+    {
+        ThreadPoolOptions options{ 1u, 1u, 4u, false, false };
+        options.setQueueDelayToIncreaseWorkers(20000u);
+        options.setWorkerKeepAliveTime(100000u);
+        options.setWorkersScalingCooldown(10000u);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        threadPool->addTasks(getSubmittedTasks(8u, 100000u));
+
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the tasks wait in the queue
+
+        EXPECT_GT(threadPool->getStatistic().totalNumberOfScaledUpWorkers, 0u);
+        EXPECT_GT(threadPool->getWorkersSize(), 1u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(4u * inTestDelayInMicroseconds); // Let the workers stay idle longer than keep alive time
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_GT(statistic.totalNumberOfRetiredWorkers, 0u);
+        EXPECT_EQ(statistic.currentNumberOfAllWorkers, 1u);
+        EXPECT_EQ(statistic.totalNumberOfExecutedTasks, 8u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, affinityPolicy)
+{
+    // Case with workers pinned by every policy
+    for (auto && affinityPolicy : { ThreadPoolOptions::AffinityPolicy::COMPACT,
+                                    ThreadPoolOptions::AffinityPolicy::SCATTER,
+                                    ThreadPoolOptions::AffinityPolicy::PHYSICAL_CORES })
+    {
+        ThreadPoolOptions options{ options_2_1_3 };
+        options.setAffinityPolicy(affinityPolicy);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        threadPool->addTasks(getSubmittedTasks(4u, 1000u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfExecutedTasks, 4u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, numaAware)
+{
+    // Case with tasks hinted to the first node and tasks without hint
+    {
+        ThreadPoolOptions options{ options_2_1_3 };
+        options.setNumaAware();
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        TasksContainer tasks{ getSubmittedTasks(4u, 1000u) };
+        tasks[0]->setNumaNode(0);
+        tasks[1]->setNumaNode(0);
+
+        threadPool->addTasks(tasks);
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfExecutedTasks, 4u);
+    }
+
+    // Case with hinted task not dispatched behind long task on the same node
+    {
+        ThreadPoolOptions options{ options_1_1_3 };
+        options.setNumaAware();
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 2u);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        TasksContainer longTask{ getSubmittedTasks(1u, 3u * inTestDelayInMicroseconds) };
+        longTask[0]->setNumaNode(0);
+
+        threadPool->addTasks(longTask);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the watchdog report long task and add compensation worker
+
+        ASSERT_EQ(threadPool->getWorkersSize(), 2u);
+
+        TasksContainer tasks{ getSubmittedTasks(1u, inTestDelayInMicroseconds / 4u) };
+        tasks.push_back(getSubmittedTasks(1u, 0u).front());
+        tasks[0]->setNumaNode(0);
+        tasks[1]->setNumaNode(0);
+
+        threadPool->addTasks(tasks);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the compensation worker execute both tasks
+
+        EXPECT_EQ(tasks[0]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(tasks[1]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(longTask[0]->getState(), IThreadPoolTask::State::IN_EXECUTION);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, blockingWorkers)
+{
+    // Case with blocking tasks executed by the blocking workers, while ordinary worker stays free
+    {
+        ThreadPoolOptions options{ options_1_1_1 };
+        options.setMaxNumberOfBlockingWorkers(4u);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        TasksContainer blockingTasks{ getSubmittedTasks(4u, 2u * inTestDelayInMicroseconds) };
+        for (auto && taskIt : blockingTasks)
+        {
+            taskIt->setBlocking(true);
+        }
+
+        threadPool->addTasks(blockingTasks);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the blocking workers get tasks for execution
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.currentNumberOfBlockingWorkers, 4u);
+        EXPECT_EQ(statistic.currentNumberOfAllWorkers, 5u);
+        EXPECT_EQ(threadPool->getWorkersSize(), 1u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with blocking region compensated by additional worker
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_1_1_1);
+        const uint32_t inTestDelay{ inTestDelayInMicroseconds };
+
+        threadPool->addTasks(ThreadPoolTask::submitRepeated(1u, [inTestDelay] {
+            BlockingRegion blockingRegion{};
+            OSAL::Thread::delay(2u * inTestDelay);
+            return blockingRegion.isCompensated();
+            }));
+
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the thread pool compensate blocked worker
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.numberOfWorkersInBlockingRegion, 1u);
+        EXPECT_EQ(threadPool->getWorkersSize(), 2u);
+
+        OSAL::Thread::delay(3u * inTestDelayInMicroseconds); // Let the task leave blocking region and thread pool remove compensation worker
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 1u);
+    }
+
+    // Case with blocking region outside of thread pool
+    {
+        BlockingRegion blockingRegion{};
+
+        EXPECT_FALSE(blockingRegion.isCompensated());
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, reservedWorkers)
+{
+    // Case with high priority task executed by reserved worker while normal tasks occupy other workers
+    {
+        ThreadPoolOptions options{ ThreadPoolOptions::SchedulerType::PRIORITY, 2u, 2u, 2u };
+        options.setReservedWorkers(1u, Priority::HIGH);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        TasksContainer normalTasks;
+        for (uint32_t i = 0u; i < 4u; ++i)
+        {
+            auto task = std::make_shared<PriorityTask>(Priority::NORMAL);
+            task->submitOne([this] { OSAL::Thread::delay(inTestDelayInMicroseconds); });
+            normalTasks.push_back(task);
+        }
+
+        threadPool->addTasks(normalTasks);
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the workers get tasks for execution
+
+        auto highTask = std::make_shared<PriorityTask>(Priority::HIGH);
+        auto highTaskFuture = highTask->submitOne([] { return true; });
+        threadPool->addTask(highTask);
+
+        // High priority task doesn't wait for the burst of normal tasks (4 x delay on one worker)
+        EXPECT_EQ(highTaskFuture.wait_for(std::chrono::microseconds(inTestDelayInMicroseconds)), std::future_status::ready);
+
+        // Reserved worker publishes its waiting state after the future is ready
+        OSAL::Timeout stateTimeout{ inTestDelayInMicroseconds };
+        while (threadPool->getStatistic().numberOfWorkersInRunningState != 1u && stateTimeout.getRemainingTime() != 0)
+        {
+            std::this_thread::yield();
+        }
+
+        EXPECT_EQ(threadPool->getStatistic().numberOfWorkersInRunningState, 1u);
+        EXPECT_EQ(threadPool->getStatistic().numberOfWorkersInWaitingState, 1u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with the only ordinary worker executing long task
+    {
+        ThreadPoolOptions options{ ThreadPoolOptions::SchedulerType::PRIORITY, 2u, 2u, 2u };
+        options.setReservedWorkers(1u, Priority::HIGH);
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 10u, nullptr, false);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        auto longTask = std::make_shared<PriorityTask>(Priority::NORMAL);
+        longTask->submitOne([this] { OSAL::Thread::delay(2u * inTestDelayInMicroseconds); });
+        threadPool->addTask(longTask);
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 2u); // Let the watchdog notice the long task
+
+        auto normalTask = std::make_shared<PriorityTask>(Priority::NORMAL);
+        normalTask->submitOne([] {});
+        threadPool->addTask(normalTask);
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 2u);
+
+        // Normal task waits behind the long one instead of occupying reserved worker
+        EXPECT_EQ(normalTask->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_EQ(threadPool->getStatistic().numberOfWorkersInRunningState, 1u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, fairShare)
+{
+    // Case with flooding tenant sharing one worker with another tenant
+    {
+        ThreadPoolOptions options{ ThreadPoolOptions::SchedulerType::FAIR_SHARE, 1u, 1u, 1u };
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        auto busyTask = std::make_shared<TenantTask>();
+        busyTask->submitOne([this] { OSAL::Thread::delay(inTestDelayInMicroseconds); });
+        threadPool->addTask(busyTask);
+
+        std::mutex tenantsOrderMutex;
+        std::string tenantsOrder;
+
+        TasksContainer tenantTasks;
+        for (auto && tenant : { "a", "a", "a", "a", "b", "b" })
+        {
+            auto task = std::make_shared<TenantTask>(tenant);
+            task->submitOne([&tenantsOrderMutex, &tenantsOrder, tenant]
+                            {
+                                std::lock_guard<std::mutex> lock{ tenantsOrderMutex };
+                                tenantsOrder += tenant;
+                            });
+            tenantTasks.push_back(task);
+        }
+
+        threadPool->addTasks(tenantTasks);
+        threadPool->waitAllTasksExecutionFinished(-1);
+
+        EXPECT_EQ(tenantsOrder, "ababaa");
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, queueCapacity)
+{
+    const std::vector<ThreadPoolOptions::QueueOverflowPolicy> policies{ ThreadPoolOptions::QueueOverflowPolicy::REJECT,
+                                                                        ThreadPoolOptions::QueueOverflowPolicy::CALLER_RUNS,
+                                                                        ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST,
+                                                                        ThreadPoolOptions::QueueOverflowPolicy::BLOCK };
+
+    for (auto && policy : policies)
+    {
+        ThreadPoolOptions options{ 1u, 1u, 1u };
+        options.setQueueCapacity(2u, policy);
+        options.setQueueBlockTimeout(static_cast<int64_t>(inTestDelayInMicroseconds / 10u));
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        // Busy task is taken for execution, so it doesn't occupy the queue
+        threadPool->addTasks(getSubmittedTasks(1u, inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker get task for execution
+
+        TasksContainer queuedTasks{ getSubmittedTasks(2u, 0u) };
+        EXPECT_EQ(threadPool->addTask(queuedTasks[0]), Result::OK);
+        EXPECT_EQ(threadPool->addTask(queuedTasks[1]), Result::OK);
+
+        auto overflowTask = std::make_shared<ThreadPoolTask>();
+        auto overflowTaskFuture = overflowTask->submitOne([] { return std::this_thread::get_id(); });
+        const Result result{ threadPool->addTask(overflowTask) };
+
+        switch (policy)
+        {
+            case ThreadPoolOptions::QueueOverflowPolicy::REJECT:
+                EXPECT_EQ(result, Result::ERROR);
+                EXPECT_EQ(overflowTask->getState(), IThreadPoolTask::State::SUBMITTED);
+                break;
+
+            case ThreadPoolOptions::QueueOverflowPolicy::CALLER_RUNS:
+                EXPECT_EQ(result, Result::OK);
+                ASSERT_EQ(overflowTaskFuture.wait_for(std::chrono::microseconds(0)), std::future_status::ready);
+                EXPECT_EQ(overflowTaskFuture.get(), std::this_thread::get_id());
+                break;
+
+            case ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST:
+                EXPECT_EQ(result, Result::OK);
+                EXPECT_EQ(queuedTasks[0]->getState(), IThreadPoolTask::State::CANCELED);
+                break;
+
+            case ThreadPoolOptions::QueueOverflowPolicy::BLOCK:
+                EXPECT_EQ(result, Result::TIMEOUT);
+                break;
+
+            default:
+                break;
+        }
+
+        // Task executed by the caller isn't rejected
+        const bool isCallerRuns{ ThreadPoolOptions::QueueOverflowPolicy::CALLER_RUNS == policy };
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfRejectedTasks, isCallerRuns ? 0u : 1u);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfCallerRunsTasks, isCallerRuns ? 1u : 0u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with producer blocked until capacity is freed
+    {
+        ThreadPoolOptions options{ 1u, 1u, 1u };
+        options.setQueueCapacity(1u, ThreadPoolOptions::QueueOverflowPolicy::BLOCK);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker get task for execution
+        threadPool->addTasks(getSubmittedTasks(1u, 0u));
+
+        OSAL::Time time;
+        EXPECT_EQ(threadPool->addTask(getSubmittedTasks(1u, 0u).front()), Result::OK);
+        EXPECT_GT(time.getElapsedTime(), static_cast<uint64_t>(inTestDelayInMicroseconds / 2u));
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfRejectedTasks, 0u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with places of cleared and removed tasks given back
+    for (auto && policy : policies)
+    {
+        ThreadPoolOptions options{ 1u, 1u, 1u };
+        options.setQueueCapacity(2u, policy);
+        options.setQueueBlockTimeout(static_cast<int64_t>(inTestDelayInMicroseconds / 10u));
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker get task for execution
+
+        threadPool->addTasks(getSubmittedTasks(2u, 0u));
+        threadPool->clearAllTasks(true);
+
+        TasksContainer tasks{ getSubmittedTasks(2u, 0u) };
+        EXPECT_EQ(threadPool->addTask(tasks[0]), Result::OK);
+        EXPECT_EQ(threadPool->addTask(tasks[1]), Result::OK);
+        EXPECT_EQ(tasks[0]->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_EQ(tasks[1]->getState(), IThreadPoolTask::State::SUBMITTED);
+
+        threadPool->removeAllTasks(true);
+
+        tasks = getSubmittedTasks(2u, 0u);
+        EXPECT_EQ(threadPool->addTask(tasks[0]), Result::OK);
+        EXPECT_EQ(threadPool->addTask(tasks[1]), Result::OK);
+        EXPECT_EQ(tasks[0]->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_EQ(tasks[1]->getState(), IThreadPoolTask::State::SUBMITTED);
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+        EXPECT_EQ(statistic.totalNumberOfRejectedTasks, 0u);
+        EXPECT_EQ(statistic.totalNumberOfCallerRunsTasks, 0u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with dropped task, which has no place in the queue, so the next oldest task is dropped too
+    {
+        ThreadPoolOptions options{ 1u, 1u, 1u };
+        options.setQueueCapacity(2u, ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker get task for execution
+
+        TasksContainer workerTasks{ getSubmittedTasks(1u, 0u) };
+        threadPool->addTaskToEveryWorker(workerTasks);
+        OSAL::Thread::delay(1000u); // Let the queued tasks be added later than the worker task
+
+        TasksContainer queuedTasks{ getSubmittedTasks(2u, 0u) };
+        EXPECT_EQ(threadPool->addTask(queuedTasks[0]), Result::OK);
+        EXPECT_EQ(threadPool->addTask(queuedTasks[1]), Result::OK);
+
+        TasksContainer overflowTasks{ getSubmittedTasks(1u, 0u) };
+        EXPECT_EQ(threadPool->addTask(overflowTasks[0]), Result::OK);
+
+        EXPECT_EQ(workerTasks[0]->getState(), IThreadPoolTask::State::CANCELED);
+        EXPECT_EQ(queuedTasks[0]->getState(), IThreadPoolTask::State::CANCELED);
+        EXPECT_EQ(queuedTasks[1]->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_EQ(overflowTasks[0]->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfRejectedTasks, 2u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+
+    // Case with concurrent producers, which never exceed the capacity together
+    {
+        const uint32_t queueCapacity{ 4u };
+        const uint32_t numberOfProducers{ 4u };
+
+        ThreadPoolOptions options{ 1u, 1u, 1u };
+        options.setQueueCapacity(queueCapacity, ThreadPoolOptions::QueueOverflowPolicy::REJECT);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker get task for execution
+
+        std::atomic<uint32_t> numberOfAddedTasks{ 0u };
+        std::vector<std::thread> producers;
+
+        for (uint32_t i = 0u; i < numberOfProducers; ++i)
+        {
+            producers.emplace_back([this, &threadPool, &numberOfAddedTasks, queueCapacity]
+                                   {
+                                       for (auto && taskIt : getSubmittedTasks(queueCapacity, 0u))
+                                       {
+                                           if (threadPool->addTask(taskIt) == Result::OK)
+                                           {
+                                               ++numberOfAddedTasks;
+                                           }
+                                       }
+                                   });
+        }
+
+        for (auto && producer : producers)
+        {
+            producer.join();
+        }
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(numberOfAddedTasks.load(), queueCapacity);
+        EXPECT_EQ(statistic.totalNumberOfRejectedTasks, (numberOfProducers - 1u) * queueCapacity);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, latencyStatistic)
+{
+    // Case with tasks waiting behind each other on one worker
+    {
+        ThreadPoolOptions options{ ThreadPoolOptions::SchedulerType::PRIORITY, 1u, 1u, 1u };
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        const uint32_t inTaskDelayInMicroseconds{ inTestDelayInMicroseconds / 10u };
+
+        TasksContainer tasks;
+        for (uint32_t i = 0u; i < 3u; ++i)
+        {
+            auto task = std::make_shared<PriorityTask>(Priority::LOW);
+            task->submitOne([inTaskDelayInMicroseconds] { OSAL::Thread::delay(inTaskDelayInMicroseconds); });
+            tasks.push_back(task);
+        }
+
+        threadPool->addTasks(tasks);
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the worker publish statistic of the last task
+
+        const IThreadPool::LatencyStatistic latencyStatistic{ threadPool->getLatencyStatistic() };
+        const LatencyHistogram::Snapshot & executionTime{ latencyStatistic.executionTime[Priority::LOW] };
+        const LatencyHistogram::Snapshot & queueWaitTime{ latencyStatistic.queueWaitTime[Priority::LOW] };
+
+        EXPECT_EQ(executionTime.getCount(), 3u);
+        EXPECT_GE(executionTime.getPercentile(0.0), static_cast<uint64_t>(inTaskDelayInMicroseconds) * 15u / 16u);
+        EXPECT_EQ(queueWaitTime.getCount(), 3u);
+        EXPECT_GE(queueWaitTime.getPercentile(100.0), static_cast<uint64_t>(inTaskDelayInMicroseconds) * 15u / 8u);
+        EXPECT_EQ(latencyStatistic.executionTime[Priority::HIGH].getCount(), 0u);
+        EXPECT_EQ(latencyStatistic.getTotalExecutionTime().getCount(), 3u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, dumpTrace)
+{
+    // Case with executed tasks on the timeline of workers
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+
+        TasksContainer tasks{ getSubmittedTasks(2u, inTestDelayInMicroseconds / 10u) };
+        threadPool->addTasks(tasks);
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers record end of the last task
+
+        std::stringstream trace;
+        EXPECT_EQ(threadPool->dumpTrace(trace), Result::OK);
+
+        for (auto && task : tasks)
+        {
+            EXPECT_NE(trace.str().find("\"name\":\"task " + std::to_string(task->getId()) + "\",\"cat\":\"task\",\"ph\":\"X\""), std::string::npos);
+        }
+
+        EXPECT_NE(trace.str().find("\"name\":\"submit\""), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"dispatch\""), std::string::npos);
+        EXPECT_NE(trace.str().find("\"name\":\"idle\""), std::string::npos);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Unhappy, dumpTrace)
+{
+    // Case with disabled flight recorder
+    {
+        ThreadPoolOptions options{ options_2_2_2 };
+        options.setFlightRecorderCapacity(0u);
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(2u, 0u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+
+        std::stringstream trace;
+        EXPECT_EQ(threadPool->dumpTrace(trace), Result::OK);
+        EXPECT_EQ(trace.str().find("\"name\":\"submit\""), std::string::npos);
+    }
+
+    // Case with not existing directory of the trace file
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+
+        EXPECT_EQ(threadPool->dumpTrace(std::string{ "/not/existing/directory/trace.json" }), Result::ERROR);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, getQueuesStatistic)
+{
+    // Case with thread pool queue and queues of the workers
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+
+        threadPool->addTasks(getSubmittedTasks(2u, 0u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+
+        const std::vector<IThreadPool::QueueStatistic> queuesStatistic{ threadPool->getQueuesStatistic() };
+
+        ASSERT_EQ(queuesStatistic.size(), 3u);
+        EXPECT_FALSE(queuesStatistic[0].isWorkerQueue);
+        EXPECT_EQ(queuesStatistic[0].schedulerStatistic.totalNumberOfScheduledTasks, 2u);
+        EXPECT_TRUE(queuesStatistic[1].isWorkerQueue);
+        EXPECT_NE(queuesStatistic[1].workerSlot, queuesStatistic[2].workerSlot);
+        EXPECT_EQ(queuesStatistic[1].schedulerStatistic.totalNumberOfGotForExecutionTasks
+                  + queuesStatistic[2].schedulerStatistic.totalNumberOfGotForExecutionTasks, 2u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, getWorkersStatistic)
+{
+    // Case with busy time of delayed tasks
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+
+        threadPool->addTasks(getSubmittedTasks(4u, 20000u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        const std::vector<IThreadPool::WorkerStatistic> workersStatistic{ threadPool->getWorkersStatistic() };
+
+        ASSERT_EQ(workersStatistic.size(), 2u);
+        EXPECT_NE(workersStatistic[0].slot, workersStatistic[1].slot);
+        EXPECT_GE(workersStatistic[0].busyTime + workersStatistic[1].busyTime, 4u * 20000u);
+
+        for (auto && workerStatistic : workersStatistic)
+        {
+            EXPECT_LE(workerStatistic.busyTime + workerStatistic.idleTime, workerStatistic.lifetime);
+            EXPECT_LE(workerStatistic.cpuTime, workerStatistic.lifetime);
+            EXPECT_GE(workerStatistic.utilization, 0.0);
+            EXPECT_LE(workerStatistic.utilization, 1.0);
+        }
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.totalWorkersBusyTimeInMicroseconds, workersStatistic[0].busyTime + workersStatistic[1].busyTime);
+        EXPECT_GT(statistic.workersUtilization, 0.0);
+        EXPECT_LE(statistic.workersUtilization, 1.0);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, expiredTasks)
+{
+    // Case with canceled token and passed deadline
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_1_1_1_postpone);
+        CancellationSource cancellationSource;
+        TasksContainer tasks{ getSubmittedTasks(4u, 0u) };
+
+        tasks[0]->setCancellationToken(cancellationSource.getToken());
+        tasks[1]->setCancellationToken(cancellationSource.getToken());
+        tasks[2]->setDeadline(OSAL::Time::getCurrentTime());
+        tasks[3]->setDeadline(OSAL::Time::getCurrentTime() + 60000000u);
+
+        threadPool->addTasks(tasks);
+        cancellationSource.cancel();
+        OSAL::Thread::delay(1000u); // Let the deadline pass
+
+        threadPool->startExecution();
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the workers finish last task execution
+
+        const IThreadPool::Statistic statistic{ threadPool->getStatistic() };
+
+        EXPECT_EQ(statistic.totalNumberOfExecutedTasks, 1u);
+        EXPECT_EQ(statistic.totalNumberOfNotExecutedTasks, 3u);
+        EXPECT_EQ(statistic.totalNumberOfExpiredTasks, 3u);
+        EXPECT_EQ(tasks[0]->getState(), IThreadPoolTask::State::CANCELED);
+        EXPECT_EQ(tasks[2]->getState(), IThreadPoolTask::State::CANCELED);
+        EXPECT_EQ(tasks[3]->getState(), IThreadPoolTask::State::EXECUTED);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, longTaskWatchdog)
+{
+    // Case with long task reported once and compensated, so queued tasks keep draining
+    {
+        std::mutex longTasksMutex;
+        std::vector<std::pair<uint64_t, uint64_t>> longTasks;
+
+        ThreadPoolOptions options{ options_1_1_3 };
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 5u, [&longTasksMutex, &longTasks](const uint64_t taskId, const uint64_t duration) {
+            std::lock_guard<std::mutex> lock{ longTasksMutex };
+            longTasks.emplace_back(taskId, duration);
+            });
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+        TasksContainer longTask{ getSubmittedTasks(1u, 3u * inTestDelayInMicroseconds) };
+
+        TasksContainer shortTasks{ getSubmittedTasks(2u, 0u) };
+
+        threadPool->addTasks(longTask);
+        threadPool->addTasks(shortTasks);
+
+        // Tasks queued behind the long one are requeued, waiting must not miss them
+        EXPECT_EQ(threadPool->waitAllTasksExecutionFinished(inTestDelayInMicroseconds), Result::OK);
+        EXPECT_NE(shortTasks[0]->getState(), IThreadPoolTask::State::SUBMITTED);
+        EXPECT_NE(shortTasks[1]->getState(), IThreadPoolTask::State::SUBMITTED);
+
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 2u); // Let the compensation worker finish queued tasks
+
+        TasksContainer lateTasks{ getSubmittedTasks(2u, 0u) };
+        threadPool->addTasks(lateTasks);
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 2u); // Let the compensation worker execute late tasks
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 2u);
+        EXPECT_EQ(shortTasks[0]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(shortTasks[1]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(lateTasks[0]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(lateTasks[1]->getState(), IThreadPoolTask::State::EXECUTED);
+        EXPECT_EQ(longTask[0]->getState(), IThreadPoolTask::State::IN_EXECUTION);
+
+        {
+            std::lock_guard<std::mutex> lock{ longTasksMutex };
+
+            ASSERT_EQ(longTasks.size(), 1u);
+            EXPECT_EQ(longTasks[0].first, longTask[0]->getId());
+            EXPECT_GE(longTasks[0].second, inTestDelayInMicroseconds / 5u);
+        }
+
+        OSAL::Thread::delay(2u * inTestDelayInMicroseconds); // Let the long task finish and thread pool remove compensation worker
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 1u);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfLongTasks, 1u);
+    }
+
+    // Case with more long tasks than max number of workers
+    {
+        ThreadPoolOptions options{ options_1_1_3 };
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 10u);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(4u, 2u * inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the watchdog compensate every stuck worker it's allowed to
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 3u);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfLongTasks, 3u);
+    }
+
+    // Case with max number of workers reached already
+    {
+        ThreadPoolOptions options{ options_1_1_1 };
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 5u);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, 2u * inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds);
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 1u);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfLongTasks, 1u);
+    }
+
+    // Case with long task only reported
+    {
+        ThreadPoolOptions options{ options_1_1_1 };
+        options.setLongTaskWatchdog(inTestDelayInMicroseconds / 5u, nullptr, false);
+
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(1u, 2u * inTestDelayInMicroseconds));
+        OSAL::Thread::delay(inTestDelayInMicroseconds);
+
+        EXPECT_EQ(threadPool->getWorkersSize(), 1u);
+        EXPECT_EQ(threadPool->getStatistic().totalNumberOfLongTasks, 1u);
+
+        threadPool->waitAllTasksExecutionFinished(-1);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Happy, exportMetrics)
+{
+    // Case with metrics rendered periodically by metrics export thread
+    {
+        std::mutex metricsMutex;
+        std::string latestMetrics;
+
+        ThreadPoolOptions options{ options_2_2_2 };
+        options.setMetricsExporter(std::make_shared<PrometheusExporter>([&metricsMutex, &latestMetrics](const std::string & metrics)
+                                                                        {
+                                                                            std::lock_guard<std::mutex> lock{ metricsMutex };
+                                                                            latestMetrics = metrics;
+                                                                        }), 1000u);
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        threadPool->addTasks(getSubmittedTasks(2u, 0u));
+        threadPool->waitAllTasksExecutionFinished(-1);
+        OSAL::Thread::delay(inTestDelayInMicroseconds); // Let the metrics export thread export metrics after execution
+
+        const std::string pool{ "pool=\"" + std::to_string(threadPool->getId()) + "\"" };
+
+        std::lock_guard<std::mutex> lock{ metricsMutex };
+        EXPECT_NE(latestMetrics.find("# TYPE threadpool_tasks_executed_total counter"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_tasks_executed_total{" + pool + "} 2\n"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_workers{" + pool + ",state=\"waiting\"} 2\n"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_queue_tasks{" + pool + ",queue=\"pool\"} 0\n"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_task_execution_seconds_bucket{" + pool + ",bucket=\"0\",le=\"+Inf\"} 2\n"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_task_execution_seconds_bucket{" + pool + ",bucket=\"0\",le=\"5.1e-05\"} "), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_task_execution_seconds_count{" + pool + ",bucket=\"0\"} 2\n"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("# TYPE threadpool_workers_busy_seconds_total counter"), std::string::npos);
+        EXPECT_NE(latestMetrics.find("threadpool_worker_utilization{" + pool + ",worker=\"worker\",slot=\""), std::string::npos);
+    }
+
+    // Case with slow exporter, which doesn't delay tasks dispatching
+    {
+        class SlowMetricsExporter : public IMetricsExporter
+        {
+        public:
+
+            explicit SlowMetricsExporter(const uint64_t delay) : delay_{ delay }, numberOfExports_{ 0u } { }
+
+            Result exportMetrics(const IThreadPool &) override
+            {
+                ++numberOfExports_;
+                OSAL::Thread::delay(delay_);
+                return Result::OK;
+            }
+
+            uint32_t getNumberOfExports() const { return numberOfExports_.load(); }
+
+        private:
+
+            uint64_t delay_;
+            std::atomic<uint32_t> numberOfExports_;
+        };
+
+        auto metricsExporter = std::make_shared<SlowMetricsExporter>(2u * inTestDelayInMicroseconds);
+
+        ThreadPoolOptions options{ options_2_2_2 };
+        options.setMetricsExporter(metricsExporter, 1000u);
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options);
+
+        OSAL::Thread::delay(inTestDelayInMicroseconds / 10u); // Let the metrics export thread start slow export
+
+        TasksContainer tasks{ getSubmittedTasks(2u, 0u) };
+        threadPool->addTasks(tasks);
+
+        EXPECT_EQ(threadPool->waitAllTasksExecutionFinished(inTestDelayInMicroseconds), Result::OK);
+        EXPECT_EQ(metricsExporter->getNumberOfExports(), 1u);
+    }
+}
+
+
+TEST_F(Foundations_ThreadPool_Unhappy, exportMetrics)
+{
+    // Case with not existing directory of the metrics file
+    {
+        std::shared_ptr<IThreadPool> threadPool = std::make_shared<ThreadPool>(options_2_2_2);
+        PrometheusExporter prometheusExporter{ std::string{ "/not/existing/directory/threadpool.prom" } };
+
+        EXPECT_EQ(prometheusExporter.exportMetrics(*threadPool), Result::ERROR);
+    }
+}
+
+
 //! loadBalancing is not an available function but mechanism build on top of workers and tasks in thread pool
 TEST_F(Foundations_ThreadPool_Happy, DISABLED_loadBalancing)
 {
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include "BenchmarkCommon.h"
+#include "BurstTimeTask.h"
+#include "FairShareTaskScheduler.h"
+#include "FirstComeFirstServedTaskScheduler.h"
+#include "PriorityTask.h"
+#include "PriorityTaskScheduler.h"
+#include "ShortestJobFirstTaskScheduler.h"
+#include "TenantTask.h"
+
+
+namespace
+{
+    //! Per thread, so counting doesn't add shared writes to the benchmarks with several threads
+    thread_local uint64_t numberOfAllocations{ 0u };
+} // namespace
+
+
+void * operator new(std::size_t size)
+{
+    ++numberOfAllocations;
+
+    void * memory{ std::malloc(size != 0u ? size : 1u) };
+    if (nullptr == memory)
+    {
+        throw std::bad_alloc{};
+    }
+
+    return memory;
+}
+
+
+void operator delete(void * memory) noexcept
+{
+    std::free(memory);
+}
+
+
+void operator delete(void * memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+
+uint64_t Benchmark::getNumberOfAllocations()
+{
+    return numberOfAllocations;
+}
+
+
+std::shared_ptr<IThreadPoolTask> Benchmark::getSubmittedTask(const ThreadPoolOptions::SchedulerType schedulerType,
+                                                             const uint64_t index,
+                                                             const std::function<void()> & function)
+{
+    static const Priority priorities[]{ Priority::HIGH, Priority::NORMAL, Priority::LOW };
+    static const BurstTime burstTimes[]{ BurstTime::SHORT, BurstTime::MEDIUM, BurstTime::LONG };
+    static const std::string tenants[]{ "first", "second", "third" };
+
+    switch (schedulerType)
+    {
+        case ThreadPoolOptions::SchedulerType::PRIORITY:
+        {
+            auto task = std::make_shared<PriorityTask>(priorities[index % 3u]);
+            task->submitOne(function);
+            return task;
+        }
+
+        case ThreadPoolOptions::SchedulerType::SJF:
+        {
+            auto task = std::make_shared<BurstTimeTask>(burstTimes[index % 3u]);
+            task->submitOne(function);
+            return task;
+        }
+
+        case ThreadPoolOptions::SchedulerType::FAIR_SHARE:
+        {
+            auto task = std::make_shared<TenantTask>(tenants[index % 3u]);
+            task->submitOne(function);
+            return task;
+        }
+
+        case ThreadPoolOptions::SchedulerType::FCFS:
+        default:
+        {
+            auto task = std::make_shared<ThreadPoolTask>();
+            task->submitOne(function);
+            return task;
+        }
+    }
+}
+
+
+std::unique_ptr<ITaskScheduler> Benchmark::getNewTaskScheduler(const ThreadPoolOptions::SchedulerType schedulerType)
+{
+    switch (schedulerType)
+    {
+        case ThreadPoolOptions::SchedulerType::PRIORITY:    return std::unique_ptr<ITaskScheduler>{ new PriorityTaskScheduler{} };
+        case ThreadPoolOptions::SchedulerType::SJF:         return std::unique_ptr<ITaskScheduler>{ new ShortestJobFirstTaskScheduler{} };
+        case ThreadPoolOptions::SchedulerType::FAIR_SHARE:  return std::unique_ptr<ITaskScheduler>{ new FairShareTaskScheduler{} };
+        case ThreadPoolOptions::SchedulerType::FCFS:
+        default:                                            return std::unique_ptr<ITaskScheduler>{ new FirstComeFirstServedTaskScheduler{} };
+    }
+}
+
+
+ThreadPoolOptions::SchedulerType Benchmark::getSchedulerType(const int64_t argument)
+{
+    return argument >= 0 && argument < static_cast<int64_t>(ThreadPoolOptions::SchedulerType::UNDEFINED)
+           ? static_cast<ThreadPoolOptions::SchedulerType>(argument) : ThreadPoolOptions::SchedulerType::FCFS;
+}
+
+
+uint64_t Benchmark::getCurrentTime()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
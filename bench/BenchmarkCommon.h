@@ -0,0 +1,42 @@
+#ifndef _BENCHMARKCOMMON_H_
+#define _BENCHMARKCOMMON_H_
+
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "ITaskScheduler.h"
+#include "ThreadPoolOptions.h"
+
+
+namespace Benchmark
+{
+    /**
+     * @brief Number of heap allocations made by the calling thread, global operator new is replaced in the benchmarks binary.
+     */
+    uint64_t getNumberOfAllocations();
+
+    /**
+     * @return Task of the type, which is ordered by the scheduler, e.g. PriorityTask for SchedulerType::PRIORITY.
+     *         Priority, burst time and tenant are spread by the index.
+     */
+    std::shared_ptr<IThreadPoolTask> getSubmittedTask(const ThreadPoolOptions::SchedulerType schedulerType,
+                                                      const uint64_t index,
+                                                      const std::function<void()> & function);
+
+    std::unique_ptr<ITaskScheduler> getNewTaskScheduler(const ThreadPoolOptions::SchedulerType schedulerType);
+
+    /**
+     * @brief Benchmark argument of the scheduler type.
+     */
+    ThreadPoolOptions::SchedulerType getSchedulerType(const int64_t argument);
+
+    /**
+     * @return Steady clock nanoseconds, used where the benchmark measures time between two threads.
+     */
+    uint64_t getCurrentTime();
+} // Benchmark namespace
+
+
+#endif // _BENCHMARKCOMMON_H_
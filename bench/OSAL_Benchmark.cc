@@ -0,0 +1,115 @@
+#include <atomic>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "OSAL.h"
+
+
+static void BM_OSAL_Mutex_LockUnlock(benchmark::State & state)
+{
+    static OSAL::Mutex mutex;
+
+    for (auto _ : state)
+    {
+        mutex.lock();
+        mutex.unlock();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_OSAL_Mutex_LockUnlock)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+
+
+//! Turn is passed between two threads, which poll it under the mutex
+static void BM_OSAL_Mutex_PingPong(benchmark::State & state)
+{
+    OSAL::Mutex mutex;
+    uint64_t turn{ 0u };
+    std::atomic<bool> isFinished{ false };
+
+    std::thread partner{ [&]
+                         {
+                             while (!isFinished.load(std::memory_order_relaxed))
+                             {
+                                 mutex.lock();
+                                 if (1u == turn)
+                                 {
+                                     turn = 0u;
+                                 }
+                                 mutex.unlock();
+                             }
+                         } };
+
+    for (auto _ : state)
+    {
+        mutex.lock();
+        turn = 1u;
+        mutex.unlock();
+
+        bool isReturned{ false };
+        while (!isReturned)
+        {
+            mutex.lock();
+            isReturned = (0u == turn);
+            mutex.unlock();
+        }
+    }
+
+    isFinished.store(true, std::memory_order_relaxed);
+    partner.join();
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2u));
+}
+
+BENCHMARK(BM_OSAL_Mutex_PingPong)->UseRealTime();
+
+
+//! Turn is passed between two threads, which sleep on the monitor till it's their turn
+static void BM_OSAL_Monitor_PingPong(benchmark::State & state)
+{
+    OSAL::Monitor monitor;
+    uint64_t turn{ 0u };
+    bool isFinished{ false };
+
+    std::thread partner{ [&]
+                         {
+                             monitor.lock();
+                             while (!isFinished)
+                             {
+                                 if (1u == turn)
+                                 {
+                                     turn = 0u;
+                                     monitor.notifyAll();
+                                 }
+                                 else
+                                 {
+                                     monitor.wait();
+                                 }
+                             }
+                             monitor.unlock();
+                         } };
+
+    for (auto _ : state)
+    {
+        monitor.lock();
+        turn = 1u;
+        monitor.notifyAll();
+
+        while (turn != 0u)
+        {
+            monitor.wait();
+        }
+        monitor.unlock();
+    }
+
+    monitor.lock();
+    isFinished = true;
+    monitor.notifyAll();
+    monitor.unlock();
+    partner.join();
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2u));
+}
+
+BENCHMARK(BM_OSAL_Monitor_PingPong)->UseRealTime();
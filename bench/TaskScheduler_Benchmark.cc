@@ -0,0 +1,154 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "BenchmarkCommon.h"
+
+
+namespace
+{
+    const uint64_t NUMBER_OF_TASKS_PER_PRODUCER{ 2000u };
+
+    void waitStart(const std::atomic<bool> & isStarted)
+    {
+        while (!isStarted.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+    }
+} // namespace
+
+
+//! Arguments: scheduler type, number of producers, number of consumers
+static void BM_TaskScheduler_ScheduleGetTaskForExecution(benchmark::State & state)
+{
+    const ThreadPoolOptions::SchedulerType schedulerType{ Benchmark::getSchedulerType(state.range(0)) };
+    const uint64_t numberOfProducers{ static_cast<uint64_t>(state.range(1)) };
+    const uint64_t numberOfConsumers{ static_cast<uint64_t>(state.range(2)) };
+    const uint64_t numberOfTasks{ numberOfProducers * NUMBER_OF_TASKS_PER_PRODUCER };
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<ITaskScheduler> taskScheduler{ Benchmark::getNewTaskScheduler(schedulerType) };
+
+        // Tasks are created before the measurement, so only scheduling and taking for execution is measured
+        std::vector<std::vector<std::shared_ptr<IThreadPoolTask>>> producersTasks(numberOfProducers);
+        for (uint64_t producer = 0u; producer < numberOfProducers; ++producer)
+        {
+            for (uint64_t i = 0u; i < NUMBER_OF_TASKS_PER_PRODUCER; ++i)
+            {
+                producersTasks[producer].push_back(Benchmark::getSubmittedTask(schedulerType, i, [] {}));
+            }
+        }
+
+        std::atomic<bool> isStarted{ false };
+        std::atomic<uint64_t> numberOfTakenTasks{ 0u };
+        std::vector<std::thread> threads;
+
+        for (uint64_t producer = 0u; producer < numberOfProducers; ++producer)
+        {
+            threads.emplace_back([&, producer]
+                                 {
+                                     waitStart(isStarted);
+                                     for (auto && task : producersTasks[producer])
+                                     {
+                                         taskScheduler->schedule(task);
+                                     }
+                                 });
+        }
+
+        for (uint64_t consumer = 0u; consumer < numberOfConsumers; ++consumer)
+        {
+            threads.emplace_back([&]
+                                 {
+                                     waitStart(isStarted);
+                                     while (numberOfTakenTasks.load(std::memory_order_relaxed) < numberOfTasks)
+                                     {
+                                         if (taskScheduler->getTaskForExecution() != nullptr)
+                                         {
+                                             numberOfTakenTasks.fetch_add(1u, std::memory_order_relaxed);
+                                         }
+                                     }
+                                 });
+        }
+
+        const uint64_t startTime{ Benchmark::getCurrentTime() };
+        isStarted.store(true, std::memory_order_release);
+
+        for (auto && thread : threads)
+        {
+            thread.join();
+        }
+
+        state.SetIterationTime(static_cast<double>(Benchmark::getCurrentTime() - startTime) / 1e9);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfTasks));
+    state.SetLabel(ThreadPoolOptions::schedulerTypeToString(schedulerType));
+}
+
+BENCHMARK(BM_TaskScheduler_ScheduleGetTaskForExecution)
+    ->ArgNames({ "scheduler", "producers", "consumers" })
+    ->ArgsProduct({ { 0, 1, 2, 3 }, { 1, 4 }, { 1, 4 } })
+    ->UseManualTime();
+
+
+//! Arguments: scheduler type, number of thieves. Owner takes tasks for execution while thieves steal them
+static void BM_TaskScheduler_Steal(benchmark::State & state)
+{
+    const ThreadPoolOptions::SchedulerType schedulerType{ Benchmark::getSchedulerType(state.range(0)) };
+    const uint64_t numberOfThieves{ static_cast<uint64_t>(state.range(1)) };
+    const uint64_t numberOfTasks{ (numberOfThieves + 1u) * NUMBER_OF_TASKS_PER_PRODUCER };
+    uint64_t numberOfStolenTasks{ 0u };
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<ITaskScheduler> taskScheduler{ Benchmark::getNewTaskScheduler(schedulerType) };
+
+        for (uint64_t i = 0u; i < numberOfTasks; ++i)
+        {
+            taskScheduler->schedule(Benchmark::getSubmittedTask(schedulerType, i, [] {}));
+        }
+
+        std::atomic<bool> isStarted{ false };
+        std::atomic<uint64_t> numberOfStolenTasksOfIteration{ 0u };
+        std::vector<std::thread> threads;
+
+        for (uint64_t thief = 0u; thief < numberOfThieves; ++thief)
+        {
+            threads.emplace_back([&]
+                                 {
+                                     waitStart(isStarted);
+                                     while (taskScheduler->steal() != nullptr)
+                                     {
+                                         numberOfStolenTasksOfIteration.fetch_add(1u, std::memory_order_relaxed);
+                                     }
+                                 });
+        }
+
+        const uint64_t startTime{ Benchmark::getCurrentTime() };
+        isStarted.store(true, std::memory_order_release);
+
+        while (taskScheduler->getTaskForExecution() != nullptr)
+        {
+        }
+
+        for (auto && thread : threads)
+        {
+            thread.join();
+        }
+
+        state.SetIterationTime(static_cast<double>(Benchmark::getCurrentTime() - startTime) / 1e9);
+        numberOfStolenTasks += numberOfStolenTasksOfIteration.load();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfTasks));
+    state.counters["stolen"] = benchmark::Counter(static_cast<double>(numberOfStolenTasks), benchmark::Counter::kAvgIterations);
+    state.SetLabel(ThreadPoolOptions::schedulerTypeToString(schedulerType));
+}
+
+BENCHMARK(BM_TaskScheduler_Steal)
+    ->ArgNames({ "scheduler", "thieves" })
+    ->ArgsProduct({ { 0, 1, 2, 3 }, { 1, 3 } })
+    ->UseManualTime();
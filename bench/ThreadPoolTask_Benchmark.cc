@@ -0,0 +1,43 @@
+#include "benchmark/benchmark.h"
+#include "BenchmarkCommon.h"
+#include "ThreadPoolTask.h"
+
+
+static void BM_ThreadPoolTask_SubmitOne(benchmark::State & state)
+{
+    const uint64_t numberOfAllocationsBefore{ Benchmark::getNumberOfAllocations() };
+
+    for (auto _ : state)
+    {
+        auto task = std::make_shared<ThreadPoolTask>();
+        auto future = task->submitOne([] { return true; });
+
+        benchmark::DoNotOptimize(future);
+    }
+
+    state.counters["allocations"] = benchmark::Counter(static_cast<double>(Benchmark::getNumberOfAllocations() - numberOfAllocationsBefore),
+                                                       benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_ThreadPoolTask_SubmitOne);
+
+
+//! Argument: size of the captured vector, capture of the lambda doesn't fit into small buffer of std::function
+static void BM_ThreadPoolTask_SubmitOneWithCapture(benchmark::State & state)
+{
+    const std::vector<uint8_t> capture(static_cast<size_t>(state.range(0)), 1u);
+    const uint64_t numberOfAllocationsBefore{ Benchmark::getNumberOfAllocations() };
+
+    for (auto _ : state)
+    {
+        auto task = std::make_shared<ThreadPoolTask>();
+        auto future = task->submitOne([capture] { return capture.size(); });
+
+        benchmark::DoNotOptimize(future);
+    }
+
+    state.counters["allocations"] = benchmark::Counter(static_cast<double>(Benchmark::getNumberOfAllocations() - numberOfAllocationsBefore),
+                                                       benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_ThreadPoolTask_SubmitOneWithCapture)->Arg(8)->Arg(256);
@@ -0,0 +1,97 @@
+#include <atomic>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "BasicThreadPool.h"
+#include "BenchmarkCommon.h"
+#include "ThreadPool.h"
+
+
+//! Argument: scheduler type. Only addTask is measured, tasks are created and executed outside of the measurement
+static void BM_ThreadPool_AddTask(benchmark::State & state)
+{
+    const ThreadPoolOptions::SchedulerType schedulerType{ Benchmark::getSchedulerType(state.range(0)) };
+
+    ThreadPoolOptions options{ schedulerType, 4u, 4u, 4u };
+    options.setFlightRecorderCapacity(0u);
+    ThreadPool threadPool{ options };
+
+    uint64_t index{ 0u };
+
+    for (auto _ : state)
+    {
+        const std::shared_ptr<IThreadPoolTask> task{ Benchmark::getSubmittedTask(schedulerType, index++, [] {}) };
+
+        const uint64_t startTime{ Benchmark::getCurrentTime() };
+        benchmark::DoNotOptimize(threadPool.addTask(task));
+        state.SetIterationTime(static_cast<double>(Benchmark::getCurrentTime() - startTime) / 1e9);
+    }
+
+    threadPool.waitAllTasksExecutionFinished(-1);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetLabel(ThreadPoolOptions::schedulerTypeToString(schedulerType));
+}
+
+BENCHMARK(BM_ThreadPool_AddTask)->ArgName("scheduler")->DenseRange(0, 3)->UseManualTime();
+
+
+//! Same measurement as BM_ThreadPool_AddTask for FCFS, but scheduling is resolved at compile time
+static void BM_BasicThreadPool_AddTask(benchmark::State & state)
+{
+    BasicThreadPool<FirstComeFirstServedPolicy> threadPool{ 4u };
+
+    for (auto _ : state)
+    {
+        std::function<void()> task{ [] {} };
+
+        const uint64_t startTime{ Benchmark::getCurrentTime() };
+        benchmark::DoNotOptimize(threadPool.addTask(std::move(task)));
+        state.SetIterationTime(static_cast<double>(Benchmark::getCurrentTime() - startTime) / 1e9);
+    }
+
+    threadPool.waitAllTasksExecutionFinished(-1);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_BasicThreadPool_AddTask)->UseManualTime();
+
+
+//! Argument: idle time in microseconds. Time from adding the task till idle worker starts its execution
+static void BM_ThreadPool_WakeUpLatency(benchmark::State & state)
+{
+    const uint64_t idleTimeInMicroseconds{ static_cast<uint64_t>(state.range(0)) };
+
+    ThreadPoolOptions options{ 1u, 1u, 1u };
+    options.setFlightRecorderCapacity(0u);
+    ThreadPool threadPool{ options };
+
+    for (auto _ : state)
+    {
+        // Manager thread and worker go waiting before the task comes
+        std::this_thread::sleep_for(std::chrono::microseconds(idleTimeInMicroseconds));
+
+        std::atomic<uint64_t> executionStartTime{ 0u };
+        const std::shared_ptr<IThreadPoolTask> task{ Benchmark::getSubmittedTask(ThreadPoolOptions::SchedulerType::FCFS, 0u,
+                                                                                 [&executionStartTime]
+                                                                                 {
+                                                                                     executionStartTime.store(Benchmark::getCurrentTime(),
+                                                                                                              std::memory_order_release);
+                                                                                 }) };
+
+        const uint64_t addTime{ Benchmark::getCurrentTime() };
+        threadPool.addTask(task);
+
+        while (0u == executionStartTime.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+
+        state.SetIterationTime(static_cast<double>(executionStartTime.load() - addTime) / 1e9);
+    }
+
+    threadPool.waitAllTasksExecutionFinished(-1);
+}
+
+BENCHMARK(BM_ThreadPool_WakeUpLatency)->ArgName("idle_us")->Arg(100)->Arg(2000)->Iterations(200)->UseManualTime();
@@ -0,0 +1,470 @@
+#include <chrono>
+#include <ctime>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BurstTimeTask.h"
+#include "MacroBenchmarkResult.h"
+#include "OSALThread.h"
+#include "PriorityTask.h"
+#include "TenantTask.h"
+#include "ThreadPool.h"
+
+
+/**
+ * Macro benchmarks run the scenarios of ThreadPool_PerformanceTest end to end: every run creates the pool with postponed
+ * execution, adds all tasks and measures time from adding till waitAllTasksExecutionFinished returns.
+ *
+ * Usage:
+ *   ThreadPoolMacroBenchmarks [--warmup N] [--runs N] [--workers 1,2,4|auto] [--tasks N] [--delay us] [--max-delay us]
+ *                             [--schedulers FCFS,PRIORITY,SJF,FAIR_SHARE] [--filter text] [--output file.json]
+ *   ThreadPoolMacroBenchmarks --compare baseline.json candidate.json [--threshold percents]
+ *
+ * Compare mode exits with 1 if any benchmark regressed, so it can gate CI.
+ */
+
+
+namespace
+{
+    struct Options
+    {
+        uint32_t numberOfWarmupRuns{ 2u };
+        uint32_t numberOfRuns{ 10u };
+        std::vector<uint32_t> numbersOfWorkers;
+        uint32_t numberOfTasks{ 1000u };
+        uint32_t delayInMicroseconds{ 250u };
+        uint32_t minDelayInMicroseconds{ 25u };
+        uint32_t maxDelayInMicroseconds{ 2500u };
+        std::vector<ThreadPoolOptions::SchedulerType> schedulerTypes{ ThreadPoolOptions::SchedulerType::FCFS,
+                                                                      ThreadPoolOptions::SchedulerType::PRIORITY,
+                                                                      ThreadPoolOptions::SchedulerType::SJF,
+                                                                      ThreadPoolOptions::SchedulerType::FAIR_SHARE };
+        std::string filter;
+        std::string outputFilePath;
+
+        std::string baselineFilePath;
+        std::string candidateFilePath;
+        double thresholdInPercents{ 5.0 };
+    };
+
+    using TasksContainer = std::vector<std::shared_ptr<IThreadPoolTask>>;
+    using TaskFunction = std::function<bool()>;
+
+    struct Scenario
+    {
+        std::string name;
+        //! Returns function of the task with the index, functions are created before the measurement
+        std::function<TaskFunction(const uint32_t index)> getTaskFunction;
+    };
+
+    //! Fixed seed, so all runs and compared builds execute the same delays
+    const uint32_t DIFFERENT_DELAYS_SEED{ 20240229u };
+
+
+    void printUsage()
+    {
+        std::cout << "Usage:\n"
+                  << "  ThreadPoolMacroBenchmarks [--warmup N] [--runs N] [--workers 1,2,4|auto] [--tasks N] [--delay us] [--max-delay us]\n"
+                  << "                            [--schedulers FCFS,PRIORITY,SJF,FAIR_SHARE] [--filter text] [--output file.json]\n"
+                  << "  ThreadPoolMacroBenchmarks --compare baseline.json candidate.json [--threshold percents]\n";
+    }
+
+
+    std::vector<std::string> split(const std::string & text, const char separator)
+    {
+        std::vector<std::string> parts;
+        std::stringstream stream{ text };
+        std::string part;
+
+        while (std::getline(stream, part, separator))
+        {
+            if (!part.empty())
+            {
+                parts.push_back(part);
+            }
+        }
+
+        return parts;
+    }
+
+
+    //! Powers of two up to the hardware concurrency, which is included too
+    std::vector<uint32_t> getDefaultNumbersOfWorkers()
+    {
+        const uint32_t hardwareConcurrency{ std::max(1u, std::thread::hardware_concurrency()) };
+        std::vector<uint32_t> numbersOfWorkers;
+
+        for (uint32_t numberOfWorkers = 1u; numberOfWorkers < hardwareConcurrency; numberOfWorkers *= 2u)
+        {
+            numbersOfWorkers.push_back(numberOfWorkers);
+        }
+        numbersOfWorkers.push_back(hardwareConcurrency);
+
+        return numbersOfWorkers;
+    }
+
+
+    bool getSchedulerType(const std::string & name, ThreadPoolOptions::SchedulerType & schedulerType)
+    {
+        for (uint8_t i = 0u; i < static_cast<uint8_t>(ThreadPoolOptions::SchedulerType::UNDEFINED); ++i)
+        {
+            const ThreadPoolOptions::SchedulerType currentSchedulerType{ static_cast<ThreadPoolOptions::SchedulerType>(i) };
+
+            if (ThreadPoolOptions::schedulerTypeToString(currentSchedulerType) == name)
+            {
+                schedulerType = currentSchedulerType;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    bool parseOptions(const int argc, char * argv[], Options & options)
+    {
+        options.numbersOfWorkers = getDefaultNumbersOfWorkers();
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string argument{ argv[i] };
+            const bool hasValue{ i + 1 < argc };
+
+            if ("--compare" == argument && i + 2 < argc)
+            {
+                options.baselineFilePath = argv[++i];
+                options.candidateFilePath = argv[++i];
+            }
+            else if ("--threshold" == argument && hasValue)
+            {
+                options.thresholdInPercents = std::strtod(argv[++i], nullptr);
+            }
+            else if ("--warmup" == argument && hasValue)
+            {
+                options.numberOfWarmupRuns = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ("--runs" == argument && hasValue)
+            {
+                options.numberOfRuns = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ("--tasks" == argument && hasValue)
+            {
+                options.numberOfTasks = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ("--delay" == argument && hasValue)
+            {
+                options.delayInMicroseconds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ("--max-delay" == argument && hasValue)
+            {
+                options.maxDelayInMicroseconds = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if ("--filter" == argument && hasValue)
+            {
+                options.filter = argv[++i];
+            }
+            else if ("--output" == argument && hasValue)
+            {
+                options.outputFilePath = argv[++i];
+            }
+            else if ("--workers" == argument && hasValue)
+            {
+                const std::string value{ argv[++i] };
+
+                if ("auto" != value)
+                {
+                    options.numbersOfWorkers.clear();
+
+                    for (auto && numberOfWorkers : split(value, ','))
+                    {
+                        options.numbersOfWorkers.push_back(std::max(1u, static_cast<uint32_t>(std::strtoul(numberOfWorkers.c_str(), nullptr, 10))));
+                    }
+                }
+            }
+            else if ("--schedulers" == argument && hasValue)
+            {
+                options.schedulerTypes.clear();
+
+                for (auto && name : split(argv[++i], ','))
+                {
+                    ThreadPoolOptions::SchedulerType schedulerType;
+
+                    if (!getSchedulerType(name, schedulerType))
+                    {
+                        std::cerr << "Unknown scheduler: " << name << "\n";
+                        return false;
+                    }
+
+                    options.schedulerTypes.push_back(schedulerType);
+                }
+            }
+            else
+            {
+                std::cerr << "Unknown or incomplete argument: " << argument << "\n";
+                return false;
+            }
+        }
+
+        if (0u == options.numberOfRuns || options.numbersOfWorkers.empty() || options.schedulerTypes.empty()
+            || options.minDelayInMicroseconds > options.maxDelayInMicroseconds)
+        {
+            std::cerr << "Nothing to run with the given arguments\n";
+            return false;
+        }
+
+        return true;
+    }
+
+
+    std::vector<Scenario> getScenarios(const Options & options)
+    {
+        const uint32_t delayInMicroseconds{ options.delayInMicroseconds };
+
+        std::vector<uint32_t> differentDelays(options.numberOfTasks);
+        std::mt19937 generator{ DIFFERENT_DELAYS_SEED };
+        std::uniform_int_distribution<uint32_t> distribution{ options.minDelayInMicroseconds, options.maxDelayInMicroseconds };
+
+        for (auto && delay : differentDelays)
+        {
+            delay = distribution(generator);
+        }
+
+        return
+        {
+            { "single_return", [](const uint32_t) -> TaskFunction { return [] { return true; }; } },
+            { "same_delayed", [delayInMicroseconds](const uint32_t) -> TaskFunction
+                              {
+                                  return [delayInMicroseconds]
+                                         {
+                                             OSAL::Thread::delay(delayInMicroseconds);
+                                             return true;
+                                         };
+                              } },
+            { "different_delayed", [differentDelays](const uint32_t index) -> TaskFunction
+                                   {
+                                       const uint32_t delay{ differentDelays[index % differentDelays.size()] };
+
+                                       return [delay]
+                                              {
+                                                  OSAL::Thread::delay(delay);
+                                                  return true;
+                                              };
+                                   } }
+        };
+    }
+
+
+    //! Task of the type ordered by the scheduler, priority, burst time and tenant are spread by the index
+    std::shared_ptr<IThreadPoolTask> getTask(const ThreadPoolOptions::SchedulerType schedulerType,
+                                             const uint32_t index,
+                                             const TaskFunction & function)
+    {
+        static const Priority priorities[]{ Priority::HIGH, Priority::NORMAL, Priority::LOW };
+        static const BurstTime burstTimes[]{ BurstTime::SHORT, BurstTime::MEDIUM, BurstTime::LONG };
+        static const std::string tenants[]{ "first", "second", "third" };
+
+        switch (schedulerType)
+        {
+            case ThreadPoolOptions::SchedulerType::PRIORITY:
+            {
+                auto task = std::make_shared<PriorityTask>(priorities[index % 3u]);
+                task->submitOne(function);
+                return task;
+            }
+
+            case ThreadPoolOptions::SchedulerType::SJF:
+            {
+                auto task = std::make_shared<BurstTimeTask>(burstTimes[index % 3u]);
+                task->submitOne(function);
+                return task;
+            }
+
+            case ThreadPoolOptions::SchedulerType::FAIR_SHARE:
+            {
+                auto task = std::make_shared<TenantTask>(tenants[index % 3u]);
+                task->submitOne(function);
+                return task;
+            }
+
+            case ThreadPoolOptions::SchedulerType::FCFS:
+            default:
+            {
+                auto task = std::make_shared<ThreadPoolTask>();
+                task->submitOne(function);
+                return task;
+            }
+        }
+    }
+
+
+    //! @return Elapsed time in microseconds, negative if the pool failed to finish the tasks
+    double runOnce(const Options & options, const Scenario & scenario,
+                   const ThreadPoolOptions::SchedulerType schedulerType, const uint32_t numberOfWorkers)
+    {
+        ThreadPoolOptions threadPoolOptions{ schedulerType, numberOfWorkers, numberOfWorkers, numberOfWorkers, true };
+        threadPoolOptions.setFlightRecorderCapacity(0u);
+        ThreadPool threadPool{ threadPoolOptions };
+
+        TasksContainer tasks;
+        tasks.reserve(options.numberOfTasks);
+
+        for (uint32_t i = 0u; i < options.numberOfTasks; ++i)
+        {
+            tasks.push_back(getTask(schedulerType, i, scenario.getTaskFunction(i)));
+        }
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // Result of addTasks isn't checked, since results of the scheduled tasks aren't accumulated yet (see Result.h)
+        threadPool.addTasks(tasks);
+        threadPool.startExecution();
+
+        if (Result::OK != threadPool.waitAllTasksExecutionFinished(-1))
+        {
+            return -1.0;
+        }
+
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+
+    std::string getCurrentDate()
+    {
+        const std::time_t now{ std::time(nullptr) };
+        char date[32]{};
+
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+        return date;
+    }
+
+
+    int runBenchmarks(const Options & options)
+    {
+        MacroBenchmark::Context context;
+        context.date = getCurrentDate();
+        context.hardwareConcurrency = std::thread::hardware_concurrency();
+        context.numberOfWarmupRuns = options.numberOfWarmupRuns;
+        context.numberOfRuns = options.numberOfRuns;
+
+        std::vector<MacroBenchmark::Result> results;
+
+        std::cout << std::left << std::setw(48) << "Benchmark" << std::right
+                  << std::setw(14) << "Mean[us]" << std::setw(24) << "95% CI[us]"
+                  << std::setw(12) << "Stddev[%]" << std::setw(14) << "Tasks/s" << "\n";
+
+        for (auto && scenario : getScenarios(options))
+        {
+            for (const ThreadPoolOptions::SchedulerType schedulerType : options.schedulerTypes)
+            {
+                for (const uint32_t numberOfWorkers : options.numbersOfWorkers)
+                {
+                    MacroBenchmark::Result result;
+                    result.scenario = scenario.name;
+                    result.scheduler = ThreadPoolOptions::schedulerTypeToString(schedulerType);
+                    result.numberOfWorkers = numberOfWorkers;
+                    result.numberOfTasks = options.numberOfTasks;
+                    result.name = result.scenario + "/" + result.scheduler + "/workers:" + std::to_string(numberOfWorkers);
+
+                    if (!options.filter.empty() && result.name.find(options.filter) == std::string::npos)
+                    {
+                        continue;
+                    }
+
+                    // Warmup runs fill the allocator caches and wake up the CPU frequency, they aren't measured
+                    for (uint32_t i = 0u; i < options.numberOfWarmupRuns; ++i)
+                    {
+                        runOnce(options, scenario, schedulerType, numberOfWorkers);
+                    }
+
+                    for (uint32_t i = 0u; i < options.numberOfRuns; ++i)
+                    {
+                        const double elapsedTime{ runOnce(options, scenario, schedulerType, numberOfWorkers) };
+
+                        if (elapsedTime < 0.0)
+                        {
+                            std::cerr << result.name << ": thread pool failed\n";
+                            return EXIT_FAILURE;
+                        }
+
+                        result.samples.push_back(elapsedTime);
+                    }
+
+                    result.summarize();
+                    results.push_back(result);
+
+                    std::ostringstream confidenceInterval;
+                    confidenceInterval << std::fixed << std::setprecision(1)
+                                       << "[" << result.confidenceIntervalLow << ", " << result.confidenceIntervalHigh << "]";
+
+                    std::cout << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(1)
+                              << std::setw(14) << result.mean << std::setw(24) << confidenceInterval.str()
+                              << std::setw(12) << (result.mean > 0.0 ? result.standardDeviation * 100.0 / result.mean : 0.0)
+                              << std::setw(14) << std::setprecision(0) << result.tasksPerSecond << "\n";
+                }
+            }
+        }
+
+        if (!options.outputFilePath.empty())
+        {
+            std::ofstream file{ options.outputFilePath, std::ios::trunc };
+            MacroBenchmark::writeJson(file, context, results);
+
+            if (!file.good())
+            {
+                std::cerr << "Can't write " << options.outputFilePath << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+
+    int compareResults(const Options & options)
+    {
+        std::vector<MacroBenchmark::Result> baselineResults;
+        std::vector<MacroBenchmark::Result> candidateResults;
+
+        if (!MacroBenchmark::readJson(options.baselineFilePath, baselineResults))
+        {
+            std::cerr << "Can't read " << options.baselineFilePath << "\n";
+            return EXIT_FAILURE;
+        }
+
+        if (!MacroBenchmark::readJson(options.candidateFilePath, candidateResults))
+        {
+            std::cerr << "Can't read " << options.candidateFilePath << "\n";
+            return EXIT_FAILURE;
+        }
+
+        const uint32_t numberOfRegressions{ MacroBenchmark::compare(std::cout, baselineResults, candidateResults,
+                                                                    options.thresholdInPercents) };
+
+        std::cout << numberOfRegressions << " regression(s) with threshold " << options.thresholdInPercents << "%\n";
+
+        return 0u == numberOfRegressions ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+} // namespace
+
+
+int main(int argc, char * argv[])
+{
+    Options options;
+
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    return options.baselineFilePath.empty() ? runBenchmarks(options) : compareResults(options);
+}
@@ -0,0 +1,465 @@
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "MacroBenchmarkResult.h"
+
+
+namespace
+{
+    //! Two-sided 95% critical values for 1..30 degrees of freedom
+    const double STUDENT_CRITICAL_VALUES[]{ 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+    const uint32_t NUMBER_OF_STUDENT_CRITICAL_VALUES{ sizeof(STUDENT_CRITICAL_VALUES) / sizeof(STUDENT_CRITICAL_VALUES[0]) };
+    const double NORMAL_CRITICAL_VALUE{ 1.960 };
+
+
+    std::string escape(const std::string & value)
+    {
+        std::string escaped;
+
+        for (const char character : value)
+        {
+            if ('"' == character || '\\' == character)
+            {
+                escaped += '\\';
+            }
+
+            escaped += character;
+        }
+
+        return escaped;
+    }
+
+
+    /**
+     * @brief Minimal JSON reader, which flattens the document into "path" -> "scalar value",
+     *        e.g. {"results":[{"mean":1.5}]} becomes "results.0.mean" -> "1.5".
+     */
+    class FlatJsonReader
+    {
+    public:
+
+        explicit FlatJsonReader(const std::string & text)
+            : text_{ text }
+            , position_{ 0u }
+        {
+        }
+
+        bool read(std::map<std::string, std::string> & values)
+        {
+            if (!readValue("", values))
+            {
+                return false;
+            }
+
+            skipWhitespaces();
+
+            return position_ == text_.size();
+        }
+
+    private:
+
+        void skipWhitespaces()
+        {
+            while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+            {
+                ++position_;
+            }
+        }
+
+        bool consume(const char character)
+        {
+            skipWhitespaces();
+
+            if (position_ < text_.size() && text_[position_] == character)
+            {
+                ++position_;
+                return true;
+            }
+
+            return false;
+        }
+
+        bool readString(std::string & value)
+        {
+            if (!consume('"'))
+            {
+                return false;
+            }
+
+            value.clear();
+
+            while (position_ < text_.size() && text_[position_] != '"')
+            {
+                if ('\\' == text_[position_])
+                {
+                    ++position_;
+
+                    if (position_ >= text_.size())
+                    {
+                        return false;
+                    }
+                }
+
+                value += text_[position_++];
+            }
+
+            return consume('"');
+        }
+
+        bool readValue(const std::string & path, std::map<std::string, std::string> & values)
+        {
+            skipWhitespaces();
+
+            if (position_ >= text_.size())
+            {
+                return false;
+            }
+
+            if ('{' == text_[position_])
+            {
+                ++position_;
+
+                if (consume('}'))
+                {
+                    return true;
+                }
+
+                do
+                {
+                    std::string key;
+
+                    if (!readString(key) || !consume(':') || !readValue(path.empty() ? key : path + "." + key, values))
+                    {
+                        return false;
+                    }
+                }
+                while (consume(','));
+
+                return consume('}');
+            }
+
+            if ('[' == text_[position_])
+            {
+                ++position_;
+
+                if (consume(']'))
+                {
+                    return true;
+                }
+
+                size_t index{ 0u };
+
+                do
+                {
+                    if (!readValue(path + "." + std::to_string(index++), values))
+                    {
+                        return false;
+                    }
+                }
+                while (consume(','));
+
+                return consume(']');
+            }
+
+            if ('"' == text_[position_])
+            {
+                return readString(values[path]);
+            }
+
+            const size_t begin{ position_ };
+
+            while (position_ < text_.size() && text_[position_] != ',' && text_[position_] != '}' && text_[position_] != ']'
+                   && !std::isspace(static_cast<unsigned char>(text_[position_])))
+            {
+                ++position_;
+            }
+
+            if (begin == position_)
+            {
+                return false;
+            }
+
+            values[path] = text_.substr(begin, position_ - begin);
+
+            return true;
+        }
+
+    private:
+
+        const std::string & text_;
+        size_t position_;
+    };
+
+
+    double getNumber(const std::map<std::string, std::string> & values, const std::string & path)
+    {
+        auto foundValue = values.find(path);
+
+        return foundValue == values.end() ? 0.0 : std::strtod(foundValue->second.c_str(), nullptr);
+    }
+
+
+    std::string getString(const std::map<std::string, std::string> & values, const std::string & path)
+    {
+        auto foundValue = values.find(path);
+
+        return foundValue == values.end() ? std::string{} : foundValue->second;
+    }
+
+
+    const MacroBenchmark::Result * findResult(const std::vector<MacroBenchmark::Result> & results, const std::string & name)
+    {
+        for (auto && result : results)
+        {
+            if (result.name == name)
+            {
+                return &result;
+            }
+        }
+
+        return nullptr;
+    }
+} // namespace
+
+
+void MacroBenchmark::Result::summarize()
+{
+    if (samples.empty())
+    {
+        return;
+    }
+
+    std::vector<double> sortedSamples{ samples };
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+
+    const size_t size{ sortedSamples.size() };
+
+    min = sortedSamples.front();
+    max = sortedSamples.back();
+    median = (size % 2u == 1u) ? sortedSamples[size / 2u] : (sortedSamples[size / 2u - 1u] + sortedSamples[size / 2u]) / 2.0;
+
+    double sum{ 0.0 };
+    for (const double sample : sortedSamples)
+    {
+        sum += sample;
+    }
+    mean = sum / static_cast<double>(size);
+
+    double squaredDeviationsSum{ 0.0 };
+    for (const double sample : sortedSamples)
+    {
+        squaredDeviationsSum += (sample - mean) * (sample - mean);
+    }
+    standardDeviation = (size > 1u) ? std::sqrt(squaredDeviationsSum / static_cast<double>(size - 1u)) : 0.0;
+
+    const double halfWidth{ (size > 1u) ? getStudentCriticalValue(static_cast<uint32_t>(size - 1u)) * standardDeviation
+                                          / std::sqrt(static_cast<double>(size))
+                                        : 0.0 };
+    confidenceIntervalLow = mean - halfWidth;
+    confidenceIntervalHigh = mean + halfWidth;
+
+    tasksPerSecond = (mean > 0.0) ? static_cast<double>(numberOfTasks) * 1000000.0 / mean : 0.0;
+}
+
+
+double MacroBenchmark::getStudentCriticalValue(const uint32_t degreesOfFreedom)
+{
+    if (0u == degreesOfFreedom)
+    {
+        return 0.0;
+    }
+
+    return degreesOfFreedom <= NUMBER_OF_STUDENT_CRITICAL_VALUES ? STUDENT_CRITICAL_VALUES[degreesOfFreedom - 1u]
+                                                                 : NORMAL_CRITICAL_VALUE;
+}
+
+
+void MacroBenchmark::writeJson(std::ostream & stream, const Context & context, const std::vector<Result> & results)
+{
+    std::ostringstream json;
+    json.precision(10);
+
+    json << "{\n"
+         << "  \"context\": {\n"
+         << "    \"date\": \"" << escape(context.date) << "\",\n"
+         << "    \"hardware_concurrency\": " << context.hardwareConcurrency << ",\n"
+         << "    \"warmup_runs\": " << context.numberOfWarmupRuns << ",\n"
+         << "    \"runs\": " << context.numberOfRuns << ",\n"
+         << "    \"time_unit\": \"us\"\n"
+         << "  },\n"
+         << "  \"results\": [";
+
+    for (size_t i = 0u; i < results.size(); ++i)
+    {
+        const Result & result = results[i];
+
+        json << (i == 0u ? "\n" : ",\n")
+             << "    {\n"
+             << "      \"name\": \"" << escape(result.name) << "\",\n"
+             << "      \"scenario\": \"" << escape(result.scenario) << "\",\n"
+             << "      \"scheduler\": \"" << escape(result.scheduler) << "\",\n"
+             << "      \"workers\": " << result.numberOfWorkers << ",\n"
+             << "      \"tasks\": " << result.numberOfTasks << ",\n"
+             << "      \"mean\": " << result.mean << ",\n"
+             << "      \"stddev\": " << result.standardDeviation << ",\n"
+             << "      \"median\": " << result.median << ",\n"
+             << "      \"min\": " << result.min << ",\n"
+             << "      \"max\": " << result.max << ",\n"
+             << "      \"ci95_low\": " << result.confidenceIntervalLow << ",\n"
+             << "      \"ci95_high\": " << result.confidenceIntervalHigh << ",\n"
+             << "      \"tasks_per_second\": " << result.tasksPerSecond << ",\n"
+             << "      \"samples\": [";
+
+        for (size_t j = 0u; j < result.samples.size(); ++j)
+        {
+            json << (j == 0u ? "" : ", ") << result.samples[j];
+        }
+
+        json << "]\n"
+             << "    }";
+    }
+
+    json << "\n  ]\n"
+         << "}\n";
+
+    stream << json.str();
+}
+
+
+bool MacroBenchmark::readJson(const std::string & filePath, std::vector<Result> & results)
+{
+    std::ifstream file{ filePath };
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream text;
+    text << file.rdbuf();
+
+    const std::string content{ text.str() };
+    std::map<std::string, std::string> values;
+
+    if (!FlatJsonReader{ content }.read(values))
+    {
+        return false;
+    }
+
+    results.clear();
+
+    for (size_t i = 0u; values.count("results." + std::to_string(i) + ".name") != 0u; ++i)
+    {
+        const std::string prefix{ "results." + std::to_string(i) + "." };
+        Result result;
+
+        result.name = getString(values, prefix + "name");
+        result.scenario = getString(values, prefix + "scenario");
+        result.scheduler = getString(values, prefix + "scheduler");
+        result.numberOfWorkers = static_cast<uint32_t>(getNumber(values, prefix + "workers"));
+        result.numberOfTasks = static_cast<uint32_t>(getNumber(values, prefix + "tasks"));
+        result.mean = getNumber(values, prefix + "mean");
+        result.standardDeviation = getNumber(values, prefix + "stddev");
+        result.median = getNumber(values, prefix + "median");
+        result.min = getNumber(values, prefix + "min");
+        result.max = getNumber(values, prefix + "max");
+        result.confidenceIntervalLow = getNumber(values, prefix + "ci95_low");
+        result.confidenceIntervalHigh = getNumber(values, prefix + "ci95_high");
+        result.tasksPerSecond = getNumber(values, prefix + "tasks_per_second");
+
+        results.push_back(result);
+    }
+
+    return true;
+}
+
+
+std::string MacroBenchmark::verdictToString(const Verdict verdict)
+{
+    switch (verdict)
+    {
+        case Verdict::SAME: return "same";
+        case Verdict::REGRESSION: return "REGRESSION";
+        case Verdict::IMPROVEMENT: return "improvement";
+        case Verdict::MISSING: return "missing";
+    }
+
+    return "unknown";
+}
+
+
+MacroBenchmark::Verdict MacroBenchmark::compare(const Result & baseline, const Result & candidate, const double thresholdInPercents)
+{
+    const double threshold{ thresholdInPercents / 100.0 };
+
+    // Noise is filtered twice: the means must differ more than the threshold and the intervals mustn't overlap
+    if (candidate.mean > baseline.mean * (1.0 + threshold) && candidate.confidenceIntervalLow > baseline.confidenceIntervalHigh)
+    {
+        return Verdict::REGRESSION;
+    }
+
+    if (candidate.mean < baseline.mean * (1.0 - threshold) && candidate.confidenceIntervalHigh < baseline.confidenceIntervalLow)
+    {
+        return Verdict::IMPROVEMENT;
+    }
+
+    return Verdict::SAME;
+}
+
+
+uint32_t MacroBenchmark::compare(std::ostream & stream,
+                                 const std::vector<Result> & baselineResults,
+                                 const std::vector<Result> & candidateResults,
+                                 const double thresholdInPercents)
+{
+    uint32_t numberOfRegressions{ 0u };
+
+    stream << std::left << std::setw(48) << "Benchmark" << std::right
+           << std::setw(16) << "Baseline[us]" << std::setw(16) << "Candidate[us]"
+           << std::setw(12) << "Change[%]" << "  Verdict\n";
+
+    stream << std::fixed << std::setprecision(1);
+
+    for (auto && candidate : candidateResults)
+    {
+        const Result * baseline{ findResult(baselineResults, candidate.name) };
+
+        stream << std::left << std::setw(48) << candidate.name << std::right;
+
+        if (nullptr == baseline)
+        {
+            stream << std::setw(16) << "-" << std::setw(16) << candidate.mean << std::setw(12) << "-"
+                   << "  " << verdictToString(Verdict::MISSING) << "\n";
+            continue;
+        }
+
+        const Verdict verdict{ compare(*baseline, candidate, thresholdInPercents) };
+        const double change{ (baseline->mean > 0.0) ? (candidate.mean - baseline->mean) * 100.0 / baseline->mean : 0.0 };
+
+        if (Verdict::REGRESSION == verdict)
+        {
+            ++numberOfRegressions;
+        }
+
+        stream << std::setw(16) << baseline->mean << std::setw(16) << candidate.mean << std::setw(12) << change
+               << "  " << verdictToString(verdict) << "\n";
+    }
+
+    for (auto && baseline : baselineResults)
+    {
+        if (nullptr == findResult(candidateResults, baseline.name))
+        {
+            stream << std::left << std::setw(48) << baseline.name << std::right
+                   << std::setw(16) << baseline.mean << std::setw(16) << "-" << std::setw(12) << "-"
+                   << "  " << verdictToString(Verdict::MISSING) << "\n";
+        }
+    }
+
+    return numberOfRegressions;
+}
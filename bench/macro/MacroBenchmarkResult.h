@@ -0,0 +1,86 @@
+#ifndef _MACROBENCHMARKRESULT_H_
+#define _MACROBENCHMARKRESULT_H_
+
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace MacroBenchmark
+{
+    /**
+     * @brief Elapsed times of repeated runs of one scenario with their summary.
+     *        Confidence interval of the mean uses Student's t-distribution, since number of runs is usually small.
+     */
+    struct Result
+    {
+        std::string name;                       ///< Unique key of the result, e.g. "same_delayed/FCFS/workers:4".
+        std::string scenario;
+        std::string scheduler;
+        uint32_t numberOfWorkers{ 0u };
+        uint32_t numberOfTasks{ 0u };
+        std::vector<double> samples;            ///< Elapsed time of every measured run in microseconds.
+
+        double mean{ 0.0 };
+        double standardDeviation{ 0.0 };
+        double median{ 0.0 };
+        double min{ 0.0 };
+        double max{ 0.0 };
+        double confidenceIntervalLow{ 0.0 };    ///< 95% confidence interval of the mean.
+        double confidenceIntervalHigh{ 0.0 };
+        double tasksPerSecond{ 0.0 };           ///< Number of tasks divided by the mean.
+
+        /**
+         * @brief Calculates summary of the samples.
+         */
+        void summarize();
+    };
+
+    struct Context
+    {
+        std::string date;
+        uint32_t hardwareConcurrency{ 0u };
+        uint32_t numberOfWarmupRuns{ 0u };
+        uint32_t numberOfRuns{ 0u };
+    };
+
+    /**
+     * @return Two-sided 95% critical value of Student's t-distribution.
+     */
+    double getStudentCriticalValue(const uint32_t degreesOfFreedom);
+
+    void writeJson(std::ostream & stream, const Context & context, const std::vector<Result> & results);
+
+    /**
+     * @brief Reads results written by writeJson, samples aren't read, since comparison uses the summary.
+     * @return False if the file can't be opened or isn't valid JSON.
+     */
+    bool readJson(const std::string & filePath, std::vector<Result> & results);
+
+    enum class Verdict : uint8_t
+    {
+        SAME,           ///< Difference is below the threshold or confidence intervals overlap.
+        REGRESSION,     ///< Candidate is slower by more than the threshold and intervals don't overlap.
+        IMPROVEMENT,    ///< Candidate is faster by more than the threshold and intervals don't overlap.
+        MISSING         ///< Result exists only in one of the files.
+    };
+
+    std::string verdictToString(const Verdict verdict);
+
+    Verdict compare(const Result & baseline, const Result & candidate, const double thresholdInPercents);
+
+    /**
+     * @brief Prints comparison table of the results with the same names.
+     * @return Number of regressions.
+     */
+    uint32_t compare(std::ostream & stream,
+                     const std::vector<Result> & baselineResults,
+                     const std::vector<Result> & candidateResults,
+                     const double thresholdInPercents);
+} // MacroBenchmark namespace
+
+
+#endif // _MACROBENCHMARKRESULT_H_
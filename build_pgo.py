@@ -0,0 +1,98 @@
+"""
+Builds the library with profile guided optimization (and optionally LTO).
+
+1. Library is built instrumented (THREAD_POOL_PGO=GENERATE) together with the macro benchmarks.
+2. Macro benchmarks run the scenarios of the performance tests for every scheduler to collect profiles.
+3. Library is rebuilt in the same build directory with the profiles (THREAD_POOL_PGO=USE).
+
+With --compare the same workload is measured on the plain release build and on the optimized one,
+results are compared by ThreadPoolMacroBenchmarks --compare.
+
+Usage:
+    python build_pgo.py [--build-dir build-pgo] [--lto] [--compare] [--cmake-args "-DCMAKE_CXX_COMPILER=clang++"]
+"""
+
+import argparse
+import glob
+import os
+import shlex
+import shutil
+import subprocess
+import sys
+
+
+# Representative workload: all scenarios and schedulers, short delays so the run takes seconds
+TRAINING_ARGUMENTS = ["--warmup", "0", "--runs", "3", "--tasks", "2000", "--delay", "50", "--max-delay", "500", "--workers", "1,2,4"]
+MEASUREMENT_ARGUMENTS = ["--warmup", "2", "--runs", "10", "--tasks", "2000", "--delay", "50", "--max-delay", "500", "--workers", "1,2,4"]
+
+
+def run(command, **kwargs):
+    print("> " + " ".join(command), flush=True)
+    subprocess.check_call(command, **kwargs)
+
+
+def configure_and_build(source_dir, build_dir, cmake_args):
+    run(["cmake", "-S", source_dir, "-B", build_dir, "-DCMAKE_BUILD_TYPE=Release", "-DBUILD_BENCHMARKS=ON"] + cmake_args)
+    run(["cmake", "--build", build_dir, "--config", "Release", "--parallel"])
+
+
+def get_macro_benchmarks(build_dir):
+    for path in [os.path.join(build_dir, "ThreadPoolMacroBenchmarks"),
+                 os.path.join(build_dir, "Release", "ThreadPoolMacroBenchmarks.exe")]:
+        if os.path.isfile(path):
+            return path
+
+    sys.exit("ThreadPoolMacroBenchmarks isn't found in " + build_dir)
+
+
+def merge_clang_profiles(profile_dir):
+    raw_profiles = glob.glob(os.path.join(profile_dir, "*.profraw"))
+
+    # GCC writes .gcda files, which are used directly
+    if raw_profiles:
+        llvm_profdata = shutil.which("llvm-profdata")
+        if llvm_profdata is None:
+            sys.exit("llvm-profdata is required to merge Clang profiles")
+
+        run([llvm_profdata, "merge", "-output=" + os.path.join(profile_dir, "default.profdata")] + raw_profiles)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Profile guided optimization build of the thread pool")
+    parser.add_argument("--build-dir", default="build-pgo")
+    parser.add_argument("--lto", action="store_true", help="enable link time optimization in addition to PGO")
+    parser.add_argument("--compare", action="store_true", help="measure plain release build and compare it with PGO build")
+    parser.add_argument("--cmake-args", default="", help="additional CMake arguments, e.g. compiler selection")
+    arguments = parser.parse_args()
+
+    source_dir = os.path.dirname(os.path.abspath(__file__))
+    build_dir = os.path.abspath(arguments.build_dir)
+    profile_dir = os.path.join(build_dir, "pgo-profiles")
+    cmake_args = shlex.split(arguments.cmake_args) + ["-DTHREAD_POOL_PGO_PROFILE_DIR=" + profile_dir,
+                                                      "-DTHREAD_POOL_LTO=" + ("ON" if arguments.lto else "OFF")]
+
+    # Stale profiles of the previous sources would be rejected or mislead the optimizer
+    shutil.rmtree(profile_dir, ignore_errors=True)
+
+    configure_and_build(source_dir, build_dir, cmake_args + ["-DTHREAD_POOL_PGO=GENERATE"])
+    run([get_macro_benchmarks(build_dir)] + TRAINING_ARGUMENTS)
+    merge_clang_profiles(profile_dir)
+
+    # Objects are rebuilt in the same directory, since GCC matches profiles by object paths
+    configure_and_build(source_dir, build_dir, cmake_args + ["-DTHREAD_POOL_PGO=USE"])
+
+    if arguments.compare:
+        baseline_dir = build_dir + "-baseline"
+        baseline_results = os.path.join(build_dir, "baseline.json")
+        pgo_results = os.path.join(build_dir, "pgo.json")
+
+        configure_and_build(source_dir, baseline_dir, shlex.split(arguments.cmake_args) + ["-DTHREAD_POOL_PGO=", "-DTHREAD_POOL_LTO=OFF"])
+        run([get_macro_benchmarks(baseline_dir)] + MEASUREMENT_ARGUMENTS + ["--output", baseline_results])
+        run([get_macro_benchmarks(build_dir)] + MEASUREMENT_ARGUMENTS + ["--output", pgo_results])
+
+        # Regressions are reported, but they don't fail the build
+        subprocess.call([get_macro_benchmarks(build_dir), "--compare", baseline_results, pgo_results])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#ifndef _ASYNCLOGGINGBACKEND_H_
+#define _ASYNCLOGGINGBACKEND_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CacheLinePadded.h"
+#include "RelaxedCounter.h"
+
+
+/**
+ * @brief Asynchronous writer of logging records.
+ *        Every logging thread formats its message into its own single producer single consumer ring without any lock,
+ *        background thread drains rings, orders records by their monotonic timestamps and writes them to the file or stdout.
+ *        Records, which don't fit into the full ring, are dropped and counted, so logging never blocks the caller.
+ */
+class AsyncLoggingBackend
+{
+public:
+
+    static const size_t INSTANCE_NAME_SIZE{ 64u };
+    static const size_t MESSAGE_SIZE{ 384u };
+    static const int64_t DRAIN_PERIOD_IN_MICROSECONDS{ 1000 };
+
+    static AsyncLoggingBackend & getInstance();
+
+    AsyncLoggingBackend(const AsyncLoggingBackend &) = delete;
+    AsyncLoggingBackend & operator=(const AsyncLoggingBackend &) = delete;
+
+    ~AsyncLoggingBackend();
+
+    /**
+     * @param filePath Records are appended to the file, empty path means stdout.
+     * @param capacityPerThread Max number of not written records of one thread, rings of already logging threads keep their capacity.
+     * @return False if the file can't be opened or backend is already started.
+     */
+    bool start(const std::string & filePath, const uint32_t capacityPerThread);
+
+    /**
+     * @brief Writes all recorded records and stops background thread.
+     */
+    void stop();
+
+    inline bool isStarted() const { return isStarted_.load(std::memory_order_acquire); }
+
+    /**
+     * @param levelName String literal, it's kept as pointer till the record is written.
+     * @return False if backend is stopped or stopping, the record isn't taken and args aren't used, so the caller writes it itself.
+     */
+    bool write(const char * levelName, const std::string & instanceName, const char * message, va_list args);
+
+    /**
+     * @brief Writes records recorded before the call by the calling thread.
+     */
+    void flush();
+
+    uint64_t getNumberOfDroppedRecords() const;
+
+private:
+
+    struct Record
+    {
+        uint64_t time;                              ///< Microseconds of OSAL::Time::getCurrentTime.
+        const char * levelName;                     ///< Points to the string literal of the level.
+        char instanceName[INSTANCE_NAME_SIZE];
+        char message[MESSAGE_SIZE];
+    };
+
+    struct Ring
+    {
+        explicit Ring(const uint32_t capacity);
+
+        std::vector<Record> records;
+        CacheLinePadded<std::atomic<uint64_t>> head;    ///< Written only by the logging thread.
+        CacheLinePadded<std::atomic<uint64_t>> tail;    ///< Written only by the draining thread.
+        std::atomic<bool> isAbandoned;                  ///< Logging thread is finished, ring is removed once it's drained.
+        std::atomic<bool> isWriting;                    ///< Logging thread saw the backend started and is adding the record.
+    };
+
+    //! Logging thread owns its ring till it ends, backend keeps it till it's drained
+    struct RingOwner
+    {
+        ~RingOwner();
+
+        std::shared_ptr<Ring> ring;
+    };
+
+private:
+
+    AsyncLoggingBackend();
+
+    Ring & getCurrentThreadRing();
+    void drain();
+    void run();
+
+private:
+
+    std::mutex stateMutex_;
+    std::atomic<bool> isStarted_;
+    std::atomic<uint32_t> capacityPerThread_;
+    uint64_t startSteadyTime_;
+    std::chrono::system_clock::time_point startSystemTime_;
+    std::ofstream file_;
+    std::thread thread_;
+
+    std::mutex ringsMutex_;
+    std::vector<std::shared_ptr<Ring>> rings_;
+
+    //! Only one thread drains rings at a time, so every ring has exactly one consumer
+    std::mutex drainMutex_;
+
+    std::mutex wakeUpMutex_;
+    std::condition_variable wakeUpCondition_;
+
+    RelaxedCounter numberOfDroppedRecords_;
+
+    static thread_local RingOwner currentThreadRingOwner_;
+};
+
+
+#endif // _ASYNCLOGGINGBACKEND_H_
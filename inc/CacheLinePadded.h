@@ -0,0 +1,23 @@
+#ifndef _CACHELINEPADDED_H_
+#define _CACHELINEPADDED_H_
+
+#include <cstddef>
+
+
+static const size_t CACHE_LINE_SIZE{ 64u };
+
+
+/**
+ * @brief Keeps value on its own cache line, so frequent writes to it don't invalidate neighbour data.
+ *        Padding is used instead of alignas, because over-aligned heap allocation is not guaranteed before C++17.
+ */
+template<typename T>
+struct CacheLinePadded
+{
+    char leadingPadding_[CACHE_LINE_SIZE];
+    T value;
+    char trailingPadding_[CACHE_LINE_SIZE - (sizeof(T) % CACHE_LINE_SIZE)];
+};
+
+
+#endif // _CACHELINEPADDED_H_
@@ -1,9 +1,45 @@
 #ifndef _LOGGING_H_
 #define _LOGGING_H_
 
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "OSAL.h"
 
 
+/**
+ * @brief Most verbose level compiled in the logging macros, calls above it are removed with their arguments.
+ *        Values are Logging::LoggingLevel, by default debug level is compiled only in debug builds.
+ */
+#ifndef THREAD_POOL_MAX_LOGGING_LEVEL
+#ifdef NDEBUG
+#define THREAD_POOL_MAX_LOGGING_LEVEL 3
+#else
+#define THREAD_POOL_MAX_LOGGING_LEVEL 4
+#endif
+#endif
+
+/**
+ * @brief Logging macros evaluate arguments only if the level is compiled and enabled at runtime,
+ *        so disabled calls on hot paths cost one relaxed load or nothing at all.
+ */
+#define LOGGING_AT_LEVEL(logging, level, method, ...)                                                   \
+    do                                                                                                  \
+    {                                                                                                   \
+        if (Logging::level <= THREAD_POOL_MAX_LOGGING_LEVEL && Logging::isEnabled(Logging::level))     \
+        {                                                                                               \
+            (logging)->method(__VA_ARGS__);                                                             \
+        }                                                                                               \
+    } while (false)
+
+#define LOGGING_DEBUG(logging, ...)     LOGGING_AT_LEVEL(logging, LOG_DEBUG, logDebug, __VA_ARGS__)
+#define LOGGING_INFO(logging, ...)      LOGGING_AT_LEVEL(logging, LOG_INFO, logInfo, __VA_ARGS__)
+#define LOGGING_WARNING(logging, ...)   LOGGING_AT_LEVEL(logging, LOG_WARNING, logWarning, __VA_ARGS__)
+#define LOGGING_ERROR(logging, ...)     LOGGING_AT_LEVEL(logging, LOG_ERROR, logError, __VA_ARGS__)
+
+
 class Logging
 {
 public:
@@ -27,23 +63,71 @@ public:
     void logWarning (const char * message, ...) const;
     void logError   (const char * message, ...) const;
 
-    Logging* getNewLoggingInstance(const std::string subInstanceName) const;
+    /**
+     * @brief Interned instance named "<instance name>(<sub instance name>)".
+     * @note Sub instances are cached by the parent, so repeated calls neither allocate nor build the name.
+     */
+    Logging * getSubInstance(const char * subInstanceName) const;
+
+    const std::string & getInstanceName() const;
+
+    /**
+     * @brief Instances are interned by name and never destroyed, so the handle is shared by all primitives with the same name
+     *        and stays valid till the process ends.
+     */
+    static Logging * getInstance(const std::string & instanceName);
 
     static void enableLoggingLevel(const LoggingLevel level);
     static void disableLoggingLevel(const LoggingLevel level);
 
+    /**
+     * @brief Switches all instances to AsyncLoggingBackend, so logging thread only formats the message into its own ring.
+     * @param filePath Records are appended to the file, empty path means stdout.
+     * @param capacityPerThread Records of the thread above it are dropped till background thread writes them.
+     * @return False if the file can't be opened or async logging is already enabled.
+     */
+    static bool enableAsyncLogging(const std::string & filePath = "", const uint32_t capacityPerThread = 1024u);
+
+    /**
+     * @brief Writes all recorded records and switches back to synchronous logging.
+     */
+    static void disableAsyncLogging();
+    static void flushAsyncLogging();
+    static uint64_t getNumberOfDroppedRecords();
+
+    /**
+     * @brief Enabling LOG_DISABLED level disables all levels.
+     */
+    static inline bool isEnabled(const LoggingLevel level)
+    {
+        const uint32_t enabledLevels{ enabledLevels_.load(std::memory_order_relaxed) };
+
+        return (enabledLevels & (1u << LOG_DISABLED)) == 0u && (enabledLevels & (1u << level)) != 0u;
+    }
+
 private:
 
-    void logFormatted(const std::string & logLevel,
+    //! Backend formats records the same way as synchronous logging
+    friend class AsyncLoggingBackend;
+
+    static std::string formatLine(const std::chrono::system_clock::time_point & time,
+                                  const char * instanceName,
+                                  const char * levelName,
+                                  const char * message);
+
+    void logFormatted(const char * levelName,
                       const char * message,
                       va_list args) const;
-    inline bool isEnabled(const LoggingLevel level) const;
 
 private:
 
     std::string instanceName_;
 
-    static std::map<LoggingLevel, bool> loggingLevels_;
+    //! Guarded by the registry mutex, only the first request of the sub instance builds its name
+    mutable std::vector<std::pair<std::string, Logging *>> subInstances_;
+
+    //! Bit per LoggingLevel, it's read on every logging call, so it's a relaxed atomic instead of locked container
+    static std::atomic<uint32_t> enabledLevels_;
 };
 
 
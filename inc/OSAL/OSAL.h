@@ -19,6 +19,8 @@
 #include "OSALMonitor.h"
 #include "OSALTime.h"
 #include "OSALTimeout.h"
+#include "OSALCpuTopology.h"
+#include "OSALLockProfiler.h"
 
 
 #endif // _OSAL_H_
\ No newline at end of file
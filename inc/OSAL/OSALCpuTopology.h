@@ -0,0 +1,93 @@
+#ifndef _CPUTOPOLOGY_H_
+#define _CPUTOPOLOGY_H_
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace OSAL
+{
+    /**
+     * @brief Logical CPUs of the machine with their physical core, package (socket) and shared caches.
+     *        On Linux it's read from sysfs, otherwise every hardware thread is considered as separate core of one package.
+     */
+    class CpuTopology
+    {
+    public:
+
+        static const int64_t UNKNOWN_CACHE{ -1 };
+        static const int64_t UNKNOWN_NUMA_NODE{ -1 };
+
+        struct Cpu
+        {
+            uint32_t id{ 0u };
+            uint32_t coreId{ 0u };
+            uint32_t packageId{ 0u };
+            uint32_t numaNodeId{ 0u };
+            int64_t l2CacheId{ UNKNOWN_CACHE };     ///< Lowest CPU id sharing L2 cache.
+            int64_t l3CacheId{ UNKNOWN_CACHE };     ///< Lowest CPU id sharing L3 cache.
+        };
+
+    public:
+
+        CpuTopology() = default;
+        explicit CpuTopology(const std::vector<Cpu> & cpus);
+
+        /**
+         * @param sysfsPath Root of the CPU devices, could be changed for testing.
+         * @param nodeSysfsPath Root of the NUMA node devices, without it all CPUs belong to node 0.
+         */
+        static CpuTopology read(const std::string & sysfsPath = "/sys/devices/system/cpu",
+                                const std::string & nodeSysfsPath = "/sys/devices/system/node");
+
+        /**
+         * @brief Parses kernel CPU list format, e.g. "0-3,8,10-11".
+         */
+        static std::vector<uint32_t> parseCpuList(const std::string & cpuList);
+
+        const std::vector<Cpu> & getCpus() const;
+        size_t getSize() const;
+        const Cpu * findCpu(const uint32_t id) const;
+        bool areSharingCache(const int64_t firstCpuId, const int64_t secondCpuId) const;
+
+        /**
+         * @return NUMA nodes in ascending order.
+         */
+        std::vector<uint32_t> getNumaNodes() const;
+
+        /**
+         * @return NUMA node of the CPU or UNKNOWN_NUMA_NODE if there is no such CPU.
+         */
+        int64_t getNumaNode(const int64_t cpuId) const;
+
+        /**
+         * @brief Hardware threads of one core, then cores of one package, then next package.
+         */
+        std::vector<uint32_t> getCompactOrder() const;
+
+        /**
+         * @brief Spreads CPUs over packages first, then over cores of package, then over hardware threads of core.
+         */
+        std::vector<uint32_t> getScatterOrder() const;
+
+        /**
+         * @brief One hardware thread of every physical core in compact order.
+         */
+        std::vector<uint32_t> getPhysicalCoresOrder() const;
+
+    private:
+
+        static bool readFile(const std::string & path, std::string & content);
+        static bool readNumber(const std::string & path, uint32_t & number);
+
+        std::vector<Cpu> getCpusInCompactOrder() const;
+
+    private:
+
+        std::vector<Cpu> cpus_;
+    };
+} // OSAL namespace
+
+#endif // _CPUTOPOLOGY_H_
@@ -0,0 +1,120 @@
+#ifndef _LOCKPROFILER_H_
+#define _LOCKPROFILER_H_
+
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace OSAL
+{
+    /**
+     * @brief Contention statistic of named locks, it's filled by OSAL::Mutex built with THREAD_POOL_LOCK_PROFILING.
+     *        Locks with the same name (name of their Logging instance) share the statistic, e.g. all workers waiting time mutexes.
+     *        Every thread records into its own slots with relaxed stores, so profiling doesn't add shared writes to the locks.
+     */
+    class LockProfiler
+    {
+    public:
+
+        static const uint32_t MAX_NUMBER_OF_LOCKS{ 256u };
+        static const uint32_t INVALID_LOCK_ID{ MAX_NUMBER_OF_LOCKS };
+
+        struct LockStatistic
+        {
+            std::string name;
+            uint64_t numberOfAcquisitions{ 0u };
+            uint64_t numberOfContendedAcquisitions{ 0u };   ///< Lock was taken by another thread at the moment of acquisition.
+            uint64_t totalWaitTime{ 0u };                   ///< Nanoseconds.
+            uint64_t maxWaitTime{ 0u };                     ///< Nanoseconds.
+            uint64_t totalHoldTime{ 0u };                   ///< Nanoseconds.
+            uint64_t maxHoldTime{ 0u };                     ///< Nanoseconds.
+        };
+
+        static LockProfiler & getInstance();
+
+        /**
+         * @return True if OSAL::Mutex is built with the profiling.
+         */
+        static bool isEnabled();
+
+        /**
+         * @return Steady clock nanoseconds used for wait and hold times.
+         */
+        static uint64_t getCurrentTime();
+
+        LockProfiler(const LockProfiler &) = delete;
+        LockProfiler & operator=(const LockProfiler &) = delete;
+
+        /**
+         * @return Id shared by all locks with the name, INVALID_LOCK_ID if there are already MAX_NUMBER_OF_LOCKS names.
+         */
+        uint32_t registerLock(const std::string & name);
+
+        void recordAcquisition(const uint32_t lockId, const bool isContended, const uint64_t waitTime);
+        void recordRelease(const uint32_t lockId, const uint64_t holdTime);
+
+        /**
+         * @brief Sums slots of all threads, including already finished ones.
+         * @return Statistic of registered locks ordered by total wait time, the most waited lock is the first.
+         */
+        std::vector<LockStatistic> getStatistics() const;
+
+        /**
+         * @return Table of getStatistics with times in microseconds.
+         */
+        std::string getReport() const;
+
+    private:
+
+        struct Slot
+        {
+            std::atomic<uint64_t> numberOfAcquisitions;
+            std::atomic<uint64_t> numberOfContendedAcquisitions;
+            std::atomic<uint64_t> totalWaitTime;
+            std::atomic<uint64_t> maxWaitTime;
+            std::atomic<uint64_t> totalHoldTime;
+            std::atomic<uint64_t> maxHoldTime;
+        };
+
+        //! Written only by its thread, it's read by getStatistics at any moment
+        struct ThreadSlots
+        {
+            ThreadSlots();
+
+            std::unique_ptr<Slot[]> slots;
+        };
+
+        //! Slots of the finished thread are added to the statistic of finished threads
+        struct ThreadSlotsOwner
+        {
+            ~ThreadSlotsOwner();
+
+            std::shared_ptr<ThreadSlots> threadSlots;
+        };
+
+    private:
+
+        LockProfiler();
+
+        Slot * getCurrentThreadSlot(const uint32_t lockId);
+
+        static void addSlots(const ThreadSlots & threadSlots, std::vector<LockStatistic> & statistics);
+
+    private:
+
+        mutable std::mutex mutex_;
+        std::vector<std::string> names_;
+        std::vector<std::shared_ptr<ThreadSlots>> threadsSlots_;
+        std::vector<LockStatistic> finishedThreadsStatistics_;
+
+        static thread_local ThreadSlotsOwner currentThreadSlotsOwner_;
+    };
+} // OSAL namespace
+
+
+#endif // _LOCKPROFILER_H_
@@ -16,6 +16,7 @@ namespace OSAL
 
     protected:
 
+        //! @param logging Not owned handle, it must outlive the thread object.
         ManagedThread(Logging * logging = nullptr);
         ~ManagedThread() override = default;
 
@@ -11,6 +11,7 @@ namespace OSAL
     {
     public:
 
+        //! @param logging Not owned handle, it must outlive the monitor.
         Monitor(Logging* logging = nullptr);
 
         Result wait(const int64_t timeout = -1);
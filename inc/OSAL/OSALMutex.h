@@ -13,6 +13,7 @@ namespace OSAL
     {
     public:
 
+        //! @param logging Not owned handle, e.g. Logging::getInstance, it must outlive the mutex.
         Mutex(Logging * logging = nullptr);
         virtual ~Mutex();
 
@@ -21,9 +22,25 @@ namespace OSAL
 
     protected:
 
+#ifdef THREAD_POOL_LOCK_PROFILING
+        void recordLocked(const bool isContended, const uint64_t waitTime);
+        void recordUnlocking();
+
+        //! Holding starts again without a new acquisition, e.g. when the monitor reacquires the mutex after waiting
+        void recordRelocked();
+#endif
+
+    protected:
+
         std::timed_mutex mutex_;
         std::atomic<bool> isLocked_;
-        std::unique_ptr<Logging> logging_;
+        Logging * logging_;
+
+#ifdef THREAD_POOL_LOCK_PROFILING
+        //! Id of the name in OSAL::LockProfiler and start of holding, which is written only by the owner of the lock
+        uint32_t lockProfilerId_;
+        uint64_t lockedTime_;
+#endif
 
     };
 } // OSAL namespace
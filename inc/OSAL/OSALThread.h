@@ -22,6 +22,9 @@ namespace OSAL
             PAUSED          ///< Paused state. When worker is paused.
         };
 
+        static const int64_t NO_AFFINITY{ -1 };
+
+        //! @param logging Not owned handle, e.g. Logging::getInstance, it must outlive the thread object.
         Thread(Logging * logging = nullptr);
         virtual ~Thread();
 
@@ -31,12 +34,28 @@ namespace OSAL
         uint64_t getId() const;
         State getState() const;
 
+        /**
+         * @brief Pins thread to the CPU, it's applied when thread is created.
+         * @param cpu CPU id or NO_AFFINITY to let OS schedule thread on any CPU.
+         */
+        void setAffinity(const int64_t cpu);
+        int64_t getAffinity() const;
+
         static void delay(const uint64_t timeout);
 
+        /**
+         * @return CPU time consumed by the calling thread in microseconds, 0 if platform doesn't provide it.
+         */
+        static uint64_t getCurrentThreadCpuTime();
+
     protected:
 
         virtual void run() = 0;
 
+    private:
+
+        Result applyAffinity();
+
     protected:
 
         uint64_t id_;
@@ -46,7 +65,8 @@ namespace OSAL
         mutable OSAL::Monitor finishedMonitor_;
         mutable OSAL::Monitor stateMonitor_;
         State state_;
-        std::unique_ptr<Logging> logging_;
+        int64_t affinity_;
+        Logging * logging_;
     };
 }
 
@@ -21,6 +21,11 @@ namespace OSAL
 
         static uint64_t getElapsedTime(const uint64_t startTime, const uint64_t endTime);
 
+        /**
+         * @return Current time of monotonic clock in microseconds. Suitable only for measuring intervals.
+         */
+        static uint64_t getCurrentTime();
+
     private:
 
         std::chrono::steady_clock::time_point startTime_;
@@ -0,0 +1,33 @@
+#ifndef _RELAXEDCOUNTER_H_
+#define _RELAXEDCOUNTER_H_
+
+#include <atomic>
+#include <cstdint>
+
+
+/**
+ * @brief 64-bit statistic counter, which can be read at any moment without locks.
+ *        Relaxed ordering is used, since counters don't guard any other data.
+ */
+class RelaxedCounter
+{
+public:
+
+    RelaxedCounter() : value_{ 0u } { }
+
+    RelaxedCounter(const RelaxedCounter &) = delete;
+    RelaxedCounter & operator=(const RelaxedCounter &) = delete;
+
+    inline uint64_t load() const                        { return value_.load(std::memory_order_relaxed); }
+    inline void reset()                                 { value_.store(0u, std::memory_order_relaxed); }
+
+    inline RelaxedCounter & operator++()                { value_.fetch_add(1u, std::memory_order_relaxed); return *this; }
+    inline RelaxedCounter & operator+=(const uint64_t value) { value_.fetch_add(value, std::memory_order_relaxed); return *this; }
+
+private:
+
+    std::atomic<uint64_t> value_;
+};
+
+
+#endif // _RELAXEDCOUNTER_H_
@@ -0,0 +1,74 @@
+#ifndef _FAIRSHARETASKSCHEDULER_H_
+#define _FAIRSHARETASKSCHEDULER_H_
+
+
+#include <map>
+#include <unordered_map>
+
+#include "TaskSchedulerBase.h"
+#include "TenantTask.h"
+
+
+/**
+ * @brief Deficit round robin over the tenants (TenantTask::getTenant), every tenant has own FCFS queue.
+ *        Tenant with weight W gets W tasks for execution per round, so flooding tenant can't starve the others.
+ *        Tenants without configured weight and tasks, which aren't TenantTask, have weight 1.
+ */
+class FairShareTaskScheduler : public TaskSchedulerBase
+{
+public:
+
+    static const uint32_t DEFAULT_WEIGHT{ 1u };
+
+public:
+
+    /**
+     * @param tenantWeights Weights of tenants, tenants not in the map have DEFAULT_WEIGHT.
+     * @param logging Not owned handle, it must outlive the scheduler.
+     */
+    explicit FairShareTaskScheduler(const std::map<std::string, uint32_t> & tenantWeights = {}, Logging * logging = nullptr);
+
+public:
+
+    size_t getSize() const override;
+    Result waitTaskForExecution(const int64_t timeout = -1ll) const override;
+    bool isScheduled(const uint64_t taskId) const override;
+
+    std::shared_ptr<IThreadPoolTask> getTaskForExecution() override;
+    std::shared_ptr<IThreadPoolTask> steal() override;
+    Result schedule(const std::shared_ptr<IThreadPoolTask> task) override;
+    Result schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) override;
+    std::shared_ptr<IThreadPoolTask> unscheduleOne(const uint64_t taskId) override;
+    std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll() override;
+    std::shared_ptr<IThreadPoolTask> unscheduleOldest() override;
+    Result clearAll() override;
+
+private:
+
+    struct TenantQueue
+    {
+        std::deque<std::shared_ptr<IThreadPoolTask>> tasks;
+        uint32_t weight{ DEFAULT_WEIGHT };
+        uint32_t deficit{ 0u };
+    };
+
+private:
+
+    void scheduleInternal(const std::shared_ptr<IThreadPoolTask> & task);
+    void deactivateIfEmpty(TenantQueue & tenantQueue);
+
+    //! Reclaims canceled tasks at the front of every tenant queue, so fronts of active tenants are always alive
+    void reclaimTombstones();
+    void publishDepth();
+
+private:
+
+    std::map<std::string, uint32_t> tenantWeights_;
+    std::unordered_map<std::string, TenantQueue> tenantToTasksMap_;
+
+    //! Round robin order of the tenants with scheduled tasks, queues are never erased from the map, so pointers stay valid
+    std::deque<TenantQueue *> activeTenants_;
+    size_t size_;
+};
+
+#endif // _FAIRSHARETASKSCHEDULER_H_
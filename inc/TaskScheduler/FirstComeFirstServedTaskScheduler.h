@@ -9,6 +9,7 @@ class FirstComeFirstServedTaskScheduler : public TaskSchedulerBase
 {
 public:
 
+    //! @param logging Not owned handle, it must outlive the scheduler.
     explicit FirstComeFirstServedTaskScheduler(Logging * logging = nullptr);
 
 public:
@@ -23,8 +24,13 @@ public:
     Result schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) override;
     std::shared_ptr<IThreadPoolTask> unscheduleOne(const uint64_t taskId) override;
     std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll() override;
+    std::shared_ptr<IThreadPoolTask> unscheduleOldest() override;
     Result clearAll() override;
 
+private:
+
+    void publishDepth();
+
 private:
 
     std::deque<std::shared_ptr<IThreadPoolTask>> tasks_;
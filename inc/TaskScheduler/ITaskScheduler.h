@@ -11,10 +11,11 @@ public:
 
     struct Statistic
     {
-        uint32_t totalNumberOfScheduledTasks{ 0u };
-        uint32_t totalNumberOfUnscheduledTasks{ 0u };
-        uint32_t totalNumberOfStolenTasks{ 0u };
-        uint32_t totalNumberOfGotForExecutionTasks{ 0u };
+        uint64_t totalNumberOfScheduledTasks{ 0u };
+        uint64_t totalNumberOfUnscheduledTasks{ 0u };
+        uint64_t totalNumberOfStolenTasks{ 0u };
+        uint64_t totalNumberOfGotForExecutionTasks{ 0u };
+        uint64_t totalNumberOfReclaimedTasks{ 0u };        ///< Canceled tasks (tombstones) removed from the queues.
 
     public:
 
@@ -23,7 +24,8 @@ public:
             return "Total number of scheduled tasks : "             + std::to_string(totalNumberOfScheduledTasks)
                  + "\nTotal number of unscheduled tasks : "         + std::to_string(totalNumberOfUnscheduledTasks)
                  + "\nTotal number of stolen tasks : "              + std::to_string(totalNumberOfStolenTasks)
-                 + "\nTotal number of got for execution tasks : "   + std::to_string(totalNumberOfGotForExecutionTasks);
+                 + "\nTotal number of got for execution tasks : "   + std::to_string(totalNumberOfGotForExecutionTasks)
+                 + "\nTotal number of reclaimed tasks : "           + std::to_string(totalNumberOfReclaimedTasks);
         }
     };
 
@@ -32,6 +34,21 @@ public:
     virtual uint64_t getId() const = 0;
     virtual Statistic getStatistic() const = 0;
     virtual size_t getSize() const = 0;
+
+    /**
+     * @brief Lock-free approximations of getSize() and of the estimated work of scheduled tasks.
+     *        Values are published after every change of the scheduled tasks, so they may lag behind
+     *        the exact state by the changes, which are in progress at the moment of reading.
+     */
+    virtual size_t getApproximateSize() const = 0;
+    virtual uint64_t getApproximateWork() const = 0;
+
+    /**
+     * @return Added time (IThreadPoolTask::getAddedTime) of the longest waiting task, 0 if there are no tasks.
+     *         Published the same way as getApproximateSize().
+     */
+    virtual uint64_t getApproximateOldestTaskAddedTime() const = 0;
+
     virtual Result waitTaskForExecution(const int64_t timeout = -1ll) const = 0;
     virtual void notifyTaskForExecution() const = 0;
     virtual bool isScheduled(const uint64_t taskId) const = 0;
@@ -41,6 +58,11 @@ public:
     virtual Result schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) = 0;
     virtual std::shared_ptr<IThreadPoolTask> unscheduleOne(const uint64_t taskId) = 0;
     virtual std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll() = 0;
+
+    /**
+     * @brief Unschedules the longest waiting task (by IThreadPoolTask::getAddedTime) regardless of scheduling order.
+     */
+    virtual std::shared_ptr<IThreadPoolTask> unscheduleOldest() = 0;
     virtual Result clearAll() = 0;
 };
 
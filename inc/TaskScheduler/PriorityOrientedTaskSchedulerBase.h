@@ -9,6 +9,7 @@ class PriorityOrientedTaskSchedulerBase : public TaskSchedulerBase
 {
 protected:
 
+    //! @param logging Not owned handle, it must outlive the scheduler.
     explicit PriorityOrientedTaskSchedulerBase(Logging * logging  = nullptr) : TaskSchedulerBase{ logging } { }
 
     template<typename Key, template <typename, typename...> class Container, typename Value, typename... Parameters>
@@ -32,8 +33,23 @@ protected:
     std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll(
         std::unordered_map<Key, Container<std::shared_ptr<IThreadPoolTask>, Parameters...>> & priorityToTasksMap);
 
+    template<typename Key, template <typename, typename...> class Container, typename... Parameters>
+    std::shared_ptr<IThreadPoolTask> unscheduleOldest(
+        std::unordered_map<Key, Container<std::shared_ptr<IThreadPoolTask>, Parameters...>> & priorityToTasksMap);
+
     template<typename Key, template <typename, typename...> class Container, typename... Parameters>
     Result clearAll(std::unordered_map<Key, Container<std::shared_ptr<IThreadPoolTask>, Parameters...>> & priorityToTasksMap);
+
+    /**
+     * @note It must be called with the tasksMonitor_ locked.
+     */
+    template<typename Key, template <typename, typename...> class Container, typename Value, typename... Parameters>
+    void publishDepth(const std::unordered_map<Key, Container<Value, Parameters...>> & priorityToTasksMap);
+
+    /**
+     * @return Estimated work of one task with given priority (key of tasks map). Every task costs the same by default.
+     */
+    virtual uint64_t getTaskWork(const uint8_t /*priority*/) const { return 1u; }
 };
 
 
@@ -53,6 +69,8 @@ size_t PriorityOrientedTaskSchedulerBase::getSize(const std::unordered_map<Key,
         size += priorityToTasksIt.second.size();
     }
 
+    size = excludeTombstones(size);
+
     tasksMonitor_.unlock();
 
     return size;
@@ -64,16 +82,18 @@ Result PriorityOrientedTaskSchedulerBase::waitTaskForExecution(const std::unorde
                                                                const int64_t timeout) const
 {
     Result result{ Result::OK };
-    bool isTasksEmpty{ true };
+    size_t size{ 0u };
 
     tasksMonitor_.lock();
 
     for (const auto & priorityToTasksIt : priorityToTasksMap)
     {
-        isTasksEmpty &= priorityToTasksIt.second.empty();
+        // cppcheck-suppress useStlAlgorithm
+        size += priorityToTasksIt.second.size();
     }
 
-    if (isTasksEmpty)
+    // Tombstones aren't waited for, they are reclaimed by the next dequeue
+    if (0u == excludeTombstones(size))
     {
         isNewTaskScheduled_ = false;
         OSAL::Timeout waitTimeout{ timeout };
@@ -132,13 +152,16 @@ std::shared_ptr<IThreadPoolTask> PriorityOrientedTaskSchedulerBase::unscheduleOn
         {
             unscheduledTask = std::move(*foundTaskIt);
             priorityToTasksIt.second.erase(foundTaskIt);
+            detachTask(unscheduledTask);
 
-            statistic_.totalNumberOfUnscheduledTasks++;
+            ++statistic_.value.totalNumberOfUnscheduledTasks;
 
             break;
         }
     }
 
+    publishDepth(priorityToTasksMap);
+
     tasksMonitor_.unlock();
 
     return unscheduledTask;
@@ -155,21 +178,53 @@ std::vector<std::shared_ptr<IThreadPoolTask>> PriorityOrientedTaskSchedulerBase:
 
     for (auto && priorityToTasksIt : priorityToTasksMap)
     {
-        if (!priorityToTasksIt.second.empty())
-        {
-            unscheduledTasks.insert(unscheduledTasks.end(),
-                    std::make_move_iterator(priorityToTasksIt.second.begin()),
-                    std::make_move_iterator(priorityToTasksIt.second.end()));
+        unscheduleTasks(priorityToTasksIt.second, &unscheduledTasks);
+    }
+
+    publishDepth(priorityToTasksMap);
+
+    tasksMonitor_.unlock();
 
-            statistic_.totalNumberOfUnscheduledTasks += static_cast<uint32_t>(priorityToTasksIt.second.size());
+    return unscheduledTasks;
+}
 
-            priorityToTasksIt.second.clear();
+
+template<typename Key, template <typename, typename...> class Container, typename... Parameters>
+std::shared_ptr<IThreadPoolTask> PriorityOrientedTaskSchedulerBase::unscheduleOldest(
+                                    std::unordered_map<Key, Container<std::shared_ptr<IThreadPoolTask>, Parameters...>> & priorityToTasksMap)
+{
+    std::shared_ptr<IThreadPoolTask> unscheduledTask{};
+
+    tasksMonitor_.lock();
+
+    Container<std::shared_ptr<IThreadPoolTask>, Parameters...> * oldestTasks{ nullptr };
+
+    // Tasks of one priority are kept in order of adding, so only front ones are compared
+    for (auto && priorityToTasksIt : priorityToTasksMap)
+    {
+        reclaimFrontTombstones(priorityToTasksIt.second);
+
+        if (!priorityToTasksIt.second.empty() &&
+            (nullptr == oldestTasks || priorityToTasksIt.second.front()->getAddedTime() < oldestTasks->front()->getAddedTime()))
+        {
+            oldestTasks = &priorityToTasksIt.second;
         }
     }
 
+    if (oldestTasks != nullptr)
+    {
+        unscheduledTask = std::move(oldestTasks->front());
+        oldestTasks->pop_front();
+        detachTask(unscheduledTask);
+
+        ++statistic_.value.totalNumberOfUnscheduledTasks;
+    }
+
+    publishDepth(priorityToTasksMap);
+
     tasksMonitor_.unlock();
 
-    return unscheduledTasks;
+    return unscheduledTask;
 }
 
 
@@ -182,20 +237,47 @@ Result PriorityOrientedTaskSchedulerBase::clearAll(std::unordered_map<Key, Conta
 
     for (auto && priorityToTasksIt : priorityToTasksMap)
     {
-        if (!priorityToTasksIt.second.empty())
+        if (unscheduleTasks(priorityToTasksIt.second, nullptr) != 0u)
         {
-            statistic_.totalNumberOfUnscheduledTasks += static_cast<uint32_t>(priorityToTasksIt.second.size());
-
-            priorityToTasksIt.second.clear();
-
             isAllEmpty = false;
         }
     }
 
+    publishDepth(priorityToTasksMap);
+
     tasksMonitor_.unlock();
 
     return isAllEmpty ? Result::ERROR : Result::OK;
 }
 
+template<typename Key, template <typename, typename...> class Container, typename Value, typename... Parameters>
+void PriorityOrientedTaskSchedulerBase::publishDepth(const std::unordered_map<Key, Container<Value, Parameters...>> & priorityToTasksMap)
+{
+    size_t size{ 0u };
+    uint64_t work{ 0u };
+    uint64_t oldestTaskAddedTime{ 0u };
+
+    for (const auto & priorityToTasksIt : priorityToTasksMap)
+    {
+        if (priorityToTasksIt.second.empty())
+        {
+            continue;
+        }
+
+        size += priorityToTasksIt.second.size();
+        work += priorityToTasksIt.second.size() * getTaskWork(static_cast<uint8_t>(priorityToTasksIt.first));
+
+        // Tasks of one priority are served in order of adding, so the front one waits the longest
+        const uint64_t addedTime{ priorityToTasksIt.second.front()->getAddedTime() };
+        if (oldestTaskAddedTime == 0u || (addedTime != 0u && addedTime < oldestTaskAddedTime))
+        {
+            oldestTaskAddedTime = addedTime;
+        }
+    }
+
+    // Work of tombstones is included until they are reclaimed, their priorities aren't tracked
+    TaskSchedulerBase::publishDepth(size, work, oldestTaskAddedTime);
+}
+
 #endif // _PRIORITYORIENTEDTASKSCHEDULERBASE_H_
 
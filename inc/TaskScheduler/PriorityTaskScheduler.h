@@ -10,6 +10,7 @@ class PriorityTaskScheduler : public PriorityOrientedTaskSchedulerBase
 {
 public:
 
+    //! @param logging Not owned handle, it must outlive the scheduler.
     explicit PriorityTaskScheduler(Logging * logging = nullptr);
 
 public:
@@ -24,6 +25,7 @@ public:
     Result schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) override;
     std::shared_ptr<IThreadPoolTask> unscheduleOne(const uint64_t taskId) override;
     std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll() override;
+    std::shared_ptr<IThreadPoolTask> unscheduleOldest() override;
     Result clearAll() override;
 
 private:
@@ -10,6 +10,7 @@ class ShortestJobFirstTaskScheduler : public PriorityOrientedTaskSchedulerBase
 {
 public:
 
+    //! @param logging Not owned handle, it must outlive the scheduler.
     explicit ShortestJobFirstTaskScheduler(Logging * logging = nullptr);
 
 public:
@@ -24,11 +25,13 @@ public:
     Result schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) override;
     std::shared_ptr<IThreadPoolTask> unscheduleOne(const uint64_t taskId) override;
     std::vector<std::shared_ptr<IThreadPoolTask>> unscheduleAll() override;
+    std::shared_ptr<IThreadPoolTask> unscheduleOldest() override;
     Result clearAll() override;
 
 private:
 
     BurstTime calculateBurstTime(BurstTime burstTime) const;
+    uint64_t getTaskWork(const uint8_t burstTime) const override;
 
 private:
 
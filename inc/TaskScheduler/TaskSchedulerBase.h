@@ -2,7 +2,11 @@
 #define _TASKSCHEDULERBASE_H_
 
 
+#include <atomic>
+
 #include "ITaskScheduler.h"
+#include "CacheLinePadded.h"
+#include "RelaxedCounter.h"
 #include "Logging.h"
 
 
@@ -12,6 +16,7 @@ public:
 
     /**
      * @note Make sure iterator has std::shared_ptr<IThreadPoolTask> value inside.
+     *       Canceled tasks (tombstones) are skipped, since they aren't scheduled any more.
      */
     template<typename Iterator>
     static Iterator findTaskById(Iterator beginIt, Iterator endIt, const uint64_t taskId);
@@ -33,22 +38,91 @@ public:
 
     uint64_t getId() const override;
     Statistic getStatistic() const override;
+    size_t getApproximateSize() const override;
+    uint64_t getApproximateWork() const override;
+    uint64_t getApproximateOldestTaskAddedTime() const override;
     void notifyTaskForExecution() const override;
 
 protected:
 
+    /**
+     * @param logging Not owned handle, e.g. Logging::getInstance, it must outlive the scheduler.
+     */
     explicit TaskSchedulerBase(Logging * logging = nullptr);
 
+    /**
+     * @note It must be called with the tasksMonitor_ locked after every change of scheduled tasks.
+     */
+    void publishDepth(const size_t size, const uint64_t work, const uint64_t oldestTaskAddedTime);
+
+    /**
+     * @brief Task is attached to the tombstones counter, when it enters queues of the scheduler, and detached, when it leaves them.
+     * @note It must be called with the tasksMonitor_ locked.
+     */
+    void attachTask(const std::shared_ptr<IThreadPoolTask> & task);
+    void detachTask(const std::shared_ptr<IThreadPoolTask> & task);
+
+    /**
+     * @return Number of tasks in queues, which aren't canceled.
+     * @note It must be called with the tasksMonitor_ locked.
+     */
+    size_t excludeTombstones(const size_t size) const;
+
+    /**
+     * @brief Canceled tasks at the front (back) of the container are lazily reclaimed when scheduler dequeues from that end.
+     * @return Number of reclaimed tasks.
+     * @note It must be called with the tasksMonitor_ locked.
+     */
+    template<typename Container>
+    size_t reclaimFrontTombstones(Container & tasks);
+
+    template<typename Container>
+    size_t reclaimBackTombstones(Container & tasks);
+
+    /**
+     * @brief Detaches all tasks of the container and clears it. Canceled tasks are reclaimed, the others are unscheduled.
+     * @param unscheduledTasks Receives unscheduled tasks, if it isn't nullptr.
+     * @return Number of unscheduled tasks.
+     * @note It must be called with the tasksMonitor_ locked.
+     */
+    template<typename Container>
+    size_t unscheduleTasks(Container & tasks, std::vector<std::shared_ptr<IThreadPoolTask>> * unscheduledTasks);
+
 protected:
 
-    mutable ITaskScheduler::Statistic statistic_;
+    //! Counters are modified under tasksMonitor_, but read by getStatistic without any lock
+    struct AtomicStatistic
+    {
+        RelaxedCounter totalNumberOfScheduledTasks;
+        RelaxedCounter totalNumberOfUnscheduledTasks;
+        RelaxedCounter totalNumberOfStolenTasks;
+        RelaxedCounter totalNumberOfGotForExecutionTasks;
+        RelaxedCounter totalNumberOfReclaimedTasks;
+    };
+
+protected:
+
+    CacheLinePadded<AtomicStatistic> statistic_;
     mutable OSAL::Monitor tasksMonitor_;
     mutable bool isNewTaskScheduled_;
-    std::unique_ptr<Logging> logging_;
+    Logging * logging_;
 
 private:
 
+    struct Depth
+    {
+        std::atomic<size_t> size;
+        std::atomic<uint64_t> work;
+        std::atomic<uint64_t> oldestTaskAddedTime;
+    };
+
     uint64_t id_;
+
+    //! Shared with attached tasks, since canceled task may outlive the scheduler
+    std::shared_ptr<IThreadPoolTask::TombstonesCounter> tombstonesCounter_;
+
+    //! Read by the pool without locks, so it's kept away from the data guarded by tasksMonitor_
+    CacheLinePadded<Depth> depth_;
 };
 
 
@@ -60,7 +134,7 @@ Iterator TaskSchedulerBase::findTaskById(Iterator beginIt, Iterator endIt, const
     const auto foundTaskIt = std::find_if(beginIt, endIt,
                                     [&taskId] (const std::shared_ptr<IThreadPoolTask> & task)
                                     {
-                                        return task->getId() == taskId;
+                                        return task->getId() == taskId && task->getState() != IThreadPoolTask::State::CANCELED;
                                     });
     return foundTaskIt;
 }
@@ -86,5 +160,72 @@ Iterator TaskSchedulerBase::partitionTasksById(Iterator && beginIt, Iterator &&
 }
 
 
+template<typename Container>
+size_t TaskSchedulerBase::reclaimFrontTombstones(Container & tasks)
+{
+    size_t numberOfReclaimedTasks{ 0u };
+
+    while (!tasks.empty() && tasks.front()->getState() == IThreadPoolTask::State::CANCELED)
+    {
+        detachTask(tasks.front());
+        tasks.pop_front();
+
+        ++numberOfReclaimedTasks;
+    }
+
+    statistic_.value.totalNumberOfReclaimedTasks += static_cast<uint64_t>(numberOfReclaimedTasks);
+
+    return numberOfReclaimedTasks;
+}
+
+
+template<typename Container>
+size_t TaskSchedulerBase::reclaimBackTombstones(Container & tasks)
+{
+    size_t numberOfReclaimedTasks{ 0u };
+
+    while (!tasks.empty() && tasks.back()->getState() == IThreadPoolTask::State::CANCELED)
+    {
+        detachTask(tasks.back());
+        tasks.pop_back();
+
+        ++numberOfReclaimedTasks;
+    }
+
+    statistic_.value.totalNumberOfReclaimedTasks += static_cast<uint64_t>(numberOfReclaimedTasks);
+
+    return numberOfReclaimedTasks;
+}
+
+
+template<typename Container>
+size_t TaskSchedulerBase::unscheduleTasks(Container & tasks, std::vector<std::shared_ptr<IThreadPoolTask>> * unscheduledTasks)
+{
+    size_t numberOfUnscheduledTasks{ 0u };
+
+    for (auto && taskIt : tasks)
+    {
+        detachTask(taskIt);
+
+        if (taskIt->getState() != IThreadPoolTask::State::CANCELED)
+        {
+            if (unscheduledTasks != nullptr)
+            {
+                unscheduledTasks->emplace_back(std::move(taskIt));
+            }
+
+            ++numberOfUnscheduledTasks;
+        }
+    }
+
+    statistic_.value.totalNumberOfUnscheduledTasks += static_cast<uint64_t>(numberOfUnscheduledTasks);
+    statistic_.value.totalNumberOfReclaimedTasks += static_cast<uint64_t>(tasks.size() - numberOfUnscheduledTasks);
+
+    tasks.clear();
+
+    return numberOfUnscheduledTasks;
+}
+
+
 #endif // _TASKSCHEDULERBASE_H_
 
@@ -0,0 +1,215 @@
+#ifndef _TASKSCHEDULERPOLICIES_H_
+#define _TASKSCHEDULERPOLICIES_H_
+
+
+#include <deque>
+#include <functional>
+#include <utility>
+
+#include "BurstTimeTask.h"
+#include "PriorityTask.h"
+
+
+/**
+ * @brief Compile-time scheduling policies of BasicThreadPool.
+ *        Policy is a plain queue of tasks by value: it has no virtual methods, no locks (owner guards it)
+ *        and no casts, so schedule and getTaskForExecution are inlined into the thread pool.
+ *        Policy interface:
+ *          void schedule(TaskType && task);
+ *          bool getTaskForExecution(TaskType & task);     // false if there are no tasks
+ *          size_t getSize() const;
+ *          bool isEmpty() const;
+ */
+
+
+/**
+ * @brief Tasks are executed in the order of adding. Any callable type can be used as the task.
+ */
+template <typename TaskType>
+class FirstComeFirstServedPolicy
+{
+public:
+
+    inline void schedule(TaskType && task)
+    {
+        tasks_.push_back(std::move(task));
+    }
+
+    inline bool getTaskForExecution(TaskType & task)
+    {
+        if (tasks_.empty())
+        {
+            return false;
+        }
+
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        return true;
+    }
+
+    inline size_t getSize() const       { return tasks_.size(); }
+    inline bool isEmpty() const         { return tasks_.empty(); }
+
+private:
+
+    std::deque<TaskType> tasks_;
+};
+
+
+/**
+ * @brief Tasks with higher priority are executed first, tasks with the same priority in the order of adding.
+ *        Task type must provide "Priority getPriority() const", e.g. BasicPriorityTask.
+ */
+template <typename TaskType>
+class PriorityPolicy
+{
+public:
+
+    PriorityPolicy() : size_{ 0u } { }
+
+    inline void schedule(TaskType && task)
+    {
+        Priority priority{ task.getPriority() };
+
+        // Unknown priority would never be served, so it's scheduled as normal one
+        if (priority <= Priority::FIRST_PRIORITIES_POSITION || priority >= Priority::LAST_PRIORITIES_POSITION)
+        {
+            priority = Priority::NORMAL;
+        }
+
+        tasks_[priority].push_back(std::move(task));
+        ++size_;
+    }
+
+    inline bool getTaskForExecution(TaskType & task)
+    {
+        // Iterate from highest to lowest priority
+        for (auto priority = ++Priority::FIRST_PRIORITIES_POSITION;
+                  priority < Priority::LAST_PRIORITIES_POSITION; ++priority)
+        {
+            std::deque<TaskType> & tasks = tasks_[priority];
+
+            if (!tasks.empty())
+            {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                --size_;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline size_t getSize() const       { return size_; }
+    inline bool isEmpty() const         { return 0u == size_; }
+
+private:
+
+    std::deque<TaskType> tasks_[Priority::LAST_PRIORITIES_POSITION];
+    size_t size_;
+};
+
+
+/**
+ * @brief Tasks with shorter burst time are executed first, tasks with the same burst time in the order of adding.
+ *        Task type must provide "BurstTime getBurstTime() const", e.g. BasicBurstTimeTask.
+ * @note Unlike ShortestJobFirstTaskScheduler, undefined burst time is scheduled as medium one,
+ *       so the order doesn't depend on random numbers.
+ */
+template <typename TaskType>
+class ShortestJobFirstPolicy
+{
+public:
+
+    ShortestJobFirstPolicy() : size_{ 0u } { }
+
+    inline void schedule(TaskType && task)
+    {
+        BurstTime burstTime{ task.getBurstTime() };
+
+        if (burstTime <= BurstTime::FIRST_BURST_TIMES_POSITION || burstTime >= BurstTime::LAST_BURST_TIMES_POSITION)
+        {
+            burstTime = BurstTime::MEDIUM;
+        }
+
+        tasks_[static_cast<uint8_t>(burstTime)].push_back(std::move(task));
+        ++size_;
+    }
+
+    inline bool getTaskForExecution(TaskType & task)
+    {
+        // Iterate from shortest to longest burst time
+        for (auto burstTime = ++BurstTime::FIRST_BURST_TIMES_POSITION;
+                  burstTime < BurstTime::LAST_BURST_TIMES_POSITION; ++burstTime)
+        {
+            std::deque<TaskType> & tasks = tasks_[static_cast<uint8_t>(burstTime)];
+
+            if (!tasks.empty())
+            {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+                --size_;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline size_t getSize() const       { return size_; }
+    inline bool isEmpty() const         { return 0u == size_; }
+
+private:
+
+    std::deque<TaskType> tasks_[static_cast<uint8_t>(BurstTime::LAST_BURST_TIMES_POSITION)];
+    size_t size_;
+};
+
+
+/**
+ * @brief Callable task with priority for PriorityPolicy, function is stored by value without type erasure if possible.
+ */
+template <typename Function = std::function<void()>>
+class BasicPriorityTask
+{
+public:
+
+    BasicPriorityTask() : priority_{ Priority::NORMAL }, function_{} { }
+    BasicPriorityTask(const Priority priority, Function function) : priority_{ priority }, function_(std::move(function)) { }
+
+    inline Priority getPriority() const { return priority_; }
+    inline void operator()()            { function_(); }
+
+private:
+
+    Priority priority_;
+    Function function_;
+};
+
+
+/**
+ * @brief Callable task with burst time for ShortestJobFirstPolicy.
+ */
+template <typename Function = std::function<void()>>
+class BasicBurstTimeTask
+{
+public:
+
+    BasicBurstTimeTask() : burstTime_{ BurstTime::MEDIUM }, function_{} { }
+    BasicBurstTimeTask(const BurstTime burstTime, Function function) : burstTime_{ burstTime }, function_(std::move(function)) { }
+
+    inline BurstTime getBurstTime() const   { return burstTime_; }
+    inline void operator()()                { function_(); }
+
+private:
+
+    BurstTime burstTime_;
+    Function function_;
+};
+
+
+#endif // _TASKSCHEDULERPOLICIES_H_
@@ -0,0 +1,315 @@
+#ifndef _BASICTHREADPOOL_H_
+#define _BASICTHREADPOOL_H_
+
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "CacheLinePadded.h"
+#include "Logging.h"
+#include "OSAL.h"
+#include "RelaxedCounter.h"
+#include "Result.h"
+#include "TaskSchedulerPolicies.h"
+
+
+/**
+ * @brief Header-only thread pool with scheduling policy and task type resolved at compile time.
+ *        It's meant for latency-critical components, ThreadPool stays for everyone who needs runtime configuration.
+ *        Tasks are stored by value in one policy queue guarded by one monitor: adding and taking a task are inlined,
+ *        there are no virtual calls, no dynamic casts and no per-task heap allocation for small callables.
+ *        Statistic counters are compiled out unless NeedsStatistic is true.
+ *        There are no manager thread, worker queues, load balancing and auto scaling, number of workers is fixed.
+ *
+ *        Example:
+ *              BasicThreadPool<PriorityPolicy, BasicPriorityTask<>> threadPool{ 4u };
+ *              threadPool.addTask(BasicPriorityTask<>{ Priority::HIGH, [] { ... } });
+ *              threadPool.waitAllTasksExecutionFinished();
+ *
+ * @tparam SchedulerPolicy Template of the policy from TaskSchedulerPolicies.h or own one with the same interface.
+ * @tparam TaskType Callable type, which is required by the policy (e.g. getPriority for PriorityPolicy).
+ * @tparam NeedsStatistic Counts added, executed and failed tasks, see getStatistic.
+ */
+template <template <typename> class SchedulerPolicy, typename TaskType = std::function<void()>, bool NeedsStatistic = false>
+class BasicThreadPool
+{
+public:
+
+    using Task = TaskType;
+
+    struct Statistic
+    {
+        uint64_t totalNumberOfAddedTasks{ 0u };
+        uint64_t totalNumberOfExecutedTasks{ 0u };
+        uint64_t totalNumberOfNotExecutedTasks{ 0u };   ///< Tasks, which threw an exception.
+    };
+
+public:
+
+    /**
+     * @param logging Not owned handle, e.g. Logging::getInstance, it must outlive the thread pool.
+     */
+    explicit BasicThreadPool(const uint32_t numberOfWorkers, Logging * logging = nullptr)
+        : logging_{ nullptr == logging ? Logging::getInstance("BasicThreadPool") : logging }
+        , tasksMonitor_{ logging_->getSubInstance("TasksMonitor") }
+        , finishedMonitor_{ logging_->getSubInstance("FinishedMonitor") }
+        , threadPoolMustEnd_{ false }
+        , numberOfUnfinishedTasks_{}
+    {
+        numberOfUnfinishedTasks_.value.store(0u, std::memory_order_relaxed);
+
+        for (uint32_t i = 0u; i < numberOfWorkers; ++i)
+        {
+            std::unique_ptr<Worker> worker{ new Worker{ *this, logging_ } };
+
+            if (Result::OK == worker->create())
+            {
+                workers_.push_back(std::move(worker));
+            }
+        }
+
+        LOGGING_DEBUG(logging_, "Basic thread pool is created with %" PRIu32 " workers", static_cast<uint32_t>(workers_.size()));
+    }
+
+    BasicThreadPool(const BasicThreadPool &) = delete;
+    BasicThreadPool & operator=(const BasicThreadPool &) = delete;
+
+    /**
+     * @brief Workers finish their current tasks, tasks, which are not started yet, are destroyed without execution.
+     *        Call waitAllTasksExecutionFinished before destruction to execute all of them.
+     */
+    ~BasicThreadPool()
+    {
+        tasksMonitor_.lock();
+        threadPoolMustEnd_ = true;
+        tasksMonitor_.notifyAll();
+        tasksMonitor_.unlock();
+
+        for (auto && worker : workers_)
+        {
+            worker->waitFinished(-1);
+        }
+
+        workers_.clear();
+    }
+
+    Result addTask(TaskType task)
+    {
+        if (workers_.empty())
+        {
+            return Result::ERROR;
+        }
+
+        numberOfUnfinishedTasks_.value.fetch_add(1u, std::memory_order_relaxed);
+
+        tasksMonitor_.lock();
+        tasks_.schedule(std::move(task));
+        tasksMonitor_.notify();
+        tasksMonitor_.unlock();
+
+        if (NeedsStatistic)
+        {
+            ++totalNumberOfAddedTasks_.value;
+        }
+
+        return Result::OK;
+    }
+
+    /**
+     * @brief Tasks are scheduled under one lock and all idle workers are woken up.
+     */
+    Result addTasks(std::vector<TaskType> tasks)
+    {
+        if (workers_.empty())
+        {
+            return Result::ERROR;
+        }
+
+        if (tasks.empty())
+        {
+            return Result::OK;
+        }
+
+        numberOfUnfinishedTasks_.value.fetch_add(tasks.size(), std::memory_order_relaxed);
+
+        tasksMonitor_.lock();
+
+        for (auto && task : tasks)
+        {
+            tasks_.schedule(std::move(task));
+        }
+
+        tasksMonitor_.notifyAll();
+        tasksMonitor_.unlock();
+
+        if (NeedsStatistic)
+        {
+            totalNumberOfAddedTasks_.value += tasks.size();
+        }
+
+        return Result::OK;
+    }
+
+    /**
+     * @param timeout Time in microseconds, -1 for infinite.
+     * @return Result::TIMEOUT if tasks are still being executed after timeout.
+     */
+    Result waitAllTasksExecutionFinished(const int64_t timeout = -1)
+    {
+        Result result{ Result::OK };
+
+        finishedMonitor_.lock();
+
+        OSAL::Timeout waitTimeout{ timeout };
+
+        while (Result::OK == result && numberOfUnfinishedTasks_.value.load(std::memory_order_acquire) != 0u)
+        {
+            result = finishedMonitor_.wait(waitTimeout.getRemainingTime());
+        }
+
+        finishedMonitor_.unlock();
+
+        return result;
+    }
+
+    /**
+     * @return Number of tasks, which are not taken by workers yet.
+     */
+    size_t getTasksSize() const
+    {
+        tasksMonitor_.lock();
+        const size_t size{ tasks_.getSize() };
+        tasksMonitor_.unlock();
+
+        return size;
+    }
+
+    size_t getWorkersSize() const
+    {
+        return workers_.size();
+    }
+
+    /**
+     * @return All counters are 0 if thread pool is compiled without statistic.
+     */
+    Statistic getStatistic() const
+    {
+        Statistic statistic{};
+
+        if (NeedsStatistic)
+        {
+            statistic.totalNumberOfAddedTasks       = totalNumberOfAddedTasks_.value.load();
+            statistic.totalNumberOfExecutedTasks    = totalNumberOfExecutedTasks_.value.load();
+            statistic.totalNumberOfNotExecutedTasks = totalNumberOfNotExecutedTasks_.value.load();
+        }
+
+        return statistic;
+    }
+
+private:
+
+    class Worker : public OSAL::Thread
+    {
+    public:
+
+        Worker(BasicThreadPool & threadPool, Logging * logging)
+            : OSAL::Thread{ logging->getSubInstance("Worker") }
+            , threadPool_( threadPool )
+        {
+        }
+
+    protected:
+
+        void run() override
+        {
+            threadPool_.runWorker();
+        }
+
+    private:
+
+        BasicThreadPool & threadPool_;
+    };
+
+private:
+
+    void runWorker()
+    {
+        TaskType task;
+
+        for (;;)
+        {
+            tasksMonitor_.lock();
+
+            while (!threadPoolMustEnd_ && tasks_.isEmpty())
+            {
+                tasksMonitor_.wait();
+            }
+
+            if (threadPoolMustEnd_)
+            {
+                tasksMonitor_.unlock();
+                break;
+            }
+
+            tasks_.getTaskForExecution(task);
+
+            tasksMonitor_.unlock();
+
+            executeTask(task);
+
+            // The last finished task wakes up waiters, counter is checked by them under finishedMonitor_
+            if (1u == numberOfUnfinishedTasks_.value.fetch_sub(1u, std::memory_order_acq_rel))
+            {
+                finishedMonitor_.lock();
+                finishedMonitor_.notifyAll();
+                finishedMonitor_.unlock();
+            }
+        }
+    }
+
+    void executeTask(TaskType & task)
+    {
+        try
+        {
+            task();
+
+            if (NeedsStatistic)
+            {
+                ++totalNumberOfExecutedTasks_.value;
+            }
+        }
+        catch (...)
+        {
+            LOGGING_WARNING(logging_, "Task of the basic thread pool threw an exception");
+
+            if (NeedsStatistic)
+            {
+                ++totalNumberOfNotExecutedTasks_.value;
+            }
+        }
+
+        // Captures of the executed task are released before worker goes waiting
+        task = TaskType{};
+    }
+
+private:
+
+    Logging * logging_;
+    mutable OSAL::Monitor tasksMonitor_;
+    OSAL::Monitor finishedMonitor_;
+    SchedulerPolicy<TaskType> tasks_;
+    bool threadPoolMustEnd_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    //! Producers and workers update it for every task, so it doesn't share cache line with the monitor
+    CacheLinePadded<std::atomic<size_t>> numberOfUnfinishedTasks_;
+
+    CacheLinePadded<RelaxedCounter> totalNumberOfAddedTasks_;
+    CacheLinePadded<RelaxedCounter> totalNumberOfExecutedTasks_;
+    CacheLinePadded<RelaxedCounter> totalNumberOfNotExecutedTasks_;
+};
+
+
+#endif // _BASICTHREADPOOL_H_
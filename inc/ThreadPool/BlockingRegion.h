@@ -0,0 +1,32 @@
+
+#ifndef _BLOCKINGREGION_H_
+#define _BLOCKINGREGION_H_
+
+
+#include "ThreadPoolWorker.h"
+
+
+/**
+ * @brief Scope of the blocking call inside CPU task, e.g. waiting for a file or a socket.
+ *        While it's alive thread pool runs compensation worker, so the number of workers executing CPU tasks stays the same.
+ *        Outside of the thread pool workers and inside blocking workers it does nothing.
+ */
+class BlockingRegion
+{
+public:
+
+    BlockingRegion();
+    ~BlockingRegion();
+
+    BlockingRegion(const BlockingRegion &) = delete;
+    BlockingRegion & operator=(const BlockingRegion &) = delete;
+
+    bool isCompensated() const;
+
+private:
+
+    ThreadPoolWorker * worker_;
+};
+
+
+#endif // _BLOCKINGREGION_H_
@@ -0,0 +1,109 @@
+#ifndef _FLIGHTRECORDER_H_
+#define _FLIGHTRECORDER_H_
+
+
+#include <atomic>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "CacheLinePadded.h"
+
+
+/**
+ * @brief Always-on bounded recorder of thread pool events.
+ *        Every worker slot owns a track (ring buffer of compact binary events), manager thread and producers have own tracks.
+ *        Recording is a few relaxed stores without locks or formatting, the oldest events are overwritten.
+ *        Recorded timeline is dumped as Chrome trace event JSON, which is opened by chrome://tracing and Perfetto UI.
+ */
+class FlightRecorder
+{
+public:
+
+    static const uint32_t MAX_CAPACITY_PER_TRACK{ 1u << 20u };
+
+    enum class EventType : uint8_t
+    {
+        SUBMIT,         ///< Task is added to the thread pool by producer.
+        DISPATCH,       ///< Task is given to worker by manager thread, argument is slot of the worker.
+        STEAL,          ///< Task is moved between workers by manager thread, argument is slot of the thief.
+        START,          ///< Worker starts task execution.
+        END,            ///< Worker finishes task execution.
+        PARK,           ///< Worker has nothing to execute and goes waiting.
+        UNPARK,         ///< Worker finishes waiting.
+        UNDEFINED
+    };
+
+    struct Event
+    {
+        uint64_t time{ 0u };                        ///< Microseconds of OSAL::Time::getCurrentTime.
+        uint64_t taskId{ 0u };
+        uint32_t track{ 0u };
+        uint32_t argument{ 0u };
+        EventType type{ EventType::UNDEFINED };
+    };
+
+    static std::string eventTypeToString(const EventType type);
+
+public:
+
+    /**
+     * @param numberOfWorkerTracks Tracks [0, numberOfWorkerTracks) belong to worker slots, then manager and producers tracks follow.
+     * @param capacityPerTrack Max number of kept events per track, it's rounded up to power of two and limited by
+     *        MAX_CAPACITY_PER_TRACK, 0 disables recording.
+     */
+    FlightRecorder(const uint32_t numberOfWorkerTracks, const uint32_t capacityPerTrack);
+
+    FlightRecorder(const FlightRecorder &) = delete;
+    FlightRecorder & operator=(const FlightRecorder &) = delete;
+
+    uint32_t getNumberOfTracks() const;
+    uint32_t getCapacityPerTrack() const;
+    uint32_t getManagerTrack() const;
+    uint32_t getProducersTrack() const;
+
+    /**
+     * @note Every track has single writer except producers track. Concurrent producers could only tear the event,
+     *       which is overwritten at the same moment after full wrap around of the ring.
+     */
+    void record(const uint32_t track, const EventType type, const uint64_t taskId, const uint32_t argument = 0u);
+    void record(const uint32_t track, const EventType type, const uint64_t taskId, const uint32_t argument, const uint64_t time);
+
+    /**
+     * @brief Copies events, which are not overwritten, it's safe to call it while events are recorded.
+     * @return Events ordered by track, then by recording order.
+     */
+    std::vector<Event> getEvents() const;
+
+    /**
+     * @brief Writes Chrome trace event JSON. Execution and waiting of workers become slices, other events are instant.
+     *        Submitted task is connected with its execution by the flow arrow.
+     * @param processId Process of the trace, e.g. thread pool id.
+     * @param trackNames Names of the tracks by index, default names are used for missing ones.
+     */
+    void writeChromeTrace(std::ostream & stream, const uint64_t processId, const std::vector<std::string> & trackNames = {}) const;
+
+private:
+
+    struct Entry
+    {
+        std::atomic<uint64_t> sequence;             ///< Recording index + 1 of the complete entry, 0 while entry is written.
+        std::atomic<uint64_t> time;
+        std::atomic<uint64_t> taskId;
+        std::atomic<uint64_t> info;                 ///< Type in the lowest byte, argument in the highest 32 bits.
+    };
+
+    static uint32_t roundUpToPowerOfTwo(const uint32_t value);
+
+private:
+
+    uint32_t numberOfTracks_;
+    uint32_t capacityPerTrack_;
+    std::unique_ptr<CacheLinePadded<std::atomic<uint64_t>>[]> heads_;
+    std::unique_ptr<Entry[]> entries_;
+};
+
+
+#endif // _FLIGHTRECORDER_H_
@@ -0,0 +1,24 @@
+#ifndef _IMETRICSEXPORTER_H_
+#define _IMETRICSEXPORTER_H_
+
+
+#include "Result.h"
+
+
+class IThreadPool;
+
+
+/**
+ * @brief Exporter of thread pool statistics, it's called periodically by metrics export thread of the thread pool
+ *        (see ThreadPoolOptions::setMetricsExporter) or directly by the owner, e.g. from the scrape handler.
+ */
+class IMetricsExporter
+{
+public:
+
+    virtual ~IMetricsExporter() = default;
+
+    virtual Result exportMetrics(const IThreadPool & threadPool) = 0;
+};
+
+#endif // _IMETRICSEXPORTER_H_
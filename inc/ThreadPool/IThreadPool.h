@@ -2,8 +2,11 @@
 #define _ITHREADPOOL_H_
 
 
+#include <ostream>
+
 #include "ITaskScheduler.h"
 #include "ThreadPoolOptions.h"
+#include "LatencyHistogram.h"
 
 
 class IThreadPool
@@ -19,21 +22,131 @@ public:
         uint32_t numberOfWorkersInWaitingState{ 0u };
         uint32_t numberOfWorkersInPausedState{ 0u };
 
-        uint32_t totalNumberOfAddedTasks{ 0u };
+        uint32_t currentNumberOfBlockingWorkers{ 0u };     ///< Included in current number of all workers.
+        uint32_t numberOfWorkersInBlockingRegion{ 0u };
+
+        uint64_t totalNumberOfAddedTasks{ 0u };
+        uint64_t totalNumberOfExecutedTasks{ 0u };
+        uint64_t totalNumberOfNotExecutedTasks{ 0u };      ///< Canceled or failed tasks, which were got for execution by workers.
+        uint64_t totalNumberOfExpiredTasks{ 0u };          ///< Not executed tasks dropped by workers because of deadline or cancellation token.
+        uint64_t totalNumberOfStolenTasks{ 0u };
+
+        uint64_t totalNumberOfScaledUpWorkers{ 0u };       ///< Workers added automatically because of the queue delay.
+        uint64_t totalNumberOfRetiredWorkers{ 0u };        ///< Workers removed automatically after keep alive time.
+        uint64_t totalNumberOfRejectedTasks{ 0u };         ///< Tasks rejected or dropped because of full queue.
+        uint64_t totalNumberOfCallerRunsTasks{ 0u };       ///< Tasks executed by the producer's thread because of full queue.
+        uint64_t totalNumberOfLongTasks{ 0u };             ///< Tasks reported by watchdog, since they were executed longer than the budget.
+
+        uint64_t uptimeInMicroseconds{ 0u };               ///< Measured with monotonic clock since thread pool creation.
+        double executedTasksPerSecond{ 0.0 };              ///< Average over uptime.
+        double stolenTasksPerSecond{ 0.0 };                ///< Average over uptime.
+
+        uint64_t totalWorkersBusyTimeInMicroseconds{ 0u };     ///< Sum over all workers, including removed ones.
+        uint64_t totalWorkersIdleTimeInMicroseconds{ 0u };     ///< Sum over all workers, including removed ones.
+        uint64_t totalWorkersCpuTimeInMicroseconds{ 0u };      ///< Sum over all workers, 0 if platform doesn't provide thread CPU time.
+        double workersUtilization{ 0.0 };                      ///< Busy time divided by busy and idle time, in range [0, 1].
 
     public:
 
         inline std::string toString() const
         {
-            return "Current number of all workers : "   + std::to_string(currentNumberOfAllWorkers)
-                 + "\nWorkers in READY state : "        + std::to_string(numberOfWorkersInReadyState)
-                 + "\nWorkers in RUNNING state : "      + std::to_string(numberOfWorkersInRunningState)
-                 + "\nWorkers in WAITING state : "      + std::to_string(numberOfWorkersInWaitingState)
-                 + "\nWorkers in PAUSED state : "       + std::to_string(numberOfWorkersInPausedState)
-                 + "\nTotal number of added tasks : "   + std::to_string(totalNumberOfAddedTasks);
+            return "Current number of all workers : "       + std::to_string(currentNumberOfAllWorkers)
+                 + "\nWorkers in READY state : "            + std::to_string(numberOfWorkersInReadyState)
+                 + "\nWorkers in RUNNING state : "          + std::to_string(numberOfWorkersInRunningState)
+                 + "\nWorkers in WAITING state : "          + std::to_string(numberOfWorkersInWaitingState)
+                 + "\nWorkers in PAUSED state : "           + std::to_string(numberOfWorkersInPausedState)
+                 + "\nCurrent number of blocking workers : " + std::to_string(currentNumberOfBlockingWorkers)
+                 + "\nWorkers in blocking region : "        + std::to_string(numberOfWorkersInBlockingRegion)
+                 + "\nTotal number of added tasks : "       + std::to_string(totalNumberOfAddedTasks)
+                 + "\nTotal number of executed tasks : "    + std::to_string(totalNumberOfExecutedTasks)
+                 + "\nTotal number of not executed tasks : "+ std::to_string(totalNumberOfNotExecutedTasks)
+                 + "\nTotal number of expired tasks : "     + std::to_string(totalNumberOfExpiredTasks)
+                 + "\nTotal number of stolen tasks : "      + std::to_string(totalNumberOfStolenTasks)
+                 + "\nTotal number of scaled up workers : " + std::to_string(totalNumberOfScaledUpWorkers)
+                 + "\nTotal number of retired workers : "   + std::to_string(totalNumberOfRetiredWorkers)
+                 + "\nTotal number of rejected tasks : "    + std::to_string(totalNumberOfRejectedTasks)
+                 + "\nTotal number of caller runs tasks : " + std::to_string(totalNumberOfCallerRunsTasks)
+                 + "\nTotal number of long tasks : "        + std::to_string(totalNumberOfLongTasks)
+                 + "\nUptime in microseconds : "            + std::to_string(uptimeInMicroseconds)
+                 + "\nExecuted tasks per second : "         + std::to_string(executedTasksPerSecond)
+                 + "\nStolen tasks per second : "           + std::to_string(stolenTasksPerSecond)
+                 + "\nTotal workers busy time : "           + std::to_string(totalWorkersBusyTimeInMicroseconds)
+                 + "\nTotal workers idle time : "           + std::to_string(totalWorkersIdleTimeInMicroseconds)
+                 + "\nTotal workers CPU time : "            + std::to_string(totalWorkersCpuTimeInMicroseconds)
+                 + "\nWorkers utilization : "               + std::to_string(workersUtilization);
         }
     };
 
+    /**
+     * @brief Latencies of executed tasks in microseconds, broken down by IThreadPoolTask::getSchedulingBucket.
+     *        Queue wait time is measured from adding to thread pool till worker takes task, execution time till task is completed.
+     */
+    struct LatencyStatistic
+    {
+        LatencyHistogram::Snapshot queueWaitTime[IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS];
+        LatencyHistogram::Snapshot executionTime[IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS];
+
+    public:
+
+        inline LatencyHistogram::Snapshot getTotalQueueWaitTime() const
+        {
+            LatencyHistogram::Snapshot total{};
+            for (auto && snapshot : queueWaitTime) { total.merge(snapshot); }
+            return total;
+        }
+
+        inline LatencyHistogram::Snapshot getTotalExecutionTime() const
+        {
+            LatencyHistogram::Snapshot total{};
+            for (auto && snapshot : executionTime) { total.merge(snapshot); }
+            return total;
+        }
+
+        inline std::string toString() const
+        {
+            std::string latencyStatistic{ "Queue wait time : "    + getTotalQueueWaitTime().toString()
+                                        + "\nExecution time : "   + getTotalExecutionTime().toString() };
+
+            for (uint8_t bucket = 0u; bucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS; ++bucket)
+            {
+                if (queueWaitTime[bucket].getCount() != 0u)
+                {
+                    latencyStatistic += "\nBucket " + std::to_string(bucket) + " queue wait time : " + queueWaitTime[bucket].toString()
+                                      + "\nBucket " + std::to_string(bucket) + " execution time : " + executionTime[bucket].toString();
+                }
+            }
+
+            return latencyStatistic;
+        }
+    };
+
+    /**
+     * @brief Depth and scheduler counters of one task queue, which is either thread pool own queue or queue of one worker.
+     */
+    struct QueueStatistic
+    {
+        bool isWorkerQueue{ false };
+        uint32_t workerSlot{ 0u };                          ///< Valid only for worker queue.
+        bool isBlockingWorker{ false };
+        size_t approximateSize{ 0u };
+        uint64_t approximateWork{ 0u };
+        ITaskScheduler::Statistic schedulerStatistic{};
+    };
+
+    /**
+     * @brief Time accounting of one current worker in microseconds, it starts from zero for the new worker of the slot.
+     */
+    struct WorkerStatistic
+    {
+        uint32_t slot{ 0u };
+        bool isBlocking{ false };
+        uint64_t lifetime{ 0u };                            ///< Time since worker was added.
+        uint64_t busyTime{ 0u };                            ///< Executing tasks.
+        uint64_t idleTime{ 0u };                            ///< Parked waiting for tasks.
+        uint64_t cpuTime{ 0u };                             ///< CPU time of the worker thread, 0 if platform doesn't provide it.
+        double utilization{ 0.0 };                          ///< Busy time divided by lifetime, in range [0, 1].
+    };
+
     enum class State : uint8_t
     {
         READY,          ///< Ready state. When thread pool is created and waiting to start execution.
@@ -70,11 +183,29 @@ public:
     virtual uint64_t getId() const = 0;
     virtual State getState() const = 0;
     virtual Statistic getStatistic() const = 0;
+    virtual LatencyStatistic getLatencyStatistic() const = 0;
+
+    /**
+     * @return Thread pool queue first, then queues of the current workers.
+     */
+    virtual std::vector<QueueStatistic> getQueuesStatistic() const = 0;
+
+    /**
+     * @return Time accounting of the current workers ordered by slot.
+     */
+    virtual std::vector<WorkerStatistic> getWorkersStatistic() const = 0;
     virtual ThreadPoolOptions getOptions() const = 0;
     virtual size_t getTasksSize(const bool needsGetFromWorkers = true) const = 0;
     virtual size_t getWorkersSize() const = 0;
     virtual bool isTaskAdded(const uint64_t taskId) const = 0;
 
+    /**
+     * @brief Dumps latest events of producers, manager and workers (see ThreadPoolOptions::getFlightRecorderCapacity)
+     *        as Chrome trace event JSON, which is opened by chrome://tracing and Perfetto UI.
+     */
+    virtual Result dumpTrace(std::ostream & stream) const = 0;
+    virtual Result dumpTrace(const std::string & filePath) const = 0;
+
     virtual Result waitAllTasksExecutionFinished(const int64_t timeout = -1) = 0;
     virtual Result addTask(const std::shared_ptr<IThreadPoolTask> task) = 0;
     virtual Result addTasks(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) = 0;
@@ -0,0 +1,67 @@
+
+#ifndef _IDLEWORKERSBITMAP_H_
+#define _IDLEWORKERSBITMAP_H_
+
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+
+/**
+ * @brief Lock-free set of idle worker slots.
+ *        Every worker owns one slot (bit) and marks itself idle/busy without any lock.
+ *        Owner of the workers picks idle worker with find-first-set over the words, which is O(capacity / 64).
+ */
+class IdleWorkersBitmap
+{
+public:
+
+    static const int64_t INVALID_SLOT{ -1 };
+
+public:
+
+    explicit IdleWorkersBitmap(const uint32_t capacity);
+
+    IdleWorkersBitmap(const IdleWorkersBitmap &) = delete;
+    IdleWorkersBitmap & operator=(const IdleWorkersBitmap &) = delete;
+
+    uint32_t getCapacity() const;
+    bool isSet(const uint32_t slot) const;
+    uint32_t count() const;
+
+    void set(const uint32_t slot);
+    void reset(const uint32_t slot);
+    void resetAll();
+
+    /**
+     * @brief Atomically finds first idle slot and clears it, so the same slot is never acquired twice.
+     * @return Acquired slot or INVALID_SLOT if there are no idle slots.
+     */
+    int64_t acquireFirst();
+
+    /**
+     * @brief Same as acquireFirst, but slots set in excludedSlots are never acquired.
+     */
+    int64_t acquireFirstExcept(const IdleWorkersBitmap & excludedSlots);
+
+    /**
+     * @brief Atomically clears the slot if it's set.
+     * @return True if the slot was idle and now it's acquired by the caller.
+     */
+    bool acquire(const uint32_t slot);
+
+private:
+
+    static uint32_t findFirstSet(const uint64_t word);
+
+private:
+
+    static const uint32_t BITS_PER_WORD{ 64u };
+
+    uint32_t capacity_;
+    uint32_t wordsSize_;
+    std::unique_ptr<std::atomic<uint64_t>[]> words_;
+};
+
+#endif // _IDLEWORKERSBITMAP_H_
@@ -0,0 +1,88 @@
+
+#ifndef _LATENCYHISTOGRAM_H_
+#define _LATENCYHISTOGRAM_H_
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "RelaxedCounter.h"
+
+
+/**
+ * @brief Lock-free log-linear (HDR-style) histogram of latencies in microseconds.
+ *        Every power of two range is split into SUB_BUCKETS linear buckets, so relative error is below 1 / SUB_BUCKETS.
+ *        Owner records without locks, readers take snapshots at any moment and merge them.
+ */
+class LatencyHistogram
+{
+public:
+
+    static const uint32_t SUB_BUCKET_BITS{ 4u };
+    static const uint32_t SUB_BUCKETS{ 1u << SUB_BUCKET_BITS };
+    static const uint32_t MAX_EXPONENT{ 36u };     ///< Values from 2^36 microseconds (~19 hours) fall into the last bucket.
+    static const uint32_t NUMBER_OF_BUCKETS{ SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS };
+
+    class Snapshot
+    {
+    public:
+
+        Snapshot();
+
+        void merge(const Snapshot & other);
+
+        uint64_t getCount() const;
+        uint64_t getSum() const;
+        double getMean() const;
+
+        /**
+         * @param percentile Value in range [0, 100].
+         * @return Highest value of the bucket, which contains the percentile, 0 if there are no values.
+         */
+        uint64_t getPercentile(const double percentile) const;
+
+        /**
+         * @return Number of values in the buckets, which highest value is at or below the value, e.g. cumulative bucket of Prometheus.
+         */
+        uint64_t getCountAtOrBelow(const uint64_t value) const;
+
+        std::string toString() const;
+
+    private:
+
+        friend class LatencyHistogram;
+
+        std::vector<uint64_t> counts_;
+        uint64_t count_;
+        uint64_t sum_;
+    };
+
+public:
+
+    LatencyHistogram() = default;
+
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram & operator=(const LatencyHistogram &) = delete;
+
+    void record(const uint64_t valueInMicroseconds);
+    void merge(const LatencyHistogram & other);
+    void reset();
+
+    Snapshot getSnapshot() const;
+
+    static uint32_t getBucketIndex(const uint64_t value);
+    static uint64_t getBucketHighestValue(const uint32_t index);
+
+private:
+
+    static uint32_t findLastSet(const uint64_t word);
+
+private:
+
+    RelaxedCounter counts_[NUMBER_OF_BUCKETS];
+    RelaxedCounter sum_;
+};
+
+
+#endif // _LATENCYHISTOGRAM_H_
@@ -0,0 +1,48 @@
+#ifndef _METRICSEXPORTTHREAD_H_
+#define _METRICSEXPORTTHREAD_H_
+
+
+#include <memory>
+#include <cstdint>
+
+#include "OSAL.h"
+#include "IMetricsExporter.h"
+
+
+/**
+ * @brief Thread calling metrics exporter of the thread pool periodically, so slow exporter (e.g. file or socket)
+ *        never delays dispatching, load balancing or watchdog of the manager thread.
+ */
+class MetricsExportThread : public OSAL::Thread
+{
+public:
+
+    /**
+     * @param threadPool Exported thread pool, it must stop the thread before its destruction.
+     * @param logging Not owned handle, it must outlive the thread object.
+     */
+    MetricsExportThread(const IThreadPool & threadPool,
+                        const std::shared_ptr<IMetricsExporter> & metricsExporter,
+                        const uint64_t periodInMicroseconds,
+                        Logging * logging = nullptr);
+    ~MetricsExportThread() override;
+
+    /**
+     * @brief Wakes up the thread and waits till it's finished, export in progress is completed.
+     */
+    void stop();
+
+protected:
+
+    void run() override;
+
+private:
+
+    const IThreadPool & threadPool_;
+    std::shared_ptr<IMetricsExporter> metricsExporter_;
+    uint64_t periodInMicroseconds_;
+    OSAL::Monitor periodMonitor_;
+};
+
+
+#endif // _METRICSEXPORTTHREAD_H_
@@ -0,0 +1,51 @@
+#ifndef _PROMETHEUSEXPORTER_H_
+#define _PROMETHEUSEXPORTER_H_
+
+
+#include <functional>
+#include <ostream>
+#include <string>
+
+#include "IMetricsExporter.h"
+#include "IThreadPool.h"
+
+
+/**
+ * @brief Renders thread pool statistic in Prometheus text exposition format (version 0.0.4).
+ *        Every sample has "pool" label with thread pool id, latencies and uptime are in seconds as Prometheus recommends.
+ *        Rendered text is given to the callback (e.g. scrape handler of the HTTP server) or written to the file
+ *        (e.g. for textfile collector of node exporter).
+ */
+class PrometheusExporter : public IMetricsExporter
+{
+public:
+
+    using Callback = std::function<void(const std::string & metrics)>;
+
+    //! Upper bounds of latency histogram buckets in microseconds, +Inf bucket follows them.
+    //! Every bound is exported as the highest value of the LatencyHistogram sub-bucket, which contains it (e.g. 50 as 51),
+    //! so counts are exact and only bounds are approximated within the histogram precision
+    static const uint64_t LATENCY_BUCKETS[];
+    static const size_t NUMBER_OF_LATENCY_BUCKETS;
+
+    explicit PrometheusExporter(const Callback & callback);
+
+    /**
+     * @brief File is replaced atomically (metrics are written to "<file path>.tmp", which is renamed),
+     *        so reader never sees partially written metrics.
+     */
+    explicit PrometheusExporter(const std::string & filePath);
+
+    Result exportMetrics(const IThreadPool & threadPool) override;
+
+    static std::string render(const IThreadPool & threadPool);
+    static void render(const IThreadPool & threadPool, std::ostream & stream);
+
+private:
+
+    Callback callback_;
+    std::string filePath_;
+};
+
+
+#endif // _PROMETHEUSEXPORTER_H_
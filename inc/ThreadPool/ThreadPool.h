@@ -3,7 +3,11 @@
 
 
 #include "IThreadPool.h"
+#include "IdleWorkersBitmap.h"
+#include "WorkersStatistic.h"
+#include "FlightRecorder.h"
 #include "ThreadPoolWorker.h"
+#include "MetricsExportThread.h"
 
 
 /**
@@ -21,6 +25,9 @@ public:
 
 public:
 
+    /**
+     * @param logging Not owned handle, e.g. Logging::getInstance, it must outlive the thread pool.
+     */
     explicit ThreadPool(const ThreadPoolOptions & options, Logging * logging = nullptr);
 
     ThreadPool(const ThreadPool &) = delete;
@@ -36,11 +43,17 @@ public:
     uint64_t getId() const override;
     IThreadPool::State getState() const override;
     Statistic getStatistic() const override;
+    LatencyStatistic getLatencyStatistic() const override;
+    std::vector<QueueStatistic> getQueuesStatistic() const override;
+    std::vector<WorkerStatistic> getWorkersStatistic() const override;
     ThreadPoolOptions getOptions() const override;
     size_t getTasksSize(const bool needsGetFromWorkers = true) const override;
     size_t getWorkersSize() const override;
     bool isTaskAdded(const uint64_t taskId) const override;
 
+    Result dumpTrace(std::ostream & stream) const override;
+    Result dumpTrace(const std::string & filePath) const override;
+
     Result waitAllTasksExecutionFinished(const int64_t timeout = -1) override final;
 
     Result addTask(const std::shared_ptr<IThreadPoolTask> task) override;
@@ -63,6 +76,23 @@ protected:
     virtual WorkersContainer::value_type getAvailableWorker();
     virtual std::shared_ptr<IThreadPoolTask> getTaskForExecution();
 
+    /**
+     * @brief Increases workers when queue delay exceeds ThreadPoolOptions::getQueueDelayToIncreaseWorkers
+     *        and retires workers idle longer than ThreadPoolOptions::getWorkerKeepAliveTime.
+     */
+    virtual void autoScale();
+
+    /**
+     * @brief Reports tasks executed longer than ThreadPoolOptions::getLongTaskBudget and counts their workers for compensation.
+     */
+    virtual void watchLongTasks();
+
+    /**
+     * @brief Adds one ordinary worker per worker inside BlockingRegion (or executing long task, if it's compensated)
+     *        and removes them once regions are left.
+     */
+    virtual void compensateBlockedWorkers();
+
     /**
      * @note It must be called before thread pool destruction.
      */
@@ -76,6 +106,22 @@ protected:
 
     ITaskScheduler* getNewTaskScheduler(const ThreadPoolOptions::SchedulerType schedulerType) const;
 
+    WorkersContainer::value_type createWorker(const ThreadPoolOptions::SchedulerType schedulerType, const bool isBlocking = false);
+    WorkersContainer::value_type getAvailableBlockingWorker();
+    void reserveWorkers();
+    bool isReservedWorker(const WorkersContainer::value_type & worker) const;
+    bool isReservedPriorityTask(const std::shared_ptr<IThreadPoolTask> & task) const;
+    bool canExecute(const WorkersContainer::value_type & worker, const std::shared_ptr<IThreadPoolTask> & task) const;
+    uint32_t retireIdleBlockingWorkers();
+    std::vector<uint32_t> getAffinityCpus() const;
+    WorkersContainer::const_iterator findVictimSharingCache(const WorkersContainer::const_iterator thief, const size_t minVictimTasksSize) const;
+    WorkersContainer::const_iterator findVictimOnNumaNode(const WorkersContainer::const_iterator thief, const size_t minVictimTasksSize) const;
+    WorkersContainer::value_type getAvailableWorkerOnNumaNode(const int64_t numaNode);
+    int64_t getWorkerNumaNode(const WorkersContainer::value_type & worker) const;
+    bool hasNumaNodeTasks(const int64_t numaNode) const;
+    void releaseWorkerSlot(const WorkersContainer::value_type & worker);
+    void requeueTasksOfLongTaskWorkers();
+
     Result createManagingThread();
     Result createWorkerThreads();
     Result stopWorkerThreadsExecution();
@@ -88,25 +134,93 @@ protected:
     uint32_t getNumberOfWorkersToIncrease(const uint32_t initialNumber) const;
     uint32_t getNumberOfWorkersToDecrease(const uint32_t initialNumber) const;
     size_t getTasksSizeFromAllWorkers() const;
+    uint64_t getOldestTaskAddedTime() const;
+    uint32_t retireIdleWorkers();
+
+    /**
+     * @brief Reserves place of the task in the bounded queue or applies ThreadPoolOptions::QueueOverflowPolicy, when queue is full.
+     * @return True if task could be added, otherwise it's already handled by the policy and result is set.
+     */
+    bool admitTask(const std::shared_ptr<IThreadPoolTask> & task, Result & result);
+    bool reserveQueueCapacity(const size_t queueCapacity);
+
+    //! Tasks leaving the thread pool without execution give their places in the bounded queue back
+    void releaseQueuedTasks(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks);
+    std::shared_ptr<IThreadPoolTask> removeOldestTask();
 
 protected:
 
     ThreadPoolOptions options_;
     mutable IThreadPool::State state_;
-    mutable IThreadPool::Statistic statistic_;
     std::unique_ptr<ITaskScheduler> taskScheduler_;
     mutable OSAL::Monitor tasksExecutionMonitor_;
     WorkersContainer workers_;
+    WorkersContainer blockingWorkers_;
     mutable OSAL::Mutex workersMutex_;
-    std::unique_ptr<Logging> logging_;
+    Logging * logging_;
+
+    //! Every worker owns a slot, workers publish their idle state and statistic by the slot and are mapped back in slotToWorker_
+    std::shared_ptr<IdleWorkersBitmap> idleWorkersBitmap_;
+    std::shared_ptr<IdleWorkersBitmap> idleBlockingWorkersBitmap_;
+    std::shared_ptr<WorkersStatistic> workersStatistic_;
+    std::vector<WorkersContainer::value_type> slotToWorker_;
+    std::vector<uint32_t> freeSlots_;
+
+    CacheLinePadded<RelaxedCounter> totalNumberOfAddedTasks_;
+    mutable OSAL::Time uptime_;
+
+    //! Slots are shared with blocking and compensation workers and reused in any order,
+    //! so ordinary workers are pinned to the least used CPU and the slot only remembers it
+    OSAL::CpuTopology cpuTopology_;
+    std::vector<uint32_t> affinityCpus_;
+    std::vector<uint32_t> affinityCpusUsage_;
+    std::vector<size_t> slotToAffinityCpuIndex_;
+    std::vector<int64_t> slotToNumaNode_;
+
+    //! Reserved workers are marked by slot and never get tasks below reserved priority
+    std::shared_ptr<IdleWorkersBitmap> reservedWorkersSlots_;
+    uint32_t numberOfReservedWorkers_;
+
+    //! Compensation workers are ordinary workers above max number of workers
+    uint32_t numberOfCompensationWorkers_;
+    std::atomic<uint32_t> numberOfBlockingWorkers_;
+
+    //! Watchdog keeps start time of the reported long task by slot, so every task is reported once,
+    //! workers executing long tasks are marked by slot and don't get new tasks while other workers are available
+    std::vector<uint64_t> slotToReportedLongTaskStartTime_;
+    std::shared_ptr<IdleWorkersBitmap> longTaskWorkersSlots_;
+
+    //! Filled by watchdog with workersMutex_ locked and drained by manager thread after unlocking, since tasksExecutionMonitor_ is locked first
+    WorkersContainer longTaskWorkersToRequeue_;
+    uint32_t numberOfWorkersWithLongTasks_;
+
+    //! Tasks admitted into the bounded queue and neither taken for execution nor canceled yet, tasks release their places themselves
+    std::shared_ptr<IThreadPoolTask::QueuedTasksCounter> queuedTasksCounter_;
+
+    RelaxedCounter totalNumberOfScaledUpWorkers_;
+    RelaxedCounter totalNumberOfRetiredWorkers_;
+    RelaxedCounter totalNumberOfRejectedTasks_;
+    RelaxedCounter totalNumberOfCallerRunsTasks_;
+    RelaxedCounter totalNumberOfLongTasks_;
+
+    //! Worker slots are tracks of the recorder, so events of reused slot stay on the same timeline row
+    std::shared_ptr<FlightRecorder> flightRecorder_;
 
 private:
 
     uint64_t id_;
     int64_t waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_;
+    uint64_t autoScalingCheckPeriodInMicroseconds_;
+    int64_t queueCapacityCheckPeriodInMicroseconds_;
+    uint64_t lastAutoScalingCheckTime_;
+    uint64_t lastWorkersScalingTime_;
+    uint64_t lastLongTasksCheckTime_;
     std::shared_ptr<IThreadPoolTask> currentTaskForExecution_;
     bool needsGetNewTaskForExecution_;
     bool areAllTasksPutForExecution_;
+
+    //! Declared last, so it's destroyed first, while exported members are still alive
+    std::unique_ptr<MetricsExportThread> metricsExportThread_;
 };
 
 #endif // _THREADPOOL_H_
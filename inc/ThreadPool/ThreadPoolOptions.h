@@ -2,7 +2,12 @@
 #define _THREADPOOLOPTIONS_H_
 
 
+#include <map>
+#include <functional>
+
 #include "OSAL.h"
+#include "PriorityTask.h"
+#include "IMetricsExporter.h"
 
 
 class ThreadPoolOptions
@@ -14,6 +19,7 @@ public:
         FCFS,           ///< First Come First Served, default value.
         PRIORITY,       ///< Priority based.
         SJF,            ///< Shortest Job First.
+        FAIR_SHARE,     ///< Deficit round robin over the tenants of TenantTask.
         UNDEFINED       ///< Undefined scheduler type.
     };
 
@@ -25,6 +31,7 @@ public:
             case SchedulerType::FCFS:       return "FCFS";
             case SchedulerType::PRIORITY:   return "PRIORITY";
             case SchedulerType::SJF:        return "SJF";
+            case SchedulerType::FAIR_SHARE: return "FAIR_SHARE";
             default:                        return "UNDEFINED";
         }
     };
@@ -37,10 +44,59 @@ public:
         if ("FCFS" == upperCaseSchedulerType)           return SchedulerType::FCFS;
         if ("PRIORITY" == upperCaseSchedulerType)       return SchedulerType::PRIORITY;
         if ("SJF" == upperCaseSchedulerType)            return SchedulerType::SJF;
+        if ("FAIR_SHARE" == upperCaseSchedulerType)     return SchedulerType::FAIR_SHARE;
 
         return SchedulerType::UNDEFINED;
     };
 
+    enum class AffinityPolicy : uint8_t
+    {
+        NONE,           ///< Workers aren't pinned, default value.
+        COMPACT,        ///< Workers fill hardware threads of one core, then cores of one package, then next package.
+        SCATTER,        ///< Workers are spread over packages, then cores, then hardware threads.
+        PHYSICAL_CORES, ///< One worker per physical core, hardware thread siblings stay free.
+        EXPLICIT,       ///< Workers are pinned to CPUs from the provided list.
+        UNDEFINED       ///< Undefined affinity policy.
+    };
+
+
+    static std::string affinityPolicyToString(const AffinityPolicy affinityPolicy)
+    {
+        switch (affinityPolicy)
+        {
+            case AffinityPolicy::NONE:              return "NONE";
+            case AffinityPolicy::COMPACT:           return "COMPACT";
+            case AffinityPolicy::SCATTER:           return "SCATTER";
+            case AffinityPolicy::PHYSICAL_CORES:    return "PHYSICAL_CORES";
+            case AffinityPolicy::EXPLICIT:          return "EXPLICIT";
+            default:                                return "UNDEFINED";
+        }
+    };
+
+    enum class QueueOverflowPolicy : uint8_t
+    {
+        BLOCK,          ///< Producer waits for free capacity up to the block timeout, default value.
+        REJECT,         ///< Task isn't added and Result::ERROR is returned.
+        CALLER_RUNS,    ///< Task is executed by the producer's thread.
+        DROP_OLDEST,    ///< The longest waiting task is canceled and removed to free capacity.
+        UNDEFINED       ///< Undefined queue overflow policy.
+    };
+
+
+    static std::string queueOverflowPolicyToString(const QueueOverflowPolicy queueOverflowPolicy)
+    {
+        switch (queueOverflowPolicy)
+        {
+            case QueueOverflowPolicy::BLOCK:        return "BLOCK";
+            case QueueOverflowPolicy::REJECT:       return "REJECT";
+            case QueueOverflowPolicy::CALLER_RUNS:  return "CALLER_RUNS";
+            case QueueOverflowPolicy::DROP_OLDEST:  return "DROP_OLDEST";
+            default:                                return "UNDEFINED";
+        }
+    };
+
+    using LongTaskCallback = std::function<void(const uint64_t taskId, const uint64_t durationInMicroseconds)>;
+
     ThreadPoolOptions(const SchedulerType schedulerType,
                       const uint32_t initialNumberOfWorkers, const uint32_t minNumberOfWorkers, const uint32_t maxNumberOfWorkers,
                       const bool needsPostponeExecution = false, const bool needsWaitAllTasksExecutionFinished = false);
@@ -70,6 +126,122 @@ public:
     bool needsWaitAllTasksExecutionFinished() const;
     void setWaitAllTasksExecutionFinished(const bool needsWaitAllTasksExecutionFinished = true);
 
+    /**
+     * @brief Workers are increased by one (up to max number of workers) when the longest waiting task
+     *        waits longer than this delay. 0 disables increasing.
+     */
+    uint64_t getQueueDelayToIncreaseWorkers() const;
+    void setQueueDelayToIncreaseWorkers(const uint64_t delayInMicroseconds);
+
+    /**
+     * @brief Workers, which are idle longer than this time, are retired (down to min number of workers). 0 disables retirement.
+     */
+    uint64_t getWorkerKeepAliveTime() const;
+    void setWorkerKeepAliveTime(const uint64_t timeInMicroseconds);
+
+    /**
+     * @brief Minimum time between two automatic changes of workers number, avoids flapping.
+     */
+    uint64_t getWorkersScalingCooldown() const;
+    void setWorkersScalingCooldown(const uint64_t timeInMicroseconds);
+
+    bool isWorkersAutoScalingEnabled() const;
+
+    /**
+     * @brief Workers are pinned to CPUs by slot, slot i gets i-th CPU of the policy order (wrapped around).
+     */
+    AffinityPolicy getAffinityPolicy() const;
+    void setAffinityPolicy(const AffinityPolicy affinityPolicy);
+
+    /**
+     * @brief CPUs for AffinityPolicy::EXPLICIT. Setting non empty list switches policy to EXPLICIT.
+     */
+    const std::vector<uint32_t> & getAffinityCpus() const;
+    void setAffinityCpus(const std::vector<uint32_t> & cpus);
+
+    /**
+     * @brief Groups workers by NUMA node of their CPUs. Tasks with node hint are executed by the workers of this node
+     *        and are stolen by other nodes only when the node has nothing to execute.
+     *        Workers are spread over the nodes with AffinityPolicy::SCATTER, if no other policy is set.
+     */
+    bool isNumaAware() const;
+    void setNumaAware(const bool isNumaAware = true);
+
+    /**
+     * @brief Separate class of workers for tasks marked as blocking, they are created on demand.
+     *        0 means blocking tasks are executed by the ordinary workers.
+     */
+    uint32_t getMaxNumberOfBlockingWorkers() const;
+    void setMaxNumberOfBlockingWorkers(const uint32_t value);
+
+    /**
+     * @brief Blocking workers, which are idle longer than this time, are removed.
+     */
+    uint64_t getBlockingWorkerKeepAliveTime() const;
+    void setBlockingWorkerKeepAliveTime(const uint64_t timeInMicroseconds);
+
+    /**
+     * @brief Reserved workers execute only PriorityTask with the priority at or above reserved one,
+     *        so these tasks never wait for the burst of lower priority tasks. Other tasks are considered as NORMAL.
+     *        Other tasks wait, if all workers are reserved.
+     */
+    uint32_t getNumberOfReservedWorkers() const;
+    Priority getReservedWorkersPriority() const;
+    void setReservedWorkers(const uint32_t numberOfReservedWorkers, const Priority priority = Priority::HIGH);
+
+    /**
+     * @brief Weights of the tenants for SchedulerType::FAIR_SHARE. Tenant with weight W gets W times more executions
+     *        than tenant with weight 1, while both have tasks. Not listed tenants have weight 1, 0 is considered as 1.
+     */
+    const std::map<std::string, uint32_t> & getTenantWeights() const;
+    void setTenantWeight(const std::string & tenant, const uint32_t weight);
+
+    /**
+     * @brief Max number of tasks waiting for execution in thread pool and workers queues, it's checked by addTask and addTasks.
+     *        0 means unbounded queues. Admitted task keeps its place till it's taken for execution or canceled,
+     *        places are reserved atomically, so concurrent producers don't exceed the capacity.
+     */
+    uint32_t getQueueCapacity() const;
+    QueueOverflowPolicy getQueueOverflowPolicy() const;
+    void setQueueCapacity(const uint32_t capacity, const QueueOverflowPolicy queueOverflowPolicy = QueueOverflowPolicy::BLOCK);
+
+    /**
+     * @brief Timeout of the producer waiting with QueueOverflowPolicy::BLOCK, -1 means infinite waiting.
+     */
+    int64_t getQueueBlockTimeout() const;
+    void setQueueBlockTimeout(const int64_t timeoutInMicroseconds);
+
+    /**
+     * @brief Number of the latest events kept by flight recorder for every worker, manager and producers, 0 disables recording.
+     */
+    uint32_t getFlightRecorderCapacity() const;
+    void setFlightRecorderCapacity(const uint32_t numberOfEvents);
+
+    /**
+     * @brief File, where flight recorder is dumped as Chrome trace at thread pool destruction, empty path means no dump.
+     */
+    const std::string & getTraceFilePath() const;
+    void setTraceFilePath(const std::string & traceFilePath);
+
+    /**
+     * @brief Exporter called by dedicated thread of the thread pool with the period, nullptr or 0 period disables periodic export.
+     */
+    const std::shared_ptr<IMetricsExporter> & getMetricsExporter() const;
+    uint64_t getMetricsExportPeriod() const;
+    void setMetricsExporter(const std::shared_ptr<IMetricsExporter> & metricsExporter, const uint64_t periodInMicroseconds = 1000000u);
+
+    /**
+     * @brief Manager thread reports every task executed longer than the budget once, callback is called by manager thread.
+     *        With compensation tasks queued behind such task are given to other workers and temporary worker is added
+     *        till it finishes (up to max number of workers), so the queue keeps draining. 0 budget disables watchdog.
+     * @note Callback is called with workers of the thread pool locked, so it must not add tasks or change workers of this thread pool.
+     */
+    uint64_t getLongTaskBudget() const;
+    const LongTaskCallback & getLongTaskCallback() const;
+    bool needsCompensateLongTasks() const;
+    void setLongTaskWatchdog(const uint64_t budgetInMicroseconds, const LongTaskCallback & longTaskCallback = nullptr,
+                             const bool needsCompensateLongTasks = true);
+
     std::string toString() const;
 
 private:
@@ -80,6 +252,27 @@ private:
     uint32_t maxNumberOfWorkers_;
     bool needsPostponeExecution_;
     bool needsWaitAllTasksExecutionFinished_;
+    uint64_t queueDelayToIncreaseWorkersInMicroseconds_;
+    uint64_t workerKeepAliveTimeInMicroseconds_;
+    uint64_t workersScalingCooldownInMicroseconds_;
+    AffinityPolicy affinityPolicy_;
+    std::vector<uint32_t> affinityCpus_;
+    bool isNumaAware_;
+    uint32_t maxNumberOfBlockingWorkers_;
+    uint64_t blockingWorkerKeepAliveTimeInMicroseconds_;
+    uint32_t numberOfReservedWorkers_;
+    Priority reservedWorkersPriority_;
+    std::map<std::string, uint32_t> tenantWeights_;
+    uint32_t queueCapacity_;
+    QueueOverflowPolicy queueOverflowPolicy_;
+    int64_t queueBlockTimeoutInMicroseconds_;
+    uint32_t flightRecorderCapacity_;
+    std::string traceFilePath_;
+    std::shared_ptr<IMetricsExporter> metricsExporter_;
+    uint64_t metricsExportPeriodInMicroseconds_;
+    uint64_t longTaskBudgetInMicroseconds_;
+    LongTaskCallback longTaskCallback_;
+    bool needsCompensateLongTasks_;
 };
 
 #endif // _THREADPOOLOPTIONS_H_
@@ -16,6 +16,26 @@ public:
     ThreadPoolOptionsBuilder & setMaxNumberOfWorkers(const uint32_t maxNumberOfWorkers);
     ThreadPoolOptionsBuilder & setPostponeExecution(const bool postponeExecution = true);
     ThreadPoolOptionsBuilder & setWaitAllTasksExecutionFinished(const bool waitAllTasksExecutionFinished = true);
+    ThreadPoolOptionsBuilder & setQueueDelayToIncreaseWorkers(const uint64_t delayInMicroseconds);
+    ThreadPoolOptionsBuilder & setWorkerKeepAliveTime(const uint64_t timeInMicroseconds);
+    ThreadPoolOptionsBuilder & setWorkersScalingCooldown(const uint64_t timeInMicroseconds);
+    ThreadPoolOptionsBuilder & setAffinityPolicy(const ThreadPoolOptions::AffinityPolicy affinityPolicy);
+    ThreadPoolOptionsBuilder & setAffinityCpus(const std::vector<uint32_t> & cpus);
+    ThreadPoolOptionsBuilder & setNumaAware(const bool isNumaAware = true);
+    ThreadPoolOptionsBuilder & setMaxNumberOfBlockingWorkers(const uint32_t maxNumberOfBlockingWorkers);
+    ThreadPoolOptionsBuilder & setBlockingWorkerKeepAliveTime(const uint64_t timeInMicroseconds);
+    ThreadPoolOptionsBuilder & setReservedWorkers(const uint32_t numberOfReservedWorkers, const Priority priority = Priority::HIGH);
+    ThreadPoolOptionsBuilder & setTenantWeight(const std::string & tenant, const uint32_t weight);
+    ThreadPoolOptionsBuilder & setQueueCapacity(const uint32_t capacity,
+                                                const ThreadPoolOptions::QueueOverflowPolicy queueOverflowPolicy = ThreadPoolOptions::QueueOverflowPolicy::BLOCK);
+    ThreadPoolOptionsBuilder & setQueueBlockTimeout(const int64_t timeoutInMicroseconds);
+    ThreadPoolOptionsBuilder & setFlightRecorderCapacity(const uint32_t numberOfEvents);
+    ThreadPoolOptionsBuilder & setTraceFilePath(const std::string & traceFilePath);
+    ThreadPoolOptionsBuilder & setMetricsExporter(const std::shared_ptr<IMetricsExporter> & metricsExporter,
+                                                  const uint64_t periodInMicroseconds = 1000000u);
+    ThreadPoolOptionsBuilder & setLongTaskWatchdog(const uint64_t budgetInMicroseconds,
+                                                   const ThreadPoolOptions::LongTaskCallback & longTaskCallback = nullptr,
+                                                   const bool needsCompensateLongTasks = true);
 
     ThreadPoolOptions build() const;
 
@@ -5,6 +5,9 @@
 #include <atomic>
 
 #include "ITaskScheduler.h"
+#include "IdleWorkersBitmap.h"
+#include "WorkersStatistic.h"
+#include "FlightRecorder.h"
 #include "Logging.h"
 
 
@@ -21,8 +24,12 @@ class ThreadPoolWorker : public OSAL::ManagedThread
 {
 public:
 
+    //! Thread CPU time is a system call, so it's published after tasks not more often than this period
+    static const uint64_t CPU_TIME_UPDATE_PERIOD_IN_MICROSECONDS{ 10000u };
+
     /**
      * @param freeStateMonitor Monitor for notification about free state (means when state is WAITING).
+     * @param logging Not owned handle, it must outlive the worker.
      */
     ThreadPoolWorker(ITaskScheduler * taskScheduler, OSAL::Monitor & freeStateMonitor, Logging * logging = nullptr);
 
@@ -33,20 +40,75 @@ public:
 
     ITaskScheduler::Statistic getTasksStatistic() const;
     size_t getTasksSize() const;
+    size_t getApproximateTasksSize() const;
+    uint64_t getApproximateTasksWork() const;
+    uint64_t getApproximateOldestTaskAddedTime() const;
     bool isTaskAdded(const uint64_t taskId) const;
     uint64_t getWaitingTime();
 
+    /**
+     * @brief Attaches worker to the owner's slot.
+     *        Worker sets its idle bit when it has nothing to execute and resets it once it gets a task.
+     *        Worker publishes its state and counters to its statistic shard and records its events to the track of the slot.
+     * @note It must be called before worker thread is created.
+     */
+    void attach(const uint32_t slot,
+                const std::shared_ptr<IdleWorkersBitmap> & idleWorkersBitmap,
+                const std::shared_ptr<WorkersStatistic> & workersStatistic,
+                const std::shared_ptr<FlightRecorder> & flightRecorder = nullptr);
+    uint32_t getSlot() const;
+
+    /**
+     * @return Microseconds since worker was attached, its time accounting is published to the statistic shard of the slot.
+     */
+    uint64_t getLifetime() const;
+
+    /**
+     * @brief Blocking worker executes tasks marked as blocking, so its blocking calls are never compensated.
+     * @note It must be called before worker thread is created.
+     */
+    void setBlocking(const bool isBlocking = true);
+    bool isBlocking() const;
+
+    /**
+     * @return Worker executing task on the calling thread or nullptr if it's not a worker thread.
+     */
+    static ThreadPoolWorker * getCurrentWorker();
+
+    /**
+     * @brief Publishes that task on this worker is going to block, owner is notified to compensate it.
+     * @return False if blocking region isn't compensated (blocking worker or worker without owner).
+     */
+    bool enterBlockingRegion();
+    void leaveBlockingRegion();
+
+    // Hide OSAL::ManagedThread methods to publish state changes to the statistic shard
+    Result create();
+    Result pauseExecution();
+    Result resumeExecution();
+    Result stopExecution();
+
     std::shared_ptr<IThreadPoolTask> stealTask();
     Result addTask(const std::shared_ptr<IThreadPoolTask> task);
     Result addTasks(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks);
     std::shared_ptr<IThreadPoolTask> removeOneTask(const uint64_t taskId);
     std::vector<std::shared_ptr<IThreadPoolTask>> removeAllTasks();
+    std::shared_ptr<IThreadPoolTask> removeOldestTask();
     Result clearAllTasks();
 
 private:
 
     void managedRun() override;
 
+    void publishState(const State state);
+    void publishCurrentState();
+    void publishCpuTime(const uint64_t currentTime);
+
+    /**
+     * @return true if cancellation of the task is requested or its deadline has passed, so it's not worth executing.
+     */
+    static bool isTaskExpired(const IThreadPoolTask & task, const uint64_t currentTime);
+
 private:
 
     OSAL::Monitor &freeStateMonitor_;
@@ -54,6 +116,17 @@ private:
     int64_t waitTaskForExecutionTimeoutInMicroseconds_;
     OSAL::Time waitingTime_;
     OSAL::Monitor waitingTimeMutex_;
+    uint32_t slot_;
+    std::shared_ptr<IdleWorkersBitmap> idleWorkersBitmap_;
+    std::shared_ptr<WorkersStatistic> workersStatistic_;
+    WorkersStatistic::Shard * statisticShard_;
+    std::shared_ptr<FlightRecorder> flightRecorder_;
+    bool isBlocking_;
+    uint64_t attachedTime_;
+    uint64_t lastCpuTime_;                  ///< Accessed only by the worker thread.
+    uint64_t lastCpuTimeUpdateTime_;        ///< Accessed only by the worker thread.
+
+    static thread_local ThreadPoolWorker * currentWorker_;
 };
 
 #endif // _THREADPOOLWORKER_H_
@@ -0,0 +1,129 @@
+
+#ifndef _WORKERSSTATISTIC_H_
+#define _WORKERSSTATISTIC_H_
+
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+#include "CacheLinePadded.h"
+#include "RelaxedCounter.h"
+#include "LatencyHistogram.h"
+#include "IThreadPoolTask.h"
+#include "OSALThread.h"
+
+
+/**
+ * @brief Per-worker statistic shards.
+ *        Every worker owns one shard (by its slot), counters are updated with relaxed atomics
+ *        and never share a cache line with other workers. Readers aggregate all shards without taking any lock.
+ */
+class WorkersStatistic
+{
+public:
+
+    struct Shard
+    {
+        std::atomic<bool> isUsed;
+        std::atomic<OSAL::Thread::State> state;         ///< Last published state of the worker.
+        std::atomic<uint64_t> currentTaskId;            ///< Task executed by the worker, valid while start time isn't 0.
+        std::atomic<uint64_t> currentTaskStartTime;     ///< 0 while the worker doesn't execute any task.
+        RelaxedCounter numberOfExecutedTasks;
+        RelaxedCounter numberOfNotExecutedTasks;
+        RelaxedCounter numberOfStolenTasks;
+        RelaxedCounter numberOfExpiredTasks;            ///< Not executed tasks, which were dropped because of deadline or cancellation.
+
+        RelaxedCounter busyTime;                        ///< Microseconds spent executing tasks.
+        RelaxedCounter idleTime;                        ///< Microseconds spent parked waiting for tasks.
+        RelaxedCounter cpuTime;                         ///< Microseconds of CPU time consumed by the worker thread.
+
+        //! Indexed by IThreadPoolTask::getSchedulingBucket
+        LatencyHistogram queueWaitTime[IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS];
+        LatencyHistogram executionTime[IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS];
+    };
+
+    struct Snapshot
+    {
+        uint32_t numberOfWorkers{ 0u };
+        uint32_t numberOfWorkersInReadyState{ 0u };
+        uint32_t numberOfWorkersInRunningState{ 0u };
+        uint32_t numberOfWorkersInWaitingState{ 0u };
+        uint32_t numberOfWorkersInPausedState{ 0u };
+        uint64_t numberOfExecutedTasks{ 0u };
+        uint64_t numberOfNotExecutedTasks{ 0u };
+        uint64_t numberOfStolenTasks{ 0u };
+        uint64_t numberOfExpiredTasks{ 0u };
+        uint32_t numberOfWorkersInBlockingRegion{ 0u };
+        uint64_t busyTime{ 0u };
+        uint64_t idleTime{ 0u };
+        uint64_t cpuTime{ 0u };
+    };
+
+public:
+
+    explicit WorkersStatistic(const uint32_t capacity);
+
+    WorkersStatistic(const WorkersStatistic &) = delete;
+    WorkersStatistic & operator=(const WorkersStatistic &) = delete;
+
+    uint32_t getCapacity() const;
+    Shard & getShard(const uint32_t slot);
+
+    /**
+     * @brief Marks shard as used and resets its counters.
+     */
+    void acquire(const uint32_t slot, const OSAL::Thread::State state);
+
+    /**
+     * @brief Merges counters of the shard into the released ones and marks it as unused.
+     * @note Readers retry while a shard is released, so its counters are never missed or counted twice.
+     */
+    void release(const uint32_t slot);
+
+    Snapshot getSnapshot() const;
+
+    /**
+     * @brief Workers, which execute blocking call inside BlockingRegion, are counted to be compensated by the owner.
+     */
+    void enterBlockingRegion();
+    void leaveBlockingRegion();
+    uint32_t getNumberOfWorkersInBlockingRegion() const;
+
+    /**
+     * @brief Task executed by the worker of the slot and its start time, workers publish them around execution.
+     * @return False if the worker doesn't execute any task.
+     */
+    bool getCurrentTask(const uint32_t slot, uint64_t & taskId, uint64_t & startTime) const;
+
+    /**
+     * @brief Latency histograms of all shards (including released ones) merged for one scheduling bucket.
+     */
+    LatencyHistogram::Snapshot getQueueWaitTime(const uint8_t schedulingBucket) const;
+    LatencyHistogram::Snapshot getExecutionTime(const uint8_t schedulingBucket) const;
+
+private:
+
+    Snapshot collectSnapshot() const;
+
+    //! Wait for the end of release in progress and return the sequence to be checked by endRead
+    uint32_t beginRead() const;
+    bool endRead(const uint32_t sequence) const;
+
+    static void resetShard(Shard & shard, const OSAL::Thread::State state);
+
+private:
+
+    uint32_t capacity_;
+    std::unique_ptr<CacheLinePadded<Shard>[]> shards_;
+
+    //! Counters of released shards, so totals never go backward when workers are decreased
+    CacheLinePadded<Shard> released_;
+    //! Odd while a shard is merged into released_
+    std::atomic<uint32_t> releaseSequence_;
+
+    std::atomic<uint32_t> numberOfWorkersInBlockingRegion_;
+};
+
+
+#endif // _WORKERSSTATISTIC_H_
@@ -26,6 +26,8 @@ public:
     BurstTime getBurstTime() const;
     void setBurstTime(const BurstTime burstTime);
 
+    uint8_t getSchedulingBucket() const override;
+
 private:
 
     std::atomic<BurstTime> burstTime_;
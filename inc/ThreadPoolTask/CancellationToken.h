@@ -0,0 +1,56 @@
+#ifndef _CANCELLATIONTOKEN_H_
+#define _CANCELLATIONTOKEN_H_
+
+
+#include <atomic>
+#include <memory>
+
+
+/**
+ * @brief Read side of the cooperative cancellation. Token is cheap to copy and can be attached to any number of tasks.
+ *        Workers drop attached tasks, which weren't started yet, and long running task may poll the token itself,
+ *        check is a single relaxed atomic load. Default constructed token is never canceled.
+ */
+class CancellationToken
+{
+public:
+
+    CancellationToken() = default;
+
+    inline bool isCancellationRequested() const { return state_ != nullptr && state_->load(std::memory_order_relaxed); }
+
+private:
+
+    friend class CancellationSource;
+
+    explicit CancellationToken(const std::shared_ptr<const std::atomic<bool>> & state) : state_{ state } { }
+
+private:
+
+    std::shared_ptr<const std::atomic<bool>> state_;
+};
+
+
+/**
+ * @brief Write side of the cooperative cancellation, one cancel() reaches all tokens got from the source.
+ *        Cancellation can't be undone, new source is needed for the next batch of tasks.
+ */
+class CancellationSource
+{
+public:
+
+    CancellationSource() : state_{ std::make_shared<std::atomic<bool>>(false) } { }
+
+    inline CancellationToken getToken() const           { return CancellationToken{ state_ }; }
+    inline bool isCancellationRequested() const         { return state_->load(std::memory_order_relaxed); }
+
+    //! Flag doesn't guard any data, so relaxed ordering is enough
+    inline void cancel()                                { state_->store(true, std::memory_order_relaxed); }
+
+private:
+
+    std::shared_ptr<std::atomic<bool>> state_;
+};
+
+
+#endif // _CANCELLATIONTOKEN_H_
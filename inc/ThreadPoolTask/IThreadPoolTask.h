@@ -2,7 +2,11 @@
 #define _ITHREADPOOLTASK_H_
 
 
+#include <atomic>
+#include <memory>
+
 #include "OSAL.h"
+#include "CancellationToken.h"
 
 
 class IThreadPoolTask
@@ -18,12 +22,88 @@ public:
         CANCELED            ///< State when task is canceled.
     };
 
+    //! Number of canceled tasks (tombstones), which are still kept in the queues of the scheduler
+    using TombstonesCounter = std::atomic<size_t>;
+
+    //! Number of tasks admitted by the thread pool with bounded queue, which are neither taken for execution nor canceled yet
+    using QueuedTasksCounter = std::atomic<size_t>;
+
+    static const int64_t ANY_NUMA_NODE{ -1 };
+    static const uint8_t NO_SCHEDULING_BUCKET{ 0u };
+    static const uint8_t NUMBER_OF_SCHEDULING_BUCKETS{ 4u };
+
     virtual ~IThreadPoolTask () = default;
 
     virtual State getState() const = 0;
     virtual uint64_t getId() const = 0;
+
+    /**
+     * @brief Time when task was added to the thread pool (OSAL::Time::getCurrentTime), 0 if it was never added.
+     */
+    virtual uint64_t getAddedTime() const = 0;
+    virtual void setAddedTime(const uint64_t addedTime) = 0;
+
+    /**
+     * @brief NUMA node where task's data lives. NUMA aware thread pool executes task by the workers of this node.
+     */
+    virtual int64_t getNumaNode() const = 0;
+    virtual void setNumaNode(const int64_t numaNode) = 0;
+
+    /**
+     * @brief Blocking task (e.g. waiting for I/O) is executed by the separate class of workers, if thread pool has it.
+     */
+    virtual bool isBlocking() const = 0;
+    virtual void setBlocking(const bool isBlocking) = 0;
+
+    /**
+     * @brief Bucket of the task inside its scheduler (e.g. priority or burst time), latency statistic is broken down by it.
+     *        Buckets out of NUMBER_OF_SCHEDULING_BUCKETS are counted as NO_SCHEDULING_BUCKET.
+     */
+    virtual uint8_t getSchedulingBucket() const = 0;
+
+    /**
+     * @brief Time (OSAL::Time::getCurrentTime) after which the task isn't worth executing, e.g. its client has already timed out.
+     *        Worker cancels the task instead of execution, if deadline has passed. 0 means no deadline.
+     */
+    virtual uint64_t getDeadline() const = 0;
+    virtual void setDeadline(const uint64_t deadline) = 0;
+
+    /**
+     * @brief Worker cancels the task instead of execution, if cancellation is requested by the source of the token.
+     * @note Token must be set before the task is added to the thread pool.
+     */
+    virtual bool isCancellationRequested() const = 0;
+    virtual void setCancellationToken(const CancellationToken & cancellationToken) = 0;
+
     virtual Result execute() = 0;
+
+    /**
+     * @brief Only created or submitted task can be canceled, submitted function with its captures is released immediately.
+     *        Task, which is kept by the scheduler, becomes a tombstone there: it's excluded from the counts of the scheduler
+     *        and it's skipped and reclaimed when the scheduler dequeues it.
+     */
     virtual Result cancel() = 0;
+
+    /**
+     * @brief Scheduler attaches its counter of tombstones, when it takes the task, and detaches it, when the task leaves it.
+     *        Canceled task is counted by the attached counter, so the scheduler never searches its queues for tombstones.
+     * @return true if task is canceled.
+     */
+    virtual bool attachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter) = 0;
+    virtual bool detachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter) = 0;
+
+    /**
+     * @brief Thread pool attaches its counter of queued tasks, when it admits the task. Counter is already incremented for the task,
+     *        task decrements and releases it once it leaves submitted state, when it starts execution or it's canceled.
+     * @return false if task isn't submitted or it's already counted, then the caller takes its increment back.
+     */
+    virtual bool attachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter) = 0;
+
+    /**
+     * @brief Thread pool detaches its counter from the task, which leaves it without execution, e.g. removed or cleared task.
+     * @return true if the task was counted by the counter and it's decremented now.
+     */
+    virtual bool detachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter) = 0;
 };
 
 #endif // _ITHREADPOOLTASK_H_
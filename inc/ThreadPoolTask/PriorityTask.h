@@ -25,6 +25,8 @@ public:
     Priority getPriority() const;
     void setPriority(const Priority priority);
 
+    uint8_t getSchedulingBucket() const override;
+
 private:
 
     std::atomic<Priority> priority_;
@@ -0,0 +1,33 @@
+#ifndef _TENANTTASK_H_
+#define _TENANTTASK_H_
+
+
+#include <string>
+
+#include "ThreadPoolTask.h"
+
+
+/**
+ * @brief Task of the named tenant (service, task group). Fair share scheduler splits execution among tenants by their weights.
+ *        Tenant is fixed at creation, so it's never changed while task is scheduled.
+ */
+class TenantTask : public ThreadPoolTask
+{
+public:
+
+    static const std::string DEFAULT_TENANT;
+
+public:
+
+    TenantTask();
+    explicit TenantTask(const std::string & tenant);
+
+    const std::string & getTenant() const;
+
+private:
+
+    const std::string tenant_;
+};
+
+
+#endif // _TENANTTASK_H_
@@ -5,6 +5,7 @@
 #include <functional>
 #include <future>
 #include <atomic>
+#include <mutex>
 #include <vector>
 
 #include "IThreadPoolTask.h"
@@ -115,14 +116,45 @@ public:
 
     IThreadPoolTask::State getState() const override;
     uint64_t getId() const override;
+    uint64_t getAddedTime() const override;
+    void setAddedTime(const uint64_t addedTime) override;
+    int64_t getNumaNode() const override;
+    void setNumaNode(const int64_t numaNode) override;
+    bool isBlocking() const override;
+    void setBlocking(const bool isBlocking) override;
+    uint8_t getSchedulingBucket() const override;
+    uint64_t getDeadline() const override;
+    void setDeadline(const uint64_t deadline) override;
+    bool isCancellationRequested() const override;
+    void setCancellationToken(const CancellationToken & cancellationToken) override;
     Result execute() override;
     Result cancel() override;
+    bool attachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter) override;
+    bool detachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter) override;
+    bool attachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter) override;
+    bool detachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter) override;
 
 protected:
 
     uint64_t id_;
     std::atomic<IThreadPoolTask::State> state_;
+    std::atomic<uint64_t> addedTime_;
+    std::atomic<int64_t> numaNode_;
+    std::atomic<bool> isBlocking_;
+    std::atomic<uint64_t> deadline_;
+    CancellationToken cancellationToken_;
     std::function<void()> wrappedFunction_;
+
+    //! Cancellation and changes of the attached counters are serialized, so the tombstone is counted exactly once,
+    //! execution releases the queued tasks counter without locking through the flag
+    std::mutex countersMutex_;
+    std::shared_ptr<TombstonesCounter> tombstonesCounter_;
+    std::shared_ptr<QueuedTasksCounter> queuedTasksCounter_;
+    std::atomic<bool> isQueuedTasksCounterAttached_;
+
+private:
+
+    bool releaseQueuedTasksCounter();
 };
 
 
@@ -134,9 +166,12 @@ auto ThreadPoolTask::submitOne(Function && function, Args &&... args) -> std::fu
     using ResultType = decltype(function(args...));
 
     std::function<ResultType()> bindedFunction{ std::bind(std::forward<Function>(function), std::forward<Args>(args)...) };
-    const auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>(bindedFunction);
 
-    wrappedFunction_ = [packagedTask] { (*packagedTask)(); };
+    // Shared state of the future keeps only the invoker, captures are kept by the wrapped function, so cancel() releases them
+    const auto packagedTask = std::make_shared<std::packaged_task<ResultType(const std::function<ResultType()> &)>>(
+                                  [](const std::function<ResultType()> & invokedFunction) { return invokedFunction(); });
+
+    wrappedFunction_ = [packagedTask, bindedFunction] { (*packagedTask)(bindedFunction); };
     state_.store(IThreadPoolTask::State::SUBMITTED);
 
     return packagedTask->get_future();
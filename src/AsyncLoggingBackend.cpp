@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "AsyncLoggingBackend.h"
+#include "OSALTime.h"
+#include "Logging.h"
+
+
+const size_t AsyncLoggingBackend::INSTANCE_NAME_SIZE;
+const size_t AsyncLoggingBackend::MESSAGE_SIZE;
+const int64_t AsyncLoggingBackend::DRAIN_PERIOD_IN_MICROSECONDS;
+
+thread_local AsyncLoggingBackend::RingOwner AsyncLoggingBackend::currentThreadRingOwner_;
+
+
+AsyncLoggingBackend & AsyncLoggingBackend::getInstance()
+{
+    static AsyncLoggingBackend instance;
+    return instance;
+}
+
+
+AsyncLoggingBackend::AsyncLoggingBackend()
+    : isStarted_{ false }
+    , capacityPerThread_{ 0u }
+    , startSteadyTime_{ 0u }
+    , startSystemTime_{}
+{
+}
+
+
+AsyncLoggingBackend::~AsyncLoggingBackend()
+{
+    stop();
+}
+
+
+AsyncLoggingBackend::Ring::Ring(const uint32_t capacity)
+    : records(std::max(capacity, 1u))
+    , head{}
+    , tail{}
+    , isAbandoned{ false }
+    , isWriting{ false }
+{
+}
+
+
+AsyncLoggingBackend::RingOwner::~RingOwner()
+{
+    if (ring != nullptr)
+    {
+        ring->isAbandoned.store(true, std::memory_order_release);
+    }
+}
+
+
+bool AsyncLoggingBackend::start(const std::string & filePath, const uint32_t capacityPerThread)
+{
+    std::lock_guard<std::mutex> stateLock{ stateMutex_ };
+
+    if (isStarted())
+    {
+        return false;
+    }
+
+    if (!filePath.empty())
+    {
+        file_.open(filePath, std::ios::out | std::ios::app);
+        if (!file_.is_open())
+        {
+            return false;
+        }
+    }
+
+    // Records keep cheap monotonic time, it's converted to the wall clock only when records are written
+    startSteadyTime_ = OSAL::Time::getCurrentTime();
+    startSystemTime_ = std::chrono::system_clock::now();
+    capacityPerThread_.store(capacityPerThread, std::memory_order_relaxed);
+
+    isStarted_.store(true, std::memory_order_release);
+    thread_ = std::thread{ [this] { run(); } };
+
+    return true;
+}
+
+
+void AsyncLoggingBackend::stop()
+{
+    std::lock_guard<std::mutex> stateLock{ stateMutex_ };
+
+    if (!isStarted())
+    {
+        return;
+    }
+
+    isStarted_.store(false);
+
+    // Records of threads, which saw the backend started, must be in their rings before the last drain,
+    // threads checking the state after the store fall back to synchronous logging
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    ringsMutex_.lock();
+    rings = rings_;
+    ringsMutex_.unlock();
+
+    for (auto && ring : rings)
+    {
+        while (ring->isWriting.load())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    wakeUpMutex_.lock();
+    wakeUpCondition_.notify_all();
+    wakeUpMutex_.unlock();
+
+    thread_.join();
+
+    // Records added after the last drain of the background thread
+    drain();
+
+    if (file_.is_open())
+    {
+        file_.close();
+    }
+}
+
+
+bool AsyncLoggingBackend::write(const char * levelName, const std::string & instanceName, const char * message, va_list args)
+{
+    if (!isStarted())
+    {
+        return false;
+    }
+
+    Ring & ring = getCurrentThreadRing();
+
+    // Pairs with stop, which stores the state before it waits for writing rings, both are sequentially consistent
+    ring.isWriting.store(true);
+
+    if (!isStarted_.load())
+    {
+        ring.isWriting.store(false, std::memory_order_release);
+        return false;
+    }
+
+    const uint64_t head{ ring.head.value.load(std::memory_order_relaxed) };
+    const uint64_t tail{ ring.tail.value.load(std::memory_order_acquire) };
+
+    if (head - tail >= ring.records.size())
+    {
+        ring.isWriting.store(false, std::memory_order_release);
+        ++numberOfDroppedRecords_;
+        return true;
+    }
+
+    Record & record = ring.records[head % ring.records.size()];
+
+    record.time = OSAL::Time::getCurrentTime();
+    record.levelName = levelName;
+
+    const size_t instanceNameSize{ std::min(instanceName.size(), INSTANCE_NAME_SIZE - 1u) };
+    std::memcpy(record.instanceName, instanceName.data(), instanceNameSize);
+    record.instanceName[instanceNameSize] = '\0';
+
+    vsnprintf(record.message, MESSAGE_SIZE, message, args);
+
+    ring.head.value.store(head + 1u, std::memory_order_release);
+    ring.isWriting.store(false, std::memory_order_release);
+
+    return true;
+}
+
+
+void AsyncLoggingBackend::flush()
+{
+    if (isStarted())
+    {
+        drain();
+    }
+}
+
+
+uint64_t AsyncLoggingBackend::getNumberOfDroppedRecords() const
+{
+    return numberOfDroppedRecords_.load();
+}
+
+
+AsyncLoggingBackend::Ring & AsyncLoggingBackend::getCurrentThreadRing()
+{
+    if (nullptr == currentThreadRingOwner_.ring)
+    {
+        currentThreadRingOwner_.ring = std::make_shared<Ring>(capacityPerThread_.load(std::memory_order_relaxed));
+
+        std::lock_guard<std::mutex> ringsLock{ ringsMutex_ };
+        rings_.push_back(currentThreadRingOwner_.ring);
+    }
+
+    return *currentThreadRingOwner_.ring;
+}
+
+
+void AsyncLoggingBackend::drain()
+{
+    std::lock_guard<std::mutex> drainLock{ drainMutex_ };
+
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    ringsMutex_.lock();
+    rings = rings_;
+    ringsMutex_.unlock();
+
+    std::vector<std::pair<uint64_t, std::string>> lines;
+
+    for (auto && ring : rings)
+    {
+        const uint64_t head{ ring->head.value.load(std::memory_order_acquire) };
+        uint64_t tail{ ring->tail.value.load(std::memory_order_relaxed) };
+
+        for (; tail < head; ++tail)
+        {
+            const Record & record = ring->records[tail % ring->records.size()];
+            const auto systemTime = startSystemTime_ + std::chrono::microseconds(static_cast<int64_t>(record.time - startSteadyTime_));
+
+            lines.emplace_back(record.time, Logging::formatLine(systemTime, record.instanceName, record.levelName, record.message));
+        }
+
+        ring->tail.value.store(tail, std::memory_order_release);
+    }
+
+    // Every ring is ordered, but threads interleave
+    std::stable_sort(lines.begin(), lines.end(), [](const std::pair<uint64_t, std::string> & lhs, const std::pair<uint64_t, std::string> & rhs)
+                     {
+                         return lhs.first < rhs.first;
+                     });
+
+    std::ostream & stream = file_.is_open() ? static_cast<std::ostream &>(file_) : std::cout;
+    for (auto && line : lines)
+    {
+        stream << line.second;
+    }
+    stream.flush();
+
+    // Ring of finished thread is removed once nothing is left in it
+    ringsMutex_.lock();
+    rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<Ring> & ring)
+                                {
+                                    return ring->isAbandoned.load(std::memory_order_acquire)
+                                        && ring->tail.value.load(std::memory_order_relaxed) == ring->head.value.load(std::memory_order_acquire);
+                                }),
+                 rings_.end());
+    ringsMutex_.unlock();
+}
+
+
+void AsyncLoggingBackend::run()
+{
+    while (isStarted())
+    {
+        drain();
+
+        std::unique_lock<std::mutex> wakeUpLock{ wakeUpMutex_ };
+        wakeUpCondition_.wait_for(wakeUpLock, std::chrono::microseconds(DRAIN_PERIOD_IN_MICROSECONDS), [this] { return !isStarted(); });
+    }
+}
@@ -1,18 +1,19 @@
 #include "Logging.h"
+#include "AsyncLoggingBackend.h"
 #include <iostream>
 #include <cstdarg>
 #include <cstdio>
+#include <ctime>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 
-std::map <Logging::LoggingLevel, bool > Logging::loggingLevels_
-{ { Logging::LoggingLevel::LOG_DEBUG, false },
-  { Logging::LoggingLevel::LOG_ERROR, true },
-  { Logging::LoggingLevel::LOG_INFO, true },
-  { Logging::LoggingLevel::LOG_WARNING, true },
-  { Logging::LoggingLevel::LOG_DISABLED, false }
-};
+std::atomic<uint32_t> Logging::enabledLevels_
+{ (1u << Logging::LoggingLevel::LOG_ERROR) | (1u << Logging::LoggingLevel::LOG_WARNING) | (1u << Logging::LoggingLevel::LOG_INFO) };
 
 Logging::Logging(const std::string & instanceName)
     : instanceName_(instanceName)
@@ -64,52 +65,147 @@ void Logging::logError (const char * message, ...) const
 }
 
 
-Logging* Logging::getNewLoggingInstance(const std::string subInstanceName) const
+namespace
 {
-    return new Logging(instanceName_ + "(" + subInstanceName + ")");
+    struct LoggingRegistry
+    {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<Logging>> instances;
+    };
+
+    //! Registry is never destroyed, so static objects could log and get handles during the exit
+    LoggingRegistry & getLoggingRegistry()
+    {
+        static LoggingRegistry * registry{ new LoggingRegistry{} };
+        return *registry;
+    }
+
+    //! ATTENTION! This method is called with the registry mutex locked
+    Logging * getInstanceLocked(LoggingRegistry & registry, const std::string & instanceName)
+    {
+        std::unique_ptr<Logging> & instance = registry.instances[instanceName];
+
+        if (nullptr == instance)
+        {
+            instance.reset(new Logging{ instanceName });
+        }
+
+        return instance.get();
+    }
+} // namespace
+
+
+Logging * Logging::getSubInstance(const char * subInstanceName) const
+{
+    LoggingRegistry & registry = getLoggingRegistry();
+    std::lock_guard<std::mutex> lock{ registry.mutex };
+
+    for (auto && subInstance : subInstances_)
+    {
+        if (0 == std::strcmp(subInstance.first.c_str(), subInstanceName))
+        {
+            return subInstance.second;
+        }
+    }
+
+    Logging * subInstance{ getInstanceLocked(registry, instanceName_ + "(" + subInstanceName + ")") };
+    subInstances_.emplace_back(subInstanceName, subInstance);
+
+    return subInstance;
+}
+
+
+const std::string & Logging::getInstanceName() const
+{
+    return instanceName_;
+}
+
+
+Logging * Logging::getInstance(const std::string & instanceName)
+{
+    LoggingRegistry & registry = getLoggingRegistry();
+    std::lock_guard<std::mutex> lock{ registry.mutex };
+
+    return getInstanceLocked(registry, instanceName);
 }
 
 
 void Logging::enableLoggingLevel(const LoggingLevel level)
 {
-    loggingLevels_[level] = true;
+    enabledLevels_.fetch_or(1u << level, std::memory_order_relaxed);
 }
 
 
 void Logging::disableLoggingLevel(const LoggingLevel level)
 {
-    loggingLevels_[level] = false;
+    enabledLevels_.fetch_and(~(1u << level), std::memory_order_relaxed);
 }
 
-void Logging::logFormatted(const std::string & logLevel,
-                           const char * message,
-                           va_list args) const
+bool Logging::enableAsyncLogging(const std::string & filePath, const uint32_t capacityPerThread)
 {
-    static OSAL::Mutex mutex;
-    mutex.lock();
+    return AsyncLoggingBackend::getInstance().start(filePath, capacityPerThread);
+}
 
-    char buffer[1024];
-    vsprintf_s(buffer, sizeof(buffer), message, args);
-    va_end(args);
 
-    auto currentTime = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(currentTime);
-    std::tm tm = *std::localtime(&time_t);
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
+void Logging::disableAsyncLogging()
+{
+    AsyncLoggingBackend::getInstance().stop();
+}
 
-    std::cout << oss.str() << " " << instanceName_ << " " << logLevel << " " << std::string(buffer) << "\n";
 
-    mutex.unlock();
+void Logging::flushAsyncLogging()
+{
+    AsyncLoggingBackend::getInstance().flush();
+}
+
+
+uint64_t Logging::getNumberOfDroppedRecords()
+{
+    return AsyncLoggingBackend::getInstance().getNumberOfDroppedRecords();
+}
+
+
+std::string Logging::formatLine(const std::chrono::system_clock::time_point & time,
+                                const char * instanceName,
+                                const char * levelName,
+                                const char * message)
+{
+    const std::time_t timeT{ std::chrono::system_clock::to_time_t(time) };
+    std::tm tm{};
+
+#ifdef _WIN32
+    localtime_s(&tm, &timeT);
+#else
+    localtime_r(&timeT, &tm);
+#endif
+
+    std::ostringstream oss;
+    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << " " << instanceName << " " << levelName << " " << message << "\n";
+
+    return oss.str();
 }
 
 
-inline bool Logging::isEnabled(const LoggingLevel level) const
+void Logging::logFormatted(const char * levelName,
+                           const char * message,
+                           va_list args) const
 {
-    if (loggingLevels_[LoggingLevel::LOG_DISABLED])
+    // Backend, which is stopping, doesn't take the record, so it's written synchronously instead of being lost
+    if (AsyncLoggingBackend::getInstance().write(levelName, instanceName_, message, args))
     {
-        return false;
+        return;
     }
 
-    return loggingLevels_[level];
-}
\ No newline at end of file
+    // Only console output is serialized, formatting is done by the logging thread outside of the lock
+    char buffer[1024];
+    vsnprintf(buffer, sizeof(buffer), message, args);
+
+    const std::string line{ formatLine(std::chrono::system_clock::now(), instanceName_.c_str(), levelName, buffer) };
+
+    static OSAL::Mutex mutex;
+    mutex.lock();
+
+    std::cout << line;
+
+    mutex.unlock();
+}
@@ -0,0 +1,336 @@
+#include "OSALCpuTopology.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <tuple>
+
+
+const int64_t OSAL::CpuTopology::UNKNOWN_CACHE;
+const int64_t OSAL::CpuTopology::UNKNOWN_NUMA_NODE;
+
+
+OSAL::CpuTopology::CpuTopology(const std::vector<Cpu> & cpus)
+    : cpus_{ cpus }
+{
+}
+
+
+OSAL::CpuTopology OSAL::CpuTopology::read(const std::string & sysfsPath, const std::string & nodeSysfsPath)
+{
+    std::vector<Cpu> cpus;
+
+    // Nodes list their CPUs, so mapping is built once for all CPUs
+    std::map<uint32_t, uint32_t> cpuToNumaNode;
+
+    std::string nodeList;
+    if (readFile(nodeSysfsPath + "/online", nodeList))
+    {
+        for (auto && nodeId : parseCpuList(nodeList))
+        {
+            std::string nodeCpuList;
+            if (readFile(nodeSysfsPath + "/node" + std::to_string(nodeId) + "/cpulist", nodeCpuList))
+            {
+                for (auto && cpuId : parseCpuList(nodeCpuList))
+                {
+                    cpuToNumaNode[cpuId] = nodeId;
+                }
+            }
+        }
+    }
+
+    std::string cpuList;
+    if (readFile(sysfsPath + "/online", cpuList) || readFile(sysfsPath + "/present", cpuList))
+    {
+        for (auto && cpuId : parseCpuList(cpuList))
+        {
+            const std::string cpuPath{ sysfsPath + "/cpu" + std::to_string(cpuId) };
+
+            Cpu cpu{};
+            cpu.id = cpuId;
+
+            // Without topology every CPU is considered as separate core
+            if (!readNumber(cpuPath + "/topology/core_id", cpu.coreId))
+            {
+                cpu.coreId = cpuId;
+            }
+
+            readNumber(cpuPath + "/topology/physical_package_id", cpu.packageId);
+
+            const auto numaNodeIt = cpuToNumaNode.find(cpuId);
+            if (numaNodeIt != cpuToNumaNode.end())
+            {
+                cpu.numaNodeId = numaNodeIt->second;
+            }
+
+            // Cache is identified by the lowest CPU sharing it, so ids are comparable among all CPUs
+            for (uint32_t index = 0u; ; ++index)
+            {
+                const std::string cachePath{ cpuPath + "/cache/index" + std::to_string(index) };
+
+                uint32_t level{ 0u };
+                if (!readNumber(cachePath + "/level", level))
+                {
+                    break;
+                }
+
+                std::string type;
+                readFile(cachePath + "/type", type);
+
+                std::string sharedCpuList;
+                if (type.compare(0u, 11u, "Instruction") == 0 || !readFile(cachePath + "/shared_cpu_list", sharedCpuList))
+                {
+                    continue;
+                }
+
+                const std::vector<uint32_t> sharedCpus{ parseCpuList(sharedCpuList) };
+                if (sharedCpus.empty())
+                {
+                    continue;
+                }
+
+                if (2u == level)
+                {
+                    cpu.l2CacheId = sharedCpus.front();
+                }
+                else if (3u == level)
+                {
+                    cpu.l3CacheId = sharedCpus.front();
+                }
+            }
+
+            cpus.push_back(cpu);
+        }
+    }
+
+    if (cpus.empty())
+    {
+        const uint32_t numberOfCpus{ std::max(std::thread::hardware_concurrency(), 1u) };
+
+        for (uint32_t cpuId = 0u; cpuId < numberOfCpus; ++cpuId)
+        {
+            Cpu cpu{};
+            cpu.id = cpuId;
+            cpu.coreId = cpuId;
+
+            cpus.push_back(cpu);
+        }
+    }
+
+    return CpuTopology{ cpus };
+}
+
+
+std::vector<uint32_t> OSAL::CpuTopology::parseCpuList(const std::string & cpuList)
+{
+    std::vector<uint32_t> cpus;
+
+    std::stringstream stream{ cpuList };
+    std::string range;
+
+    while (std::getline(stream, range, ','))
+    {
+        uint32_t first{ 0u };
+        uint32_t last{ 0u };
+        char separator{ 0 };
+
+        std::stringstream rangeStream{ range };
+        if (!(rangeStream >> first))
+        {
+            continue;
+        }
+
+        last = first;
+        if (rangeStream >> separator && '-' == separator)
+        {
+            rangeStream >> last;
+        }
+
+        for (uint32_t cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+}
+
+
+const std::vector<OSAL::CpuTopology::Cpu> & OSAL::CpuTopology::getCpus() const
+{
+    return cpus_;
+}
+
+
+size_t OSAL::CpuTopology::getSize() const
+{
+    return cpus_.size();
+}
+
+
+const OSAL::CpuTopology::Cpu * OSAL::CpuTopology::findCpu(const uint32_t id) const
+{
+    for (auto && cpu : cpus_)
+    {
+        if (cpu.id == id)
+        {
+            return &cpu;
+        }
+    }
+
+    return nullptr;
+}
+
+
+bool OSAL::CpuTopology::areSharingCache(const int64_t firstCpuId, const int64_t secondCpuId) const
+{
+    if (firstCpuId < 0 || secondCpuId < 0)
+    {
+        return false;
+    }
+
+    const Cpu * firstCpu{ findCpu(static_cast<uint32_t>(firstCpuId)) };
+    const Cpu * secondCpu{ findCpu(static_cast<uint32_t>(secondCpuId)) };
+
+    if (nullptr == firstCpu || nullptr == secondCpu)
+    {
+        return false;
+    }
+
+    return (firstCpu->l2CacheId != UNKNOWN_CACHE && firstCpu->l2CacheId == secondCpu->l2CacheId)
+        || (firstCpu->l3CacheId != UNKNOWN_CACHE && firstCpu->l3CacheId == secondCpu->l3CacheId);
+}
+
+
+std::vector<uint32_t> OSAL::CpuTopology::getNumaNodes() const
+{
+    std::vector<uint32_t> numaNodes;
+
+    for (auto && cpu : cpus_)
+    {
+        numaNodes.push_back(cpu.numaNodeId);
+    }
+
+    std::sort(numaNodes.begin(), numaNodes.end());
+    numaNodes.erase(std::unique(numaNodes.begin(), numaNodes.end()), numaNodes.end());
+
+    return numaNodes;
+}
+
+
+int64_t OSAL::CpuTopology::getNumaNode(const int64_t cpuId) const
+{
+    const Cpu * cpu{ cpuId < 0 ? nullptr : findCpu(static_cast<uint32_t>(cpuId)) };
+
+    return nullptr == cpu ? UNKNOWN_NUMA_NODE : static_cast<int64_t>(cpu->numaNodeId);
+}
+
+
+std::vector<uint32_t> OSAL::CpuTopology::getCompactOrder() const
+{
+    std::vector<uint32_t> order;
+
+    for (auto && cpu : getCpusInCompactOrder())
+    {
+        order.push_back(cpu.id);
+    }
+
+    return order;
+}
+
+
+std::vector<uint32_t> OSAL::CpuTopology::getScatterOrder() const
+{
+    const std::vector<Cpu> cpus{ getCpusInCompactOrder() };
+
+    // Rank of CPU inside its core and rank of core inside its package
+    std::vector<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>> ranks;  // thread rank, core rank, package, id
+
+    uint32_t threadRank{ 0u };
+    uint32_t coreRank{ 0u };
+
+    for (size_t i = 0u; i < cpus.size(); ++i)
+    {
+        if (i > 0u)
+        {
+            const bool isSamePackage{ cpus[i].packageId == cpus[i - 1u].packageId };
+            const bool isSameCore{ isSamePackage && cpus[i].coreId == cpus[i - 1u].coreId };
+
+            threadRank = isSameCore ? threadRank + 1u : 0u;
+            coreRank = isSameCore ? coreRank : (isSamePackage ? coreRank + 1u : 0u);
+        }
+
+        ranks.emplace_back(threadRank, coreRank, cpus[i].packageId, cpus[i].id);
+    }
+
+    std::sort(ranks.begin(), ranks.end());
+
+    std::vector<uint32_t> order;
+
+    for (auto && rank : ranks)
+    {
+        order.push_back(std::get<3>(rank));
+    }
+
+    return order;
+}
+
+
+std::vector<uint32_t> OSAL::CpuTopology::getPhysicalCoresOrder() const
+{
+    const std::vector<Cpu> cpus{ getCpusInCompactOrder() };
+
+    std::vector<uint32_t> order;
+
+    for (size_t i = 0u; i < cpus.size(); ++i)
+    {
+        if (0u == i || cpus[i].packageId != cpus[i - 1u].packageId || cpus[i].coreId != cpus[i - 1u].coreId)
+        {
+            order.push_back(cpus[i].id);
+        }
+    }
+
+    return order;
+}
+
+
+bool OSAL::CpuTopology::readFile(const std::string & path, std::string & content)
+{
+    std::ifstream file{ path };
+
+    if (!file.is_open() || !std::getline(file, content))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+
+bool OSAL::CpuTopology::readNumber(const std::string & path, uint32_t & number)
+{
+    std::string content;
+
+    if (!readFile(path, content))
+    {
+        return false;
+    }
+
+    std::stringstream stream{ content };
+
+    return static_cast<bool>(stream >> number);
+}
+
+
+std::vector<OSAL::CpuTopology::Cpu> OSAL::CpuTopology::getCpusInCompactOrder() const
+{
+    std::vector<Cpu> cpus{ cpus_ };
+
+    std::sort(cpus.begin(), cpus.end(), [](const Cpu & lhs, const Cpu & rhs)
+              {
+                  return std::tie(lhs.packageId, lhs.coreId, lhs.id) < std::tie(rhs.packageId, rhs.coreId, rhs.id);
+              });
+
+    return cpus;
+}
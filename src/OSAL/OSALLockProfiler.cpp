@@ -0,0 +1,221 @@
+#include "OSALLockProfiler.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+
+const uint32_t OSAL::LockProfiler::MAX_NUMBER_OF_LOCKS;
+const uint32_t OSAL::LockProfiler::INVALID_LOCK_ID;
+
+thread_local OSAL::LockProfiler::ThreadSlotsOwner OSAL::LockProfiler::currentThreadSlotsOwner_;
+
+
+OSAL::LockProfiler & OSAL::LockProfiler::getInstance()
+{
+    // Profiler is never destroyed, so static mutexes are profiled till the end of the process
+    static LockProfiler * lockProfiler{ new LockProfiler{} };
+    return *lockProfiler;
+}
+
+
+bool OSAL::LockProfiler::isEnabled()
+{
+#ifdef THREAD_POOL_LOCK_PROFILING
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+uint64_t OSAL::LockProfiler::getCurrentTime()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+OSAL::LockProfiler::LockProfiler()
+    : finishedThreadsStatistics_(MAX_NUMBER_OF_LOCKS)
+{
+}
+
+
+OSAL::LockProfiler::ThreadSlots::ThreadSlots()
+    : slots{ new Slot[MAX_NUMBER_OF_LOCKS]() }
+{
+}
+
+
+OSAL::LockProfiler::ThreadSlotsOwner::~ThreadSlotsOwner()
+{
+    if (nullptr == threadSlots)
+    {
+        return;
+    }
+
+    LockProfiler & lockProfiler = LockProfiler::getInstance();
+    std::lock_guard<std::mutex> lock{ lockProfiler.mutex_ };
+
+    addSlots(*threadSlots, lockProfiler.finishedThreadsStatistics_);
+
+    auto & threadsSlots = lockProfiler.threadsSlots_;
+    threadsSlots.erase(std::remove(threadsSlots.begin(), threadsSlots.end(), threadSlots), threadsSlots.end());
+    threadSlots.reset();
+}
+
+
+uint32_t OSAL::LockProfiler::registerLock(const std::string & name)
+{
+    std::lock_guard<std::mutex> lock{ mutex_ };
+
+    auto foundName = std::find(names_.begin(), names_.end(), name);
+    if (foundName != names_.end())
+    {
+        return static_cast<uint32_t>(foundName - names_.begin());
+    }
+
+    if (names_.size() >= MAX_NUMBER_OF_LOCKS)
+    {
+        return INVALID_LOCK_ID;
+    }
+
+    names_.push_back(name);
+
+    return static_cast<uint32_t>(names_.size() - 1u);
+}
+
+
+void OSAL::LockProfiler::recordAcquisition(const uint32_t lockId, const bool isContended, const uint64_t waitTime)
+{
+    Slot * slot{ getCurrentThreadSlot(lockId) };
+    if (nullptr == slot)
+    {
+        return;
+    }
+
+    // Slot has single writer, so load and store are enough
+    slot->numberOfAcquisitions.store(slot->numberOfAcquisitions.load(std::memory_order_relaxed) + 1u, std::memory_order_relaxed);
+
+    if (isContended)
+    {
+        slot->numberOfContendedAcquisitions.store(slot->numberOfContendedAcquisitions.load(std::memory_order_relaxed) + 1u,
+                                                  std::memory_order_relaxed);
+        slot->totalWaitTime.store(slot->totalWaitTime.load(std::memory_order_relaxed) + waitTime, std::memory_order_relaxed);
+
+        if (waitTime > slot->maxWaitTime.load(std::memory_order_relaxed))
+        {
+            slot->maxWaitTime.store(waitTime, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+void OSAL::LockProfiler::recordRelease(const uint32_t lockId, const uint64_t holdTime)
+{
+    Slot * slot{ getCurrentThreadSlot(lockId) };
+    if (nullptr == slot)
+    {
+        return;
+    }
+
+    slot->totalHoldTime.store(slot->totalHoldTime.load(std::memory_order_relaxed) + holdTime, std::memory_order_relaxed);
+
+    if (holdTime > slot->maxHoldTime.load(std::memory_order_relaxed))
+    {
+        slot->maxHoldTime.store(holdTime, std::memory_order_relaxed);
+    }
+}
+
+
+std::vector<OSAL::LockProfiler::LockStatistic> OSAL::LockProfiler::getStatistics() const
+{
+    std::vector<LockStatistic> statistics;
+
+    {
+        std::lock_guard<std::mutex> lock{ mutex_ };
+
+        statistics = finishedThreadsStatistics_;
+
+        for (auto && threadSlots : threadsSlots_)
+        {
+            addSlots(*threadSlots, statistics);
+        }
+
+        statistics.resize(names_.size());
+
+        for (size_t i = 0u; i < names_.size(); ++i)
+        {
+            statistics[i].name = names_[i];
+        }
+    }
+
+    std::stable_sort(statistics.begin(), statistics.end(),
+                     [](const LockStatistic & first, const LockStatistic & second)
+                     {
+                         return first.totalWaitTime > second.totalWaitTime;
+                     });
+
+    return statistics;
+}
+
+
+std::string OSAL::LockProfiler::getReport() const
+{
+    std::ostringstream report;
+
+    report << std::left << std::setw(48) << "Lock" << std::right
+           << std::setw(14) << "Acquisitions" << std::setw(14) << "Contended"
+           << std::setw(14) << "Wait[us]" << std::setw(14) << "Max wait[us]"
+           << std::setw(14) << "Hold[us]" << std::setw(14) << "Max hold[us]" << "\n";
+
+    for (auto && statistic : getStatistics())
+    {
+        report << std::left << std::setw(48) << statistic.name << std::right
+               << std::setw(14) << statistic.numberOfAcquisitions << std::setw(14) << statistic.numberOfContendedAcquisitions
+               << std::setw(14) << statistic.totalWaitTime / 1000u << std::setw(14) << statistic.maxWaitTime / 1000u
+               << std::setw(14) << statistic.totalHoldTime / 1000u << std::setw(14) << statistic.maxHoldTime / 1000u << "\n";
+    }
+
+    return report.str();
+}
+
+
+OSAL::LockProfiler::Slot * OSAL::LockProfiler::getCurrentThreadSlot(const uint32_t lockId)
+{
+    if (lockId >= MAX_NUMBER_OF_LOCKS)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<ThreadSlots> & threadSlots = currentThreadSlotsOwner_.threadSlots;
+
+    if (nullptr == threadSlots)
+    {
+        threadSlots = std::make_shared<ThreadSlots>();
+
+        std::lock_guard<std::mutex> lock{ mutex_ };
+        threadsSlots_.push_back(threadSlots);
+    }
+
+    return &threadSlots->slots[lockId];
+}
+
+
+//! ATTENTION! This method is called with the mutex_ locked
+void OSAL::LockProfiler::addSlots(const ThreadSlots & threadSlots, std::vector<LockStatistic> & statistics)
+{
+    for (size_t i = 0u; i < statistics.size(); ++i)
+    {
+        const Slot & slot = threadSlots.slots[i];
+        LockStatistic & statistic = statistics[i];
+
+        statistic.numberOfAcquisitions += slot.numberOfAcquisitions.load(std::memory_order_relaxed);
+        statistic.numberOfContendedAcquisitions += slot.numberOfContendedAcquisitions.load(std::memory_order_relaxed);
+        statistic.totalWaitTime += slot.totalWaitTime.load(std::memory_order_relaxed);
+        statistic.maxWaitTime = std::max(statistic.maxWaitTime, slot.maxWaitTime.load(std::memory_order_relaxed));
+        statistic.totalHoldTime += slot.totalHoldTime.load(std::memory_order_relaxed);
+        statistic.maxHoldTime = std::max(statistic.maxHoldTime, slot.maxHoldTime.load(std::memory_order_relaxed));
+    }
+}
@@ -1,5 +1,6 @@
 #include "OSALMonitor.h"
 #include "Logging.h"
+#include "OSALLockProfiler.h"
 
 
 OSAL::Monitor::Monitor(Logging* logging)
@@ -10,30 +11,45 @@ OSAL::Monitor::Monitor(Logging* logging)
 
 Result OSAL::Monitor::wait(const int64_t timeout)
 {
+    // Caller keeps ownership of the locked mutex after waiting, so lock must not unlock it on destruction
     std::unique_lock<std::timed_mutex> lock(mutex_, std::adopt_lock);
-    
+    Result result{ Result::OK };
+
+#ifdef THREAD_POOL_LOCK_PROFILING
+    // Mutex is released while waiting, so holding ends here and starts again after the reacquisition
+    recordUnlocking();
+#endif
+
     if (timeout < 0) 
     {
         condition_.wait(lock);
-        return Result::OK;
     }
     else 
     {
         const auto duration = std::chrono::microseconds(timeout);
-        return (condition_.wait_for(lock, duration) == std::cv_status::timeout) ? Result::TIMEOUT : Result::OK;
+        result = (condition_.wait_for(lock, duration) == std::cv_status::timeout) ? Result::TIMEOUT : Result::OK;
     }
+
+    lock.release();
+
+#ifdef THREAD_POOL_LOCK_PROFILING
+    // Reacquisition after waiting isn't counted as acquisition, otherwise every wake up would inflate it
+    recordRelocked();
+#endif
+
+    return result;
 }
 
 
+//! ATTENTION! This method is called with the monitor locked, it stays locked till caller unlocks it
 void OSAL::Monitor::notify()
 {
-    std::lock_guard<std::timed_mutex> lock(mutex_, std::adopt_lock);
     condition_.notify_one();
 }
 
 
+//! ATTENTION! This method is called with the monitor locked, it stays locked till caller unlocks it
 void OSAL::Monitor::notifyAll()
 {
-    std::lock_guard<std::timed_mutex> lock(mutex_, std::adopt_lock);
     condition_.notify_all();
 }
@@ -1,10 +1,15 @@
 #include "OSALMutex.h"
 #include "Logging.h"
+#include "OSALLockProfiler.h"
 
 
 OSAL::Mutex::Mutex(Logging * logging)
 	: isLocked_{ false }
-	, logging_{ logging == nullptr ? new Logging{ "OSAL::Mutex" } : logging }
+	, logging_{ logging == nullptr ? Logging::getInstance("OSAL::Mutex") : logging }
+#ifdef THREAD_POOL_LOCK_PROFILING
+	, lockProfilerId_{ OSAL::LockProfiler::getInstance().registerLock(logging_->getInstanceName()) }
+	, lockedTime_{ 0u }
+#endif
 {
 }
 
@@ -15,6 +20,17 @@ Result OSAL::Mutex::lock(const int64_t timeout)
 {
 	Result result;
 
+#ifdef THREAD_POOL_LOCK_PROFILING
+	// Uncontended acquisition doesn't read the clock, only waiting is measured
+	if (mutex_.try_lock())
+	{
+		recordLocked(false, 0u);
+		return Result::OK;
+	}
+
+	const uint64_t waitStartTime{ OSAL::LockProfiler::getCurrentTime() };
+#endif
+
 	if (timeout < 0)
 	{
 		mutex_.lock();
@@ -33,11 +49,46 @@ Result OSAL::Mutex::lock(const int64_t timeout)
 		result = isLocked ? Result::OK : Result::TIMEOUT;
 	}
 
+#ifdef THREAD_POOL_LOCK_PROFILING
+	if (Result::OK == result)
+	{
+		recordLocked(true, OSAL::LockProfiler::getCurrentTime() - waitStartTime);
+	}
+#endif
+
 	return result;
 }
 
 
 void OSAL::Mutex::unlock()
 {
+#ifdef THREAD_POOL_LOCK_PROFILING
+	recordUnlocking();
+#endif
+
 	mutex_.unlock();
 }
+
+
+#ifdef THREAD_POOL_LOCK_PROFILING
+//! ATTENTION! This method is called with the mutex locked
+void OSAL::Mutex::recordLocked(const bool isContended, const uint64_t waitTime)
+{
+	lockedTime_ = OSAL::LockProfiler::getCurrentTime();
+	OSAL::LockProfiler::getInstance().recordAcquisition(lockProfilerId_, isContended, waitTime);
+}
+
+
+//! ATTENTION! This method is called with the mutex locked
+void OSAL::Mutex::recordUnlocking()
+{
+	OSAL::LockProfiler::getInstance().recordRelease(lockProfilerId_, OSAL::LockProfiler::getCurrentTime() - lockedTime_);
+}
+
+
+//! ATTENTION! This method is called with the mutex locked
+void OSAL::Mutex::recordRelocked()
+{
+	lockedTime_ = OSAL::LockProfiler::getCurrentTime();
+}
+#endif
@@ -3,12 +3,27 @@
 #include "Logging.h"
 #include <thread>
 
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#elif defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+
+const int64_t OSAL::Thread::NO_AFFINITY;
+
 
 OSAL::Thread::Thread(Logging * logging)
 	: threadMustEnd_{ false }
 	, isFinished_{ true }
+	, finishedMonitor_{ (logging == nullptr ? Logging::getInstance("OSAL::Thread") : logging)->getSubInstance("FinishedMonitor") }
+	, stateMonitor_{ (logging == nullptr ? Logging::getInstance("OSAL::Thread") : logging)->getSubInstance("StateMonitor") }
 	, state_{ State::READY }
-	, logging_{ logging == nullptr ? new Logging{ "OSAL::Thread" } : logging }
+	, affinity_{ NO_AFFINITY }
+	, logging_{ logging == nullptr ? Logging::getInstance("OSAL::Thread") : logging }
 {
 	static std::atomic<uint64_t> id{ 1u };
 	id_ = id.load();
@@ -20,8 +35,20 @@ OSAL::Thread::~Thread()
 {
 	if (thread_.joinable())
 	{
-		threadMustEnd_ = true;
-		thread_.detach();
+		finishedMonitor_.lock();
+		const bool isFinished{ isFinished_ };
+		finishedMonitor_.unlock();
+
+		// Finished thread could still be unlocking finishedMonitor_, so it's joined before members are destroyed
+		if (isFinished && thread_.get_id() != std::this_thread::get_id())
+		{
+			thread_.join();
+		}
+		else
+		{
+			threadMustEnd_ = true;
+			thread_.detach();
+		}
 	}
 }
 
@@ -46,12 +73,18 @@ Result OSAL::Thread::create()
 						finishedMonitor_.unlock();
 					});
 
+		// Pinning failure isn't critical, thread is running anyway
+		if (applyAffinity() != Result::OK)
+		{
+			LOGGING_WARNING(logging_, "Thread with id %" PRIu64 " can't be pinned to CPU %" PRIi64, id_, affinity_);
+		}
+
 		state_ = State::WAITING;
 		result = Result::OK;
 	}
 	else
 	{
-		logging_->logWarning("Thread with id %" PRIu64 " is alredy created", id_);
+		LOGGING_WARNING(logging_, "Thread with id %" PRIu64 " is alredy created", id_);
 	}
 
 	stateMonitor_.unlock();
@@ -104,7 +137,87 @@ OSAL::Thread::State OSAL::Thread::getState() const
 }
 
 
+void OSAL::Thread::setAffinity(const int64_t cpu)
+{
+	stateMonitor_.lock();
+	affinity_ = cpu < 0 ? NO_AFFINITY : cpu;
+	stateMonitor_.unlock();
+}
+
+
+int64_t OSAL::Thread::getAffinity() const
+{
+	stateMonitor_.lock();
+	const int64_t affinity{ affinity_ };
+	stateMonitor_.unlock();
+
+	return affinity;
+}
+
+
+//! ATTENTION! This method is called with the stateMonitor_ locked
+Result OSAL::Thread::applyAffinity()
+{
+	if (NO_AFFINITY == affinity_)
+	{
+		return Result::OK;
+	}
+
+#if defined(__linux__)
+	if (affinity_ >= CPU_SETSIZE)
+	{
+		return Result::ERROR;
+	}
+
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(static_cast<int>(affinity_), &cpuSet);
+
+	return 0 == pthread_setaffinity_np(thread_.native_handle(), sizeof(cpu_set_t), &cpuSet) ? Result::OK : Result::ERROR;
+#elif defined(_WIN32)
+	if (affinity_ >= 64)
+	{
+		return Result::ERROR;
+	}
+
+	return 0u != SetThreadAffinityMask(thread_.native_handle(), DWORD_PTR{ 1u } << affinity_) ? Result::OK : Result::ERROR;
+#else
+	return Result::UNIMPLEMENTED;
+#endif
+}
+
+
 void OSAL::Thread::delay(const uint64_t timeout)
 {
 	std::this_thread::sleep_for(std::chrono::microseconds(timeout));
 }
+
+
+uint64_t OSAL::Thread::getCurrentThreadCpuTime()
+{
+#if defined(__linux__)
+	timespec cpuTime{};
+
+	if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime))
+	{
+		return 0u;
+	}
+
+	return static_cast<uint64_t>(cpuTime.tv_sec) * 1000000u + static_cast<uint64_t>(cpuTime.tv_nsec) / 1000u;
+#elif defined(_WIN32)
+	FILETIME creationTime, exitTime, kernelTime, userTime;
+
+	if (0 == GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+	{
+		return 0u;
+	}
+
+	// FILETIME is in 100 nanoseconds units
+	const uint64_t kernelCpuTime{ (static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32u) | kernelTime.dwLowDateTime };
+	const uint64_t userCpuTime{ (static_cast<uint64_t>(userTime.dwHighDateTime) << 32u) | userTime.dwLowDateTime };
+
+	return (kernelCpuTime + userCpuTime) / 10u;
+#else
+	return 0u;
+#endif
+}
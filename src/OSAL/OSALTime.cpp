@@ -16,10 +16,8 @@ uint64_t OSAL::Time::getElapsedTime()
 {
     const auto startTime = static_cast<uint64_t>(
         std::chrono::time_point_cast<std::chrono::microseconds>(startTime_).time_since_epoch().count());
-    const auto nowTime = static_cast<uint64_t>(
-        std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()).time_since_epoch().count());
 
-    return getElapsedTime(startTime, nowTime);
+    return getElapsedTime(startTime, getCurrentTime());
 }
 
 
@@ -41,3 +39,10 @@ uint64_t OSAL::Time::getElapsedTime(uint64_t startTime, uint64_t endTime)
 
     return 0;
 }
+
+
+uint64_t OSAL::Time::getCurrentTime()
+{
+    return static_cast<uint64_t>(
+        std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()).time_since_epoch().count());
+}
@@ -0,0 +1,439 @@
+#include <algorithm>
+
+#include "FairShareTaskScheduler.h"
+
+
+const uint32_t FairShareTaskScheduler::DEFAULT_WEIGHT;
+
+
+FairShareTaskScheduler::FairShareTaskScheduler(const std::map<std::string, uint32_t> & tenantWeights, Logging * logging)
+    : TaskSchedulerBase{ logging }
+    , tenantWeights_{ tenantWeights }
+    , size_{ 0u }
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Public ITaskScheduler methods
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t FairShareTaskScheduler::getSize() const
+{
+    tasksMonitor_.lock();
+    const size_t size{ excludeTombstones(size_) };
+    tasksMonitor_.unlock();
+
+    return size;
+}
+
+
+Result FairShareTaskScheduler::waitTaskForExecution(const int64_t timeout) const
+{
+    Result result{ Result::OK };
+
+    tasksMonitor_.lock();
+
+    if (0u == excludeTombstones(size_))
+    {
+        isNewTaskScheduled_ = false;
+        OSAL::Timeout waitTimeout{ timeout };
+
+        while (Result::OK == result && !isNewTaskScheduled_)
+        {
+            result = tasksMonitor_.wait(waitTimeout.getRemainingTime());
+        }
+    }
+
+    tasksMonitor_.unlock();
+
+    return result;
+}
+
+
+bool FairShareTaskScheduler::isScheduled(const uint64_t taskId) const
+{
+    bool isScheduled{ false };
+
+    tasksMonitor_.lock();
+
+    for (const auto tenantQueue : activeTenants_)
+    {
+        const auto foundTaskIt = TaskSchedulerBase::findTaskById(tenantQueue->tasks.cbegin(), tenantQueue->tasks.cend(), taskId);
+        if (foundTaskIt != tenantQueue->tasks.cend())
+        {
+            isScheduled = true;
+            break;
+        }
+    }
+
+    tasksMonitor_.unlock();
+
+    return isScheduled;
+}
+
+
+std::shared_ptr<IThreadPoolTask> FairShareTaskScheduler::getTaskForExecution()
+{
+    std::shared_ptr<IThreadPoolTask> taskForExecution{};
+
+    tasksMonitor_.lock();
+
+    reclaimTombstones();
+
+    if (!activeTenants_.empty())
+    {
+        TenantQueue * const tenantQueue{ activeTenants_.front() };
+
+        // Tenant starts its turn with the quantum of its weight, every task costs one
+        if (0u == tenantQueue->deficit)
+        {
+            tenantQueue->deficit = tenantQueue->weight;
+        }
+
+        taskForExecution = std::move(tenantQueue->tasks.front());
+        tenantQueue->tasks.pop_front();
+        detachTask(taskForExecution);
+        --tenantQueue->deficit;
+        --size_;
+
+        if (tenantQueue->tasks.empty())
+        {
+            deactivateIfEmpty(*tenantQueue);
+        }
+        else if (0u == tenantQueue->deficit)
+        {
+            activeTenants_.pop_front();
+            activeTenants_.push_back(tenantQueue);
+        }
+
+        ++statistic_.value.totalNumberOfGotForExecutionTasks;
+    }
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return taskForExecution;
+}
+
+
+std::shared_ptr<IThreadPoolTask> FairShareTaskScheduler::steal()
+{
+    std::shared_ptr<IThreadPoolTask> stolenTask{};
+
+    tasksMonitor_.lock();
+
+    reclaimTombstones();
+
+    while (!activeTenants_.empty())
+    {
+        // The newest task of the biggest tenant, so thief mostly takes load of the flooding tenant
+        TenantQueue * const tenantQueue{ *std::max_element(activeTenants_.cbegin(), activeTenants_.cend(),
+                                                           [](const TenantQueue * lhs, const TenantQueue * rhs)
+                                                           {
+                                                               return lhs->tasks.size() < rhs->tasks.size();
+                                                           }) };
+
+        size_ -= reclaimBackTombstones(tenantQueue->tasks);
+
+        // Cancel doesn't take the monitor, so front task could become tombstone after reclaimTombstones too
+        if (tenantQueue->tasks.empty())
+        {
+            deactivateIfEmpty(*tenantQueue);
+            continue;
+        }
+
+        stolenTask = std::move(tenantQueue->tasks.back());
+        tenantQueue->tasks.pop_back();
+        detachTask(stolenTask);
+        --size_;
+
+        deactivateIfEmpty(*tenantQueue);
+
+        ++statistic_.value.totalNumberOfStolenTasks;
+        break;
+    }
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return stolenTask;
+}
+
+
+Result FairShareTaskScheduler::schedule(const std::shared_ptr<IThreadPoolTask> task)
+{
+    Result result{ Result::ERROR };
+
+    if (task != nullptr)
+    {
+        tasksMonitor_.lock();
+
+        scheduleInternal(task);
+
+        ++statistic_.value.totalNumberOfScheduledTasks;
+        publishDepth();
+
+        isNewTaskScheduled_ = true;
+        tasksMonitor_.notify();
+        tasksMonitor_.unlock();
+
+        result = Result::OK;
+    }
+
+    return result;
+}
+
+
+Result FairShareTaskScheduler::schedule(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks)
+{
+    Result result{ Result::ERROR };
+
+    if (!tasks.empty())
+    {
+        tasksMonitor_.lock();
+
+        for (auto && taskIt : tasks)
+        {
+            if (taskIt != nullptr)
+            {
+                scheduleInternal(taskIt);
+
+                ++statistic_.value.totalNumberOfScheduledTasks;
+                isNewTaskScheduled_ = true;
+            }
+        }
+
+        if (isNewTaskScheduled_)
+        {
+            tasksMonitor_.notify();
+            result = Result::OK;
+        }
+
+        publishDepth();
+
+        tasksMonitor_.unlock();
+    }
+    else
+    {
+        LOGGING_WARNING(logging_, "Provided empty container with tasks for scheduler");
+    }
+
+    return result;
+}
+
+
+std::shared_ptr<IThreadPoolTask> FairShareTaskScheduler::unscheduleOne(const uint64_t taskId)
+{
+    std::shared_ptr<IThreadPoolTask> unscheduledTask{};
+
+    tasksMonitor_.lock();
+
+    for (const auto tenantQueue : activeTenants_)
+    {
+        const auto foundTaskIt = TaskSchedulerBase::findTaskById(tenantQueue->tasks.begin(), tenantQueue->tasks.end(), taskId);
+
+        if (foundTaskIt != tenantQueue->tasks.end())
+        {
+            unscheduledTask = std::move(*foundTaskIt);
+            tenantQueue->tasks.erase(foundTaskIt);
+            detachTask(unscheduledTask);
+            --size_;
+
+            // Invalidates iteration, but we are done anyway
+            deactivateIfEmpty(*tenantQueue);
+
+            ++statistic_.value.totalNumberOfUnscheduledTasks;
+            break;
+        }
+    }
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return unscheduledTask;
+}
+
+
+std::vector<std::shared_ptr<IThreadPoolTask>> FairShareTaskScheduler::unscheduleAll()
+{
+    std::vector<std::shared_ptr<IThreadPoolTask>> unscheduledTasks{};
+
+    tasksMonitor_.lock();
+
+    unscheduledTasks.reserve(size_);
+
+    for (const auto tenantQueue : activeTenants_)
+    {
+        unscheduleTasks(tenantQueue->tasks, &unscheduledTasks);
+        tenantQueue->deficit = 0u;
+    }
+
+    activeTenants_.clear();
+    size_ = 0u;
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return unscheduledTasks;
+}
+
+
+std::shared_ptr<IThreadPoolTask> FairShareTaskScheduler::unscheduleOldest()
+{
+    std::shared_ptr<IThreadPoolTask> unscheduledTask{};
+
+    tasksMonitor_.lock();
+
+    reclaimTombstones();
+
+    if (!activeTenants_.empty())
+    {
+        // Every tenant queue is FCFS, so only front tasks are compared
+        TenantQueue * const tenantQueue{ *std::min_element(activeTenants_.cbegin(), activeTenants_.cend(),
+                                                           [](const TenantQueue * lhs, const TenantQueue * rhs)
+                                                           {
+                                                               return lhs->tasks.front()->getAddedTime() < rhs->tasks.front()->getAddedTime();
+                                                           }) };
+
+        unscheduledTask = std::move(tenantQueue->tasks.front());
+        tenantQueue->tasks.pop_front();
+        detachTask(unscheduledTask);
+        --size_;
+
+        deactivateIfEmpty(*tenantQueue);
+
+        ++statistic_.value.totalNumberOfUnscheduledTasks;
+    }
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return unscheduledTask;
+}
+
+
+Result FairShareTaskScheduler::clearAll()
+{
+    Result result{ Result::ERROR };
+
+    tasksMonitor_.lock();
+
+    size_t numberOfUnscheduledTasks{ 0u };
+
+    for (const auto tenantQueue : activeTenants_)
+    {
+        numberOfUnscheduledTasks += unscheduleTasks(tenantQueue->tasks, nullptr);
+        tenantQueue->deficit = 0u;
+    }
+
+    activeTenants_.clear();
+    size_ = 0u;
+
+    if (numberOfUnscheduledTasks != 0u)
+    {
+        result = Result::OK;
+    }
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Private methods
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void FairShareTaskScheduler::scheduleInternal(const std::shared_ptr<IThreadPoolTask> & task)
+{
+    const std::shared_ptr<TenantTask> tenantTask{ std::dynamic_pointer_cast<TenantTask>(task) };
+    const std::string & tenant{ tenantTask != nullptr ? tenantTask->getTenant() : TenantTask::DEFAULT_TENANT };
+
+    auto tenantToTasksIt = tenantToTasksMap_.find(tenant);
+    if (tenantToTasksIt == tenantToTasksMap_.end())
+    {
+        const auto tenantWeightIt = tenantWeights_.find(tenant);
+
+        TenantQueue tenantQueue{};
+        tenantQueue.weight = (tenantWeightIt != tenantWeights_.end()) ? std::max(tenantWeightIt->second, 1u) : DEFAULT_WEIGHT;
+
+        tenantToTasksIt = tenantToTasksMap_.emplace(tenant, std::move(tenantQueue)).first;
+    }
+
+    TenantQueue & tenantQueue{ tenantToTasksIt->second };
+
+    // Idle tenant joins the end of the round with a fresh quantum
+    if (tenantQueue.tasks.empty())
+    {
+        activeTenants_.push_back(&tenantQueue);
+    }
+
+    tenantQueue.tasks.emplace_back(task);
+    attachTask(task);
+    ++size_;
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void FairShareTaskScheduler::deactivateIfEmpty(TenantQueue & tenantQueue)
+{
+    if (tenantQueue.tasks.empty())
+    {
+        // Unused quantum isn't saved, otherwise idle tenant would get a burst later
+        tenantQueue.deficit = 0u;
+        activeTenants_.erase(std::find(activeTenants_.begin(), activeTenants_.end(), &tenantQueue));
+    }
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void FairShareTaskScheduler::reclaimTombstones()
+{
+    auto tenantQueueIt = activeTenants_.begin();
+
+    while (tenantQueueIt != activeTenants_.end())
+    {
+        size_ -= reclaimFrontTombstones((*tenantQueueIt)->tasks);
+
+        // Tenant with tombstones only leaves the round the same way as drained one
+        if ((*tenantQueueIt)->tasks.empty())
+        {
+            (*tenantQueueIt)->deficit = 0u;
+            tenantQueueIt = activeTenants_.erase(tenantQueueIt);
+        }
+        else
+        {
+            ++tenantQueueIt;
+        }
+    }
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void FairShareTaskScheduler::publishDepth()
+{
+    uint64_t oldestTaskAddedTime{ 0u };
+
+    for (const auto tenantQueue : activeTenants_)
+    {
+        const uint64_t addedTime{ tenantQueue->tasks.front()->getAddedTime() };
+
+        if (0u == oldestTaskAddedTime || (addedTime != 0u && addedTime < oldestTaskAddedTime))
+        {
+            oldestTaskAddedTime = addedTime;
+        }
+    }
+
+    TaskSchedulerBase::publishDepth(size_, size_, oldestTaskAddedTime);
+}
@@ -15,7 +15,7 @@ FirstComeFirstServedTaskScheduler::FirstComeFirstServedTaskScheduler(Logging * l
 size_t FirstComeFirstServedTaskScheduler::getSize() const
 {
     tasksMonitor_.lock();
-    const size_t size{ tasks_.size() };
+    const size_t size{ excludeTombstones(tasks_.size()) };
     tasksMonitor_.unlock();
 
     return size;
@@ -28,7 +28,7 @@ Result FirstComeFirstServedTaskScheduler::waitTaskForExecution(const int64_t tim
 
     tasksMonitor_.lock();
 
-    if (tasks_.empty())
+    if (0u == excludeTombstones(tasks_.size()))
     {
         isNewTaskScheduled_ = false;
         OSAL::Timeout waitTimeout{ timeout };
@@ -69,14 +69,19 @@ std::shared_ptr<IThreadPoolTask> FirstComeFirstServedTaskScheduler::getTaskForEx
 
     tasksMonitor_.lock();
 
+    reclaimFrontTombstones(tasks_);
+
     if (!tasks_.empty())
     {
         taskForExecution = std::move(tasks_.front());
         tasks_.pop_front();
+        detachTask(taskForExecution);
 
-        ++statistic_.totalNumberOfGotForExecutionTasks;
+        ++statistic_.value.totalNumberOfGotForExecutionTasks;
     }
 
+    publishDepth();
+
     tasksMonitor_.unlock();
 
     return taskForExecution;
@@ -89,14 +94,19 @@ std::shared_ptr<IThreadPoolTask> FirstComeFirstServedTaskScheduler::steal()
 
     tasksMonitor_.lock();
 
+    reclaimBackTombstones(tasks_);
+
     if (!tasks_.empty())
     {
         stolenTask = std::move(tasks_.back());
         tasks_.pop_back();
+        detachTask(stolenTask);
 
-        ++statistic_.totalNumberOfStolenTasks;
+        ++statistic_.value.totalNumberOfStolenTasks;
     }
 
+    publishDepth();
+
     tasksMonitor_.unlock();
 
     return stolenTask;
@@ -112,8 +122,10 @@ Result FirstComeFirstServedTaskScheduler::schedule(const std::shared_ptr<IThread
         tasksMonitor_.lock();
 
         tasks_.emplace_back(task);
+        attachTask(task);
 
-        ++statistic_.totalNumberOfScheduledTasks;
+        ++statistic_.value.totalNumberOfScheduledTasks;
+        publishDepth();
 
         isNewTaskScheduled_ = true;
         tasksMonitor_.notify();
@@ -139,8 +151,9 @@ Result FirstComeFirstServedTaskScheduler::schedule(const std::vector<std::shared
             if (taskIt != nullptr)
             {
                 tasks_.emplace_back(taskIt);
+                attachTask(taskIt);
 
-                ++statistic_.totalNumberOfScheduledTasks;
+                ++statistic_.value.totalNumberOfScheduledTasks;
                 isNewTaskScheduled_ = true;
             }
         }
@@ -151,11 +164,13 @@ Result FirstComeFirstServedTaskScheduler::schedule(const std::vector<std::shared
             result = Result::OK;
         }
 
+        publishDepth();
+
         tasksMonitor_.unlock();
     }
     else
     {
-        logging_->logWarning("Provided empty container with tasks for scheduler");
+        LOGGING_WARNING(logging_, "Provided empty container with tasks for scheduler");
     }
 
     return result;
@@ -176,11 +191,14 @@ std::shared_ptr<IThreadPoolTask> FirstComeFirstServedTaskScheduler::unscheduleOn
        {
            unscheduledTask = std::move(*foundTaskIt);
            tasks_.erase(foundTaskIt);
+           detachTask(unscheduledTask);
 
-           ++statistic_.totalNumberOfUnscheduledTasks;
+           ++statistic_.value.totalNumberOfUnscheduledTasks;
        }
     }
 
+    publishDepth();
+
     tasksMonitor_.unlock();
 
     return unscheduledTask;
@@ -193,20 +211,39 @@ std::vector<std::shared_ptr<IThreadPoolTask>> FirstComeFirstServedTaskScheduler:
 
     tasksMonitor_.lock();
 
+    unscheduledTasks.reserve(tasks_.size());
+    unscheduleTasks(tasks_, &unscheduledTasks);
+
+    publishDepth();
+
+    tasksMonitor_.unlock();
+
+    return unscheduledTasks;
+}
+
+
+std::shared_ptr<IThreadPoolTask> FirstComeFirstServedTaskScheduler::unscheduleOldest()
+{
+    std::shared_ptr<IThreadPoolTask> unscheduledTask{};
+
+    tasksMonitor_.lock();
+
+    reclaimFrontTombstones(tasks_);
+
     if (!tasks_.empty())
     {
-        unscheduledTasks.insert(unscheduledTasks.end(),
-            std::make_move_iterator(tasks_.begin()),
-            std::make_move_iterator(tasks_.end()));
-
-        statistic_.totalNumberOfUnscheduledTasks += static_cast<uint32_t>(tasks_.size());
+        unscheduledTask = std::move(tasks_.front());
+        tasks_.pop_front();
+        detachTask(unscheduledTask);
 
-        tasks_.clear();
+        ++statistic_.value.totalNumberOfUnscheduledTasks;
     }
 
+    publishDepth();
+
     tasksMonitor_.unlock();
 
-    return unscheduledTasks;
+    return unscheduledTask;
 }
 
 
@@ -216,15 +253,21 @@ Result FirstComeFirstServedTaskScheduler::clearAll()
 
     tasksMonitor_.lock();
 
-    if (!tasks_.empty())
+    if (unscheduleTasks(tasks_, nullptr) != 0u)
     {
-        statistic_.totalNumberOfUnscheduledTasks += static_cast<uint32_t>(tasks_.size());
-        tasks_.clear();
-
         result = Result::OK;
     }
 
+    publishDepth();
+
     tasksMonitor_.unlock();
 
     return result;
-}
\ No newline at end of file
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void FirstComeFirstServedTaskScheduler::publishDepth()
+{
+    TaskSchedulerBase::publishDepth(tasks_.size(), tasks_.size(), tasks_.empty() ? 0u : tasks_.front()->getAddedTime());
+}
@@ -48,17 +48,22 @@ std::shared_ptr<IThreadPoolTask> PriorityTaskScheduler::getTaskForExecution()
     {
         std::deque<std::shared_ptr<IThreadPoolTask>> &tasks = priorityToTasksMap_[priority];
 
+        reclaimFrontTombstones(tasks);
+
         if (!tasks.empty())
         {
             taskForExecution = std::move(tasks.front());
             tasks.pop_front();
+            detachTask(taskForExecution);
 
-            ++statistic_.totalNumberOfGotForExecutionTasks;
+            ++statistic_.value.totalNumberOfGotForExecutionTasks;
 
             break;
         }
     }
 
+    PriorityOrientedTaskSchedulerBase::publishDepth(priorityToTasksMap_);
+
     tasksMonitor_.unlock();
 
     return taskForExecution;
@@ -77,17 +82,22 @@ std::shared_ptr<IThreadPoolTask> PriorityTaskScheduler::steal()
     {
         std::deque<std::shared_ptr<IThreadPoolTask>> &tasks = priorityToTasksMap_[priority];
 
+        reclaimBackTombstones(tasks);
+
         if (!tasks.empty())
         {
             stolenTask = std::move(tasks.back());
             tasks.pop_back();
+            detachTask(stolenTask);
 
-            ++statistic_.totalNumberOfStolenTasks;
+            ++statistic_.value.totalNumberOfStolenTasks;
 
             break;
         }
     }
 
+    PriorityOrientedTaskSchedulerBase::publishDepth(priorityToTasksMap_);
+
     tasksMonitor_.unlock();
 
     return stolenTask;
@@ -104,8 +114,10 @@ Result PriorityTaskScheduler::schedule(const std::shared_ptr<IThreadPoolTask> ta
         tasksMonitor_.lock();
 
         priorityToTasksMap_[priorityTask->getPriority()].emplace_back(task);
+        attachTask(task);
 
-        ++statistic_.totalNumberOfScheduledTasks;
+        ++statistic_.value.totalNumberOfScheduledTasks;
+        PriorityOrientedTaskSchedulerBase::publishDepth(priorityToTasksMap_);
 
         isNewTaskScheduled_ = true;
         tasksMonitor_.notify();
@@ -115,7 +127,7 @@ Result PriorityTaskScheduler::schedule(const std::shared_ptr<IThreadPoolTask> ta
     }
     else
     {
-        logging_->logWarning("Provided task is not Priority Task!");
+        LOGGING_WARNING(logging_, "Provided task is not Priority Task!");
     }
 
     return result;
@@ -138,13 +150,14 @@ Result PriorityTaskScheduler::schedule(const std::vector<std::shared_ptr<IThread
             if (priorityTask != nullptr)
             {
                 priorityToTasksMap_[priorityTask->getPriority()].emplace_back(taskIt);
+                attachTask(taskIt);
 
-                ++statistic_.totalNumberOfScheduledTasks;
+                ++statistic_.value.totalNumberOfScheduledTasks;
                 isNewTaskScheduled_ = true;
             }
             else
             {
-                logging_->logWarning("Provided task is not Priority Task!");
+                LOGGING_WARNING(logging_, "Provided task is not Priority Task!");
             }
         }
 
@@ -154,11 +167,13 @@ Result PriorityTaskScheduler::schedule(const std::vector<std::shared_ptr<IThread
             result = Result::OK;
         }
 
+        PriorityOrientedTaskSchedulerBase::publishDepth(priorityToTasksMap_);
+
         tasksMonitor_.unlock();
     }
     else
     {
-        logging_->logWarning("Provided empty container with tasks for scheduler");
+        LOGGING_WARNING(logging_, "Provided empty container with tasks for scheduler");
     }
 
     return result;
@@ -177,6 +192,12 @@ std::vector<std::shared_ptr<IThreadPoolTask>> PriorityTaskScheduler::unscheduleA
 }
 
 
+std::shared_ptr<IThreadPoolTask> PriorityTaskScheduler::unscheduleOldest()
+{
+    return PriorityOrientedTaskSchedulerBase::unscheduleOldest(priorityToTasksMap_);
+}
+
+
 Result PriorityTaskScheduler::clearAll()
 {
    return PriorityOrientedTaskSchedulerBase::clearAll(priorityToTasksMap_);
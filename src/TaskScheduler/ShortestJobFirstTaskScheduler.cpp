@@ -48,17 +48,22 @@ std::shared_ptr<IThreadPoolTask> ShortestJobFirstTaskScheduler::getTaskForExecut
     {
         std::deque<std::shared_ptr<IThreadPoolTask>> &tasks = burstTimeToTasksMap_[burstTime];
 
+        reclaimFrontTombstones(tasks);
+
         if (!tasks.empty())
         {
             taskForExecution = std::move(tasks.front());
             tasks.pop_front();
+            detachTask(taskForExecution);
 
-            ++statistic_.totalNumberOfGotForExecutionTasks;
+            ++statistic_.value.totalNumberOfGotForExecutionTasks;
 
             break;
         }
     }
 
+    PriorityOrientedTaskSchedulerBase::publishDepth(burstTimeToTasksMap_);
+
     tasksMonitor_.unlock();
 
     return taskForExecution;
@@ -77,17 +82,22 @@ std::shared_ptr<IThreadPoolTask> ShortestJobFirstTaskScheduler::steal()
     {
         std::deque<std::shared_ptr<IThreadPoolTask>> &tasks = burstTimeToTasksMap_[burstTime];
 
+        reclaimBackTombstones(tasks);
+
         if (!tasks.empty())
         {
             stolenTask = std::move(tasks.back());
             tasks.pop_back();
+            detachTask(stolenTask);
 
-            ++statistic_.totalNumberOfStolenTasks;
+            ++statistic_.value.totalNumberOfStolenTasks;
 
             break;
         }
     }
 
+    PriorityOrientedTaskSchedulerBase::publishDepth(burstTimeToTasksMap_);
+
     tasksMonitor_.unlock();
 
     return stolenTask;
@@ -105,8 +115,10 @@ Result ShortestJobFirstTaskScheduler::schedule(const std::shared_ptr<IThreadPool
 
         const BurstTime burstTime{ calculateBurstTime(burstTimeTask->getBurstTime()) };
         burstTimeToTasksMap_[burstTime].emplace_back(task);
+        attachTask(task);
 
-        ++statistic_.totalNumberOfScheduledTasks;
+        ++statistic_.value.totalNumberOfScheduledTasks;
+        PriorityOrientedTaskSchedulerBase::publishDepth(burstTimeToTasksMap_);
 
         isNewTaskScheduled_ = true;
         tasksMonitor_.notify();
@@ -116,7 +128,7 @@ Result ShortestJobFirstTaskScheduler::schedule(const std::shared_ptr<IThreadPool
     }
     else
     {
-        logging_->logWarning("Provided task is not Burst Time Task!");
+        LOGGING_WARNING(logging_, "Provided task is not Burst Time Task!");
     }
 
     return result;
@@ -140,13 +152,14 @@ Result ShortestJobFirstTaskScheduler::schedule(const std::vector<std::shared_ptr
             {
                 const BurstTime burstTime{ calculateBurstTime(burstTimeTask->getBurstTime()) };
                 burstTimeToTasksMap_[burstTime].emplace_back(taskIt);
+                attachTask(taskIt);
 
-                ++statistic_.totalNumberOfScheduledTasks;
+                ++statistic_.value.totalNumberOfScheduledTasks;
                 isNewTaskScheduled_ = true;
             }
             else
             {
-                logging_->logWarning("Provided task is not Burst Time Task!");
+                LOGGING_WARNING(logging_, "Provided task is not Burst Time Task!");
             }
         }
 
@@ -156,11 +169,13 @@ Result ShortestJobFirstTaskScheduler::schedule(const std::vector<std::shared_ptr
             result = Result::OK;
         }
 
+        PriorityOrientedTaskSchedulerBase::publishDepth(burstTimeToTasksMap_);
+
         tasksMonitor_.unlock();
     }
     else
     {
-        logging_->logWarning("Provided empty container with tasks for scheduler");
+        LOGGING_WARNING(logging_, "Provided empty container with tasks for scheduler");
     }
 
     return result;
@@ -179,6 +194,12 @@ std::vector<std::shared_ptr<IThreadPoolTask>> ShortestJobFirstTaskScheduler::uns
 }
 
 
+std::shared_ptr<IThreadPoolTask> ShortestJobFirstTaskScheduler::unscheduleOldest()
+{
+    return PriorityOrientedTaskSchedulerBase::unscheduleOldest(burstTimeToTasksMap_);
+}
+
+
 Result ShortestJobFirstTaskScheduler::clearAll()
 {
     return PriorityOrientedTaskSchedulerBase::clearAll(burstTimeToTasksMap_);
@@ -193,4 +214,17 @@ BurstTime ShortestJobFirstTaskScheduler::calculateBurstTime(BurstTime burstTime)
     }
 
     return burstTime;
-}
\ No newline at end of file
+}
+
+
+uint64_t ShortestJobFirstTaskScheduler::getTaskWork(const uint8_t burstTime) const
+{
+    // Relative costs of burst times, each next burst time is considered twice as long as previous
+    switch (static_cast<BurstTime>(burstTime))
+    {
+        case BurstTime::SHORT:      return 1u;
+        case BurstTime::MEDIUM:     return 2u;
+        case BurstTime::LONG:       return 4u;
+        default:                    return 4u;
+    }
+}
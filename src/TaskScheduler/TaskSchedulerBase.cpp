@@ -4,12 +4,18 @@
 
 
 TaskSchedulerBase::TaskSchedulerBase(Logging * logging)
-    : isNewTaskScheduled_{ false }
-    , logging_{ logging == nullptr ? new Logging{ "TaskScheduler" } : logging }
+    : tasksMonitor_{ (logging == nullptr ? Logging::getInstance("TaskScheduler") : logging)->getSubInstance("TasksMonitor") }
+    , isNewTaskScheduled_{ false }
+    , logging_{ logging == nullptr ? Logging::getInstance("TaskScheduler") : logging }
+    , tombstonesCounter_{ std::make_shared<IThreadPoolTask::TombstonesCounter>(0u) }
 {
     static std::atomic<uint64_t> id{ 1u };
     id_ = id.load();
     id.fetch_add(1u);
+
+    depth_.value.size.store(0u, std::memory_order_relaxed);
+    depth_.value.work.store(0u, std::memory_order_relaxed);
+    depth_.value.oldestTaskAddedTime.store(0u, std::memory_order_relaxed);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +38,34 @@ uint64_t TaskSchedulerBase::getId() const
 
 ITaskScheduler::Statistic TaskSchedulerBase::getStatistic() const
 {
-    return statistic_;
+    ITaskScheduler::Statistic statistic{};
+
+    statistic.totalNumberOfScheduledTasks           = statistic_.value.totalNumberOfScheduledTasks.load();
+    statistic.totalNumberOfUnscheduledTasks         = statistic_.value.totalNumberOfUnscheduledTasks.load();
+    statistic.totalNumberOfStolenTasks              = statistic_.value.totalNumberOfStolenTasks.load();
+    statistic.totalNumberOfGotForExecutionTasks     = statistic_.value.totalNumberOfGotForExecutionTasks.load();
+    statistic.totalNumberOfReclaimedTasks           = statistic_.value.totalNumberOfReclaimedTasks.load();
+
+    return statistic;
+}
+
+
+//! Tasks canceled after the last publishing are excluded too
+size_t TaskSchedulerBase::getApproximateSize() const
+{
+    return excludeTombstones(depth_.value.size.load(std::memory_order_relaxed));
+}
+
+
+uint64_t TaskSchedulerBase::getApproximateWork() const
+{
+    return depth_.value.work.load(std::memory_order_relaxed);
+}
+
+
+uint64_t TaskSchedulerBase::getApproximateOldestTaskAddedTime() const
+{
+    return depth_.value.oldestTaskAddedTime.load(std::memory_order_relaxed);
 }
 
 
@@ -42,4 +75,35 @@ void TaskSchedulerBase::notifyTaskForExecution() const
     isNewTaskScheduled_ = true;
     tasksMonitor_.notifyAll();
     tasksMonitor_.unlock();
-}
\ No newline at end of file
+}
+
+
+void TaskSchedulerBase::publishDepth(const size_t size, const uint64_t work, const uint64_t oldestTaskAddedTime)
+{
+    depth_.value.size.store(size, std::memory_order_relaxed);
+    depth_.value.work.store(work, std::memory_order_relaxed);
+    depth_.value.oldestTaskAddedTime.store(oldestTaskAddedTime, std::memory_order_relaxed);
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void TaskSchedulerBase::attachTask(const std::shared_ptr<IThreadPoolTask> & task)
+{
+    task->attachTombstonesCounter(tombstonesCounter_);
+}
+
+
+//! ATTENTION! This method is called with the tasksMonitor_ locked
+void TaskSchedulerBase::detachTask(const std::shared_ptr<IThreadPoolTask> & task)
+{
+    task->detachTombstonesCounter(tombstonesCounter_);
+}
+
+
+size_t TaskSchedulerBase::excludeTombstones(const size_t size) const
+{
+    const size_t numberOfTombstones{ tombstonesCounter_->load(std::memory_order_relaxed) };
+
+    // Lock-free readers may see the counter and the size from different moments
+    return size > numberOfTombstones ? size - numberOfTombstones : 0u;
+}
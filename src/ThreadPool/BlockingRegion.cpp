@@ -0,0 +1,26 @@
+#include "BlockingRegion.h"
+
+
+BlockingRegion::BlockingRegion()
+    : worker_{ ThreadPoolWorker::getCurrentWorker() }
+{
+    if (worker_ != nullptr && !worker_->enterBlockingRegion())
+    {
+        worker_ = nullptr;
+    }
+}
+
+
+BlockingRegion::~BlockingRegion()
+{
+    if (worker_ != nullptr)
+    {
+        worker_->leaveBlockingRegion();
+    }
+}
+
+
+bool BlockingRegion::isCompensated() const
+{
+    return worker_ != nullptr;
+}
@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <set>
+
+#include "FlightRecorder.h"
+#include "OSALTime.h"
+
+
+const uint32_t FlightRecorder::MAX_CAPACITY_PER_TRACK;
+
+
+std::string FlightRecorder::eventTypeToString(const EventType type)
+{
+    switch (type)
+    {
+        case EventType::SUBMIT:
+            return "SUBMIT";
+        case EventType::DISPATCH:
+            return "DISPATCH";
+        case EventType::STEAL:
+            return "STEAL";
+        case EventType::START:
+            return "START";
+        case EventType::END:
+            return "END";
+        case EventType::PARK:
+            return "PARK";
+        case EventType::UNPARK:
+            return "UNPARK";
+        case EventType::UNDEFINED:
+        default:
+            return "UNDEFINED";
+    }
+}
+
+
+FlightRecorder::FlightRecorder(const uint32_t numberOfWorkerTracks, const uint32_t capacityPerTrack)
+    : numberOfTracks_{ numberOfWorkerTracks + 2u }
+    , capacityPerTrack_{ roundUpToPowerOfTwo(std::min(capacityPerTrack, MAX_CAPACITY_PER_TRACK)) }
+    , heads_{ new CacheLinePadded<std::atomic<uint64_t>>[numberOfWorkerTracks + 2u]() }
+    , entries_{ new Entry[static_cast<size_t>(numberOfWorkerTracks + 2u) * capacityPerTrack_]() }
+{
+}
+
+
+uint32_t FlightRecorder::getNumberOfTracks() const
+{
+    return numberOfTracks_;
+}
+
+
+uint32_t FlightRecorder::getCapacityPerTrack() const
+{
+    return capacityPerTrack_;
+}
+
+
+uint32_t FlightRecorder::getManagerTrack() const
+{
+    return numberOfTracks_ - 2u;
+}
+
+
+uint32_t FlightRecorder::getProducersTrack() const
+{
+    return numberOfTracks_ - 1u;
+}
+
+
+void FlightRecorder::record(const uint32_t track, const EventType type, const uint64_t taskId, const uint32_t argument)
+{
+    if (capacityPerTrack_ != 0u)
+    {
+        record(track, type, taskId, argument, OSAL::Time::getCurrentTime());
+    }
+}
+
+
+void FlightRecorder::record(const uint32_t track, const EventType type, const uint64_t taskId, const uint32_t argument, const uint64_t time)
+{
+    if (0u == capacityPerTrack_ || track >= numberOfTracks_)
+    {
+        return;
+    }
+
+    const uint64_t index{ heads_[track].value.fetch_add(1u, std::memory_order_relaxed) };
+    Entry & entry = entries_[static_cast<size_t>(track) * capacityPerTrack_ + (index & (capacityPerTrack_ - 1u))];
+
+    // Sequence lock: readers drop entry, which is changed while they copy it
+    entry.sequence.store(0u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    entry.time.store(time, std::memory_order_relaxed);
+    entry.taskId.store(taskId, std::memory_order_relaxed);
+    entry.info.store(static_cast<uint64_t>(type) | (static_cast<uint64_t>(argument) << 32u), std::memory_order_relaxed);
+
+    entry.sequence.store(index + 1u, std::memory_order_release);
+}
+
+
+std::vector<FlightRecorder::Event> FlightRecorder::getEvents() const
+{
+    std::vector<Event> events;
+
+    if (0u == capacityPerTrack_)
+    {
+        return events;
+    }
+
+    for (uint32_t track = 0u; track < numberOfTracks_; ++track)
+    {
+        const uint64_t head{ heads_[track].value.load(std::memory_order_acquire) };
+        const uint64_t first{ head > capacityPerTrack_ ? head - capacityPerTrack_ : 0u };
+
+        for (uint64_t index = first; index < head; ++index)
+        {
+            const Entry & entry = entries_[static_cast<size_t>(track) * capacityPerTrack_ + (index & (capacityPerTrack_ - 1u))];
+
+            const uint64_t sequence{ entry.sequence.load(std::memory_order_acquire) };
+            if (sequence != index + 1u)
+            {
+                continue;
+            }
+
+            Event event{};
+            event.time = entry.time.load(std::memory_order_relaxed);
+            event.taskId = entry.taskId.load(std::memory_order_relaxed);
+
+            const uint64_t info{ entry.info.load(std::memory_order_relaxed) };
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.sequence.load(std::memory_order_relaxed) != sequence)
+            {
+                continue;
+            }
+
+            event.track = track;
+            event.argument = static_cast<uint32_t>(info >> 32u);
+            event.type = static_cast<uint8_t>(info) < static_cast<uint8_t>(EventType::UNDEFINED) ? static_cast<EventType>(info & 0xFFu)
+                                                                                                    : EventType::UNDEFINED;
+
+            events.push_back(event);
+        }
+    }
+
+    return events;
+}
+
+
+void FlightRecorder::writeChromeTrace(std::ostream & stream, const uint64_t processId, const std::vector<std::string> & trackNames) const
+{
+    const std::vector<Event> events{ getEvents() };
+
+    const std::string pid{ std::to_string(processId) };
+    bool isFirstEvent{ true };
+
+    auto writeEvent = [&](const std::string & event)
+    {
+        stream << (isFirstEvent ? "\n" : ",\n") << "{" << event << "}";
+        isFirstEvent = false;
+    };
+
+    auto getTrackName = [&](const uint32_t track)
+    {
+        std::string name;
+
+        if (track < trackNames.size() && !trackNames[track].empty())
+        {
+            // Names are provided by the owner, only characters breaking JSON string are escaped
+            for (auto && character : trackNames[track])
+            {
+                if ('"' == character || '\\' == character)
+                {
+                    name += '\\';
+                }
+                name += character;
+            }
+        }
+        else if (track == getManagerTrack())
+        {
+            name = "Manager";
+        }
+        else if (track == getProducersTrack())
+        {
+            name = "Producers";
+        }
+        else
+        {
+            name = "Worker slot " + std::to_string(track);
+        }
+
+        return name;
+    };
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    writeEvent("\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"args\":{\"name\":\"ThreadPool " + pid + "\"}");
+
+    // Tracks without events aren't named, so unused slots don't clutter the timeline
+    std::set<uint32_t> usedTracks;
+    for (auto && event : events)
+    {
+        usedTracks.insert(event.track);
+    }
+
+    for (auto && usedTrack : usedTracks)
+    {
+        const std::string tid{ std::to_string(usedTrack) };
+
+        writeEvent("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":\"" + getTrackName(usedTrack) + "\"}");
+        writeEvent("\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"sort_index\":" + tid + "}");
+    }
+
+    // Events of one track are in recording order, so slice is closed by the next END or UNPARK of the same track
+    const Event * startEvent{ nullptr };
+    const Event * parkEvent{ nullptr };
+
+    for (size_t i = 0u; i < events.size(); ++i)
+    {
+        const Event & event = events[i];
+        const std::string common{ "\"pid\":" + pid + ",\"tid\":" + std::to_string(event.track) + ",\"ts\":" + std::to_string(event.time) };
+        const std::string taskId{ std::to_string(event.taskId) };
+
+        if (i > 0u && events[i - 1u].track != event.track)
+        {
+            startEvent = nullptr;
+            parkEvent = nullptr;
+        }
+
+        switch (event.type)
+        {
+            case EventType::SUBMIT:
+                writeEvent("\"name\":\"submit\",\"cat\":\"task\",\"ph\":\"i\",\"s\":\"t\"," + common + ",\"args\":{\"task\":" + taskId + "}");
+                writeEvent("\"name\":\"task\",\"cat\":\"task\",\"ph\":\"s\",\"id\":" + taskId + "," + common);
+                break;
+
+            case EventType::DISPATCH:
+            case EventType::STEAL:
+                writeEvent("\"name\":\"" + std::string{ EventType::DISPATCH == event.type ? "dispatch" : "steal" }
+                           + "\",\"cat\":\"task\",\"ph\":\"i\",\"s\":\"t\"," + common
+                           + ",\"args\":{\"task\":" + taskId + ",\"worker slot\":" + std::to_string(event.argument) + "}");
+                break;
+
+            case EventType::START:
+                startEvent = &event;
+                writeEvent("\"name\":\"task\",\"cat\":\"task\",\"ph\":\"f\",\"bp\":\"e\",\"id\":" + taskId + "," + common);
+                break;
+
+            case EventType::END:
+                // Start of the first task could be already overwritten
+                if (startEvent != nullptr && startEvent->taskId == event.taskId)
+                {
+                    writeEvent("\"name\":\"task " + taskId + "\",\"cat\":\"task\",\"ph\":\"X\",\"pid\":" + pid
+                               + ",\"tid\":" + std::to_string(event.track) + ",\"ts\":" + std::to_string(startEvent->time)
+                               + ",\"dur\":" + std::to_string(event.time - startEvent->time) + ",\"args\":{\"task\":" + taskId + "}");
+                }
+                startEvent = nullptr;
+                break;
+
+            case EventType::PARK:
+                parkEvent = &event;
+                break;
+
+            case EventType::UNPARK:
+                if (parkEvent != nullptr)
+                {
+                    writeEvent("\"name\":\"idle\",\"cat\":\"park\",\"ph\":\"X\",\"pid\":" + pid
+                               + ",\"tid\":" + std::to_string(event.track) + ",\"ts\":" + std::to_string(parkEvent->time)
+                               + ",\"dur\":" + std::to_string(event.time - parkEvent->time));
+                }
+                parkEvent = nullptr;
+                break;
+
+            case EventType::UNDEFINED:
+            default:
+                break;
+        }
+
+        const bool isLastEventOfTrack{ i + 1u == events.size() || events[i + 1u].track != event.track };
+
+        // Task, which is still executed, and current waiting are shown till the end of the trace
+        if (isLastEventOfTrack && startEvent != nullptr)
+        {
+            writeEvent("\"name\":\"task " + std::to_string(startEvent->taskId) + "\",\"cat\":\"task\",\"ph\":\"B\",\"pid\":" + pid
+                       + ",\"tid\":" + std::to_string(startEvent->track) + ",\"ts\":" + std::to_string(startEvent->time)
+                       + ",\"args\":{\"task\":" + std::to_string(startEvent->taskId) + "}");
+        }
+
+        if (isLastEventOfTrack && parkEvent != nullptr)
+        {
+            writeEvent("\"name\":\"idle\",\"cat\":\"park\",\"ph\":\"B\",\"pid\":" + pid
+                       + ",\"tid\":" + std::to_string(parkEvent->track) + ",\"ts\":" + std::to_string(parkEvent->time));
+        }
+    }
+
+    stream << "\n]}\n";
+}
+
+
+uint32_t FlightRecorder::roundUpToPowerOfTwo(const uint32_t value)
+{
+    uint32_t powerOfTwo{ value == 0u ? 0u : 1u };
+
+    while (powerOfTwo != 0u && powerOfTwo < value)
+    {
+        powerOfTwo <<= 1u;
+    }
+
+    return powerOfTwo;
+}
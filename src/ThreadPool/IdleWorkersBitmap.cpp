@@ -0,0 +1,154 @@
+#include "IdleWorkersBitmap.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+const int64_t IdleWorkersBitmap::INVALID_SLOT;
+const uint32_t IdleWorkersBitmap::BITS_PER_WORD;
+
+
+IdleWorkersBitmap::IdleWorkersBitmap(const uint32_t capacity)
+    : capacity_{ capacity }
+    , wordsSize_{ (capacity + BITS_PER_WORD - 1u) / BITS_PER_WORD }
+    , words_{ new std::atomic<uint64_t>[(capacity + BITS_PER_WORD - 1u) / BITS_PER_WORD] }
+{
+    resetAll();
+}
+
+
+uint32_t IdleWorkersBitmap::getCapacity() const
+{
+    return capacity_;
+}
+
+
+bool IdleWorkersBitmap::isSet(const uint32_t slot) const
+{
+    if (slot >= capacity_)
+    {
+        return false;
+    }
+
+    const uint64_t mask{ 1ull << (slot % BITS_PER_WORD) };
+
+    return (words_[slot / BITS_PER_WORD].load(std::memory_order_acquire) & mask) != 0u;
+}
+
+
+uint32_t IdleWorkersBitmap::count() const
+{
+    uint32_t count{ 0u };
+
+    for (uint32_t i = 0u; i < wordsSize_; ++i)
+    {
+        uint64_t word{ words_[i].load(std::memory_order_relaxed) };
+
+        while (word != 0u)
+        {
+            word &= word - 1u;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+
+void IdleWorkersBitmap::set(const uint32_t slot)
+{
+    if (slot < capacity_)
+    {
+        words_[slot / BITS_PER_WORD].fetch_or(1ull << (slot % BITS_PER_WORD), std::memory_order_release);
+    }
+}
+
+
+void IdleWorkersBitmap::reset(const uint32_t slot)
+{
+    if (slot < capacity_)
+    {
+        words_[slot / BITS_PER_WORD].fetch_and(~(1ull << (slot % BITS_PER_WORD)), std::memory_order_release);
+    }
+}
+
+
+void IdleWorkersBitmap::resetAll()
+{
+    for (uint32_t i = 0u; i < wordsSize_; ++i)
+    {
+        words_[i].store(0u, std::memory_order_release);
+    }
+}
+
+
+int64_t IdleWorkersBitmap::acquireFirst()
+{
+    for (uint32_t i = 0u; i < wordsSize_; ++i)
+    {
+        uint64_t word{ words_[i].load(std::memory_order_acquire) };
+
+        // Retry on the same word while somebody else changes it, other words are checked afterwards
+        while (word != 0u)
+        {
+            const uint32_t bit{ findFirstSet(word) };
+            const uint64_t mask{ 1ull << bit };
+
+            if (words_[i].compare_exchange_weak(word, word & ~mask, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return static_cast<int64_t>(i * BITS_PER_WORD + bit);
+            }
+        }
+    }
+
+    return INVALID_SLOT;
+}
+
+
+int64_t IdleWorkersBitmap::acquireFirstExcept(const IdleWorkersBitmap & excludedSlots)
+{
+    for (uint32_t i = 0u; i < wordsSize_; ++i)
+    {
+        const uint64_t excludedWord{ i < excludedSlots.wordsSize_ ? excludedSlots.words_[i].load(std::memory_order_acquire) : 0u };
+        uint64_t word{ words_[i].load(std::memory_order_acquire) };
+
+        while ((word & ~excludedWord) != 0u)
+        {
+            const uint32_t bit{ findFirstSet(word & ~excludedWord) };
+            const uint64_t mask{ 1ull << bit };
+
+            if (words_[i].compare_exchange_weak(word, word & ~mask, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return static_cast<int64_t>(i * BITS_PER_WORD + bit);
+            }
+        }
+    }
+
+    return INVALID_SLOT;
+}
+
+
+bool IdleWorkersBitmap::acquire(const uint32_t slot)
+{
+    if (slot >= capacity_)
+    {
+        return false;
+    }
+
+    const uint64_t mask{ 1ull << (slot % BITS_PER_WORD) };
+
+    return (words_[slot / BITS_PER_WORD].fetch_and(~mask, std::memory_order_acq_rel) & mask) != 0u;
+}
+
+
+uint32_t IdleWorkersBitmap::findFirstSet(const uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long index{ 0u };
+    _BitScanForward64(&index, word);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(word));
+#endif
+}
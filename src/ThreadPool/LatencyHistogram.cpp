@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cmath>
+
+#include "LatencyHistogram.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+const uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+const uint32_t LatencyHistogram::SUB_BUCKETS;
+const uint32_t LatencyHistogram::MAX_EXPONENT;
+const uint32_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+
+LatencyHistogram::Snapshot::Snapshot()
+    : counts_(NUMBER_OF_BUCKETS, 0u)
+    , count_{ 0u }
+    , sum_{ 0u }
+{
+}
+
+
+void LatencyHistogram::Snapshot::merge(const Snapshot & other)
+{
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        counts_[i] += other.counts_[i];
+    }
+
+    count_ += other.count_;
+    sum_ += other.sum_;
+}
+
+
+uint64_t LatencyHistogram::Snapshot::getCount() const
+{
+    return count_;
+}
+
+
+uint64_t LatencyHistogram::Snapshot::getSum() const
+{
+    return sum_;
+}
+
+
+double LatencyHistogram::Snapshot::getMean() const
+{
+    return count_ > 0u ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0;
+}
+
+
+uint64_t LatencyHistogram::Snapshot::getPercentile(const double percentile) const
+{
+    if (0u == count_)
+    {
+        return 0u;
+    }
+
+    // Rank of the value is rounded up and clamped to [1, count], so percentile 0 is the lowest value and 100 is the highest one,
+    // percentile is multiplied first, so whole ranks aren't rounded up because of the inexact percentile / 100
+    const double boundedPercentile{ percentile < 0.0 ? 0.0 : (percentile > 100.0 ? 100.0 : percentile) };
+    uint64_t rank{ static_cast<uint64_t>(std::ceil(boundedPercentile * static_cast<double>(count_) / 100.0)) };
+    rank = std::min(std::max(rank, static_cast<uint64_t>(1u)), count_);
+
+    uint64_t accumulatedCount{ 0u };
+
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        accumulatedCount += counts_[i];
+
+        if (accumulatedCount >= rank)
+        {
+            return getBucketHighestValue(i);
+        }
+    }
+
+    return getBucketHighestValue(NUMBER_OF_BUCKETS - 1u);
+}
+
+
+uint64_t LatencyHistogram::Snapshot::getCountAtOrBelow(const uint64_t value) const
+{
+    uint64_t accumulatedCount{ 0u };
+
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS && getBucketHighestValue(i) <= value; ++i)
+    {
+        accumulatedCount += counts_[i];
+    }
+
+    return accumulatedCount;
+}
+
+
+std::string LatencyHistogram::Snapshot::toString() const
+{
+    return "count " + std::to_string(count_)
+         + ", mean " + std::to_string(getMean())
+         + ", p50 " + std::to_string(getPercentile(50.0))
+         + ", p90 " + std::to_string(getPercentile(90.0))
+         + ", p99 " + std::to_string(getPercentile(99.0))
+         + ", p99.9 " + std::to_string(getPercentile(99.9))
+         + ", max " + std::to_string(getPercentile(100.0));
+}
+
+
+void LatencyHistogram::record(const uint64_t valueInMicroseconds)
+{
+    ++counts_[getBucketIndex(valueInMicroseconds)];
+    sum_ += valueInMicroseconds;
+}
+
+
+void LatencyHistogram::merge(const LatencyHistogram & other)
+{
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        counts_[i] += other.counts_[i].load();
+    }
+
+    sum_ += other.sum_.load();
+}
+
+
+void LatencyHistogram::reset()
+{
+    for (auto && count : counts_)
+    {
+        count.reset();
+    }
+
+    sum_.reset();
+}
+
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot() const
+{
+    Snapshot snapshot{};
+
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        snapshot.counts_[i] = counts_[i].load();
+        snapshot.count_ += snapshot.counts_[i];
+    }
+
+    snapshot.sum_ = sum_.load();
+
+    return snapshot;
+}
+
+
+uint32_t LatencyHistogram::getBucketIndex(const uint64_t value)
+{
+    if (value < SUB_BUCKETS)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    const uint32_t exponent{ findLastSet(value) };
+    if (exponent >= MAX_EXPONENT)
+    {
+        return NUMBER_OF_BUCKETS - 1u;
+    }
+
+    // Value is in [2^exponent, 2^(exponent + 1)), which is split into SUB_BUCKETS buckets of equal width
+    const uint32_t shift{ exponent - SUB_BUCKET_BITS };
+    const uint32_t subBucket{ static_cast<uint32_t>(value >> shift) - SUB_BUCKETS };
+
+    return SUB_BUCKETS + shift * SUB_BUCKETS + subBucket;
+}
+
+
+uint64_t LatencyHistogram::getBucketHighestValue(const uint32_t index)
+{
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const uint32_t shift{ (index - SUB_BUCKETS) / SUB_BUCKETS };
+    const uint64_t subBucket{ (index - SUB_BUCKETS) % SUB_BUCKETS };
+
+    return ((SUB_BUCKETS + subBucket + 1u) << shift) - 1u;
+}
+
+
+uint32_t LatencyHistogram::findLastSet(const uint64_t word)
+{
+#ifdef _MSC_VER
+    unsigned long index{ 0u };
+    _BitScanReverse64(&index, word);
+    return static_cast<uint32_t>(index);
+#else
+    return 63u - static_cast<uint32_t>(__builtin_clzll(word));
+#endif
+}
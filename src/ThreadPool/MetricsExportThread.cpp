@@ -0,0 +1,60 @@
+#include "MetricsExportThread.h"
+#include "Logging.h"
+
+
+MetricsExportThread::MetricsExportThread(const IThreadPool & threadPool,
+                                         const std::shared_ptr<IMetricsExporter> & metricsExporter,
+                                         const uint64_t periodInMicroseconds,
+                                         Logging * logging)
+    : OSAL::Thread{ logging == nullptr ? Logging::getInstance("MetricsExportThread") : logging }
+    , threadPool_{ threadPool }
+    , metricsExporter_{ metricsExporter }
+    , periodInMicroseconds_{ periodInMicroseconds }
+    , periodMonitor_{ (logging == nullptr ? Logging::getInstance("MetricsExportThread") : logging)->getSubInstance("PeriodMonitor") }
+{
+}
+
+
+MetricsExportThread::~MetricsExportThread()
+{
+    stop();
+}
+
+
+void MetricsExportThread::stop()
+{
+    periodMonitor_.lock();
+    threadMustEnd_ = true;
+    periodMonitor_.notifyAll();
+    periodMonitor_.unlock();
+
+    waitFinished(-1);
+}
+
+
+//! Exporter is called without any lock, since it reads statistic through the public methods of the thread pool
+void MetricsExportThread::run()
+{
+    periodMonitor_.lock();
+
+    while (!threadMustEnd_)
+    {
+        periodMonitor_.wait(static_cast<int64_t>(periodInMicroseconds_));
+
+        if (threadMustEnd_)
+        {
+            break;
+        }
+
+        periodMonitor_.unlock();
+
+        if (metricsExporter_->exportMetrics(threadPool_) != Result::OK)
+        {
+            LOGGING_WARNING(logging_, "Thread with id %" PRIu64 " can't export metrics", id_);
+        }
+
+        periodMonitor_.lock();
+    }
+
+    periodMonitor_.unlock();
+}
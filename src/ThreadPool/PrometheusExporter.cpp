@@ -0,0 +1,287 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "PrometheusExporter.h"
+
+
+const uint64_t PrometheusExporter::LATENCY_BUCKETS[]{ 10u, 50u, 100u, 500u, 1000u, 5000u, 10000u, 50000u, 100000u,
+                                                      500000u, 1000000u, 5000000u, 10000000u };
+const size_t PrometheusExporter::NUMBER_OF_LATENCY_BUCKETS{ sizeof(LATENCY_BUCKETS) / sizeof(LATENCY_BUCKETS[0]) };
+
+
+namespace
+{
+    double toSeconds(const uint64_t timeInMicroseconds)
+    {
+        return static_cast<double>(timeInMicroseconds) / 1000000.0;
+    }
+
+    void writeHeader(std::ostream & stream, const char * name, const char * type, const char * help)
+    {
+        stream << "# HELP " << name << " " << help << "\n"
+               << "# TYPE " << name << " " << type << "\n";
+    }
+
+    std::string getWorkerLabels(const std::string & poolLabel, const IThreadPool::WorkerStatistic & workerStatistic)
+    {
+        return poolLabel + ",worker=\"" + (workerStatistic.isBlocking ? "blocking_worker" : "worker")
+             + "\",slot=\"" + std::to_string(workerStatistic.slot) + "\"";
+    }
+
+    std::string getQueueLabels(const std::string & poolLabel, const IThreadPool::QueueStatistic & queueStatistic)
+    {
+        if (!queueStatistic.isWorkerQueue)
+        {
+            return poolLabel + ",queue=\"pool\"";
+        }
+
+        return poolLabel + ",queue=\"" + (queueStatistic.isBlockingWorker ? "blocking_worker" : "worker")
+             + "\",slot=\"" + std::to_string(queueStatistic.workerSlot) + "\"";
+    }
+
+    void writeHistogram(std::ostream & stream, const char * name, const char * help, const std::string & poolLabel,
+                        const LatencyHistogram::Snapshot (&snapshots)[IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS])
+    {
+        writeHeader(stream, name, "histogram", help);
+
+        for (uint8_t bucket = 0u; bucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS; ++bucket)
+        {
+            const LatencyHistogram::Snapshot & snapshot = snapshots[bucket];
+            const std::string labels{ poolLabel + ",bucket=\"" + std::to_string(bucket) + "\"" };
+
+            for (size_t i = 0u; i < PrometheusExporter::NUMBER_OF_LATENCY_BUCKETS; ++i)
+            {
+                // Sub-bucket straddling the bound is counted whole, so the bound is moved to its highest value
+                const uint32_t histogramBucket{ LatencyHistogram::getBucketIndex(PrometheusExporter::LATENCY_BUCKETS[i]) };
+                const uint64_t upperBound{ LatencyHistogram::getBucketHighestValue(histogramBucket) };
+
+                stream << name << "_bucket{" << labels << ",le=\"" << toSeconds(upperBound) << "\"} "
+                       << snapshot.getCountAtOrBelow(upperBound) << "\n";
+            }
+
+            stream << name << "_bucket{" << labels << ",le=\"+Inf\"} " << snapshot.getCount() << "\n"
+                   << name << "_sum{" << labels << "} " << toSeconds(snapshot.getSum()) << "\n"
+                   << name << "_count{" << labels << "} " << snapshot.getCount() << "\n";
+        }
+    }
+} // namespace
+
+
+PrometheusExporter::PrometheusExporter(const Callback & callback)
+    : callback_{ callback }
+    , filePath_{}
+{
+}
+
+
+PrometheusExporter::PrometheusExporter(const std::string & filePath)
+    : callback_{}
+    , filePath_{ filePath }
+{
+}
+
+
+Result PrometheusExporter::exportMetrics(const IThreadPool & threadPool)
+{
+    const std::string metrics{ render(threadPool) };
+
+    if (callback_)
+    {
+        callback_(metrics);
+        return Result::OK;
+    }
+
+    if (filePath_.empty())
+    {
+        return Result::ERROR;
+    }
+
+    const std::string temporaryFilePath{ filePath_ + ".tmp" };
+
+    {
+        std::ofstream file{ temporaryFilePath, std::ios::trunc };
+        file << metrics;
+
+        if (!file.good())
+        {
+            return Result::ERROR;
+        }
+    }
+
+    // Rename replaces existing file atomically on POSIX, on Windows existing file must be removed first
+#ifdef _WIN32
+    std::remove(filePath_.c_str());
+#endif
+
+    return 0 == std::rename(temporaryFilePath.c_str(), filePath_.c_str()) ? Result::OK : Result::ERROR;
+}
+
+
+std::string PrometheusExporter::render(const IThreadPool & threadPool)
+{
+    std::ostringstream stream;
+    render(threadPool, stream);
+
+    return stream.str();
+}
+
+
+void PrometheusExporter::render(const IThreadPool & threadPool, std::ostream & stream)
+{
+    const IThreadPool::Statistic statistic{ threadPool.getStatistic() };
+    const IThreadPool::LatencyStatistic latencyStatistic{ threadPool.getLatencyStatistic() };
+    const std::vector<IThreadPool::QueueStatistic> queuesStatistic{ threadPool.getQueuesStatistic() };
+    const std::vector<IThreadPool::WorkerStatistic> workersStatistic{ threadPool.getWorkersStatistic() };
+    const std::string poolLabel{ "pool=\"" + std::to_string(threadPool.getId()) + "\"" };
+
+    // Rendered into the local stream, so precision of the caller's stream isn't changed
+    std::ostringstream metrics;
+    metrics.precision(15);
+
+    auto writeSample = [&](const char * name, const std::string & labels, const uint64_t value)
+    {
+        metrics << name << "{" << labels << "} " << value << "\n";
+    };
+
+    writeHeader(metrics, "threadpool_workers", "gauge", "Current number of workers by state.");
+    writeSample("threadpool_workers", poolLabel + ",state=\"ready\"", statistic.numberOfWorkersInReadyState);
+    writeSample("threadpool_workers", poolLabel + ",state=\"running\"", statistic.numberOfWorkersInRunningState);
+    writeSample("threadpool_workers", poolLabel + ",state=\"waiting\"", statistic.numberOfWorkersInWaitingState);
+    writeSample("threadpool_workers", poolLabel + ",state=\"paused\"", statistic.numberOfWorkersInPausedState);
+
+    writeHeader(metrics, "threadpool_blocking_workers", "gauge", "Current number of workers dedicated to blocking tasks.");
+    writeSample("threadpool_blocking_workers", poolLabel, statistic.currentNumberOfBlockingWorkers);
+
+    writeHeader(metrics, "threadpool_workers_in_blocking_region", "gauge", "Current number of workers blocked inside BlockingRegion.");
+    writeSample("threadpool_workers_in_blocking_region", poolLabel, statistic.numberOfWorkersInBlockingRegion);
+
+    writeHeader(metrics, "threadpool_tasks_added_total", "counter", "Tasks added to the thread pool.");
+    writeSample("threadpool_tasks_added_total", poolLabel, statistic.totalNumberOfAddedTasks);
+
+    writeHeader(metrics, "threadpool_tasks_executed_total", "counter", "Tasks executed by workers.");
+    writeSample("threadpool_tasks_executed_total", poolLabel, statistic.totalNumberOfExecutedTasks);
+
+    writeHeader(metrics, "threadpool_tasks_not_executed_total", "counter", "Canceled or failed tasks got for execution by workers.");
+    writeSample("threadpool_tasks_not_executed_total", poolLabel, statistic.totalNumberOfNotExecutedTasks);
+
+    writeHeader(metrics, "threadpool_tasks_expired_total", "counter", "Tasks dropped by workers because of passed deadline or requested cancellation.");
+    writeSample("threadpool_tasks_expired_total", poolLabel, statistic.totalNumberOfExpiredTasks);
+
+    writeHeader(metrics, "threadpool_tasks_stolen_total", "counter", "Tasks moved between workers by load balancing.");
+    writeSample("threadpool_tasks_stolen_total", poolLabel, statistic.totalNumberOfStolenTasks);
+
+    writeHeader(metrics, "threadpool_tasks_rejected_total", "counter", "Tasks rejected or dropped because of full queue.");
+    writeSample("threadpool_tasks_rejected_total", poolLabel, statistic.totalNumberOfRejectedTasks);
+
+    writeHeader(metrics, "threadpool_tasks_caller_runs_total", "counter", "Tasks executed by the producer's thread because of full queue.");
+    writeSample("threadpool_tasks_caller_runs_total", poolLabel, statistic.totalNumberOfCallerRunsTasks);
+
+    writeHeader(metrics, "threadpool_tasks_long_total", "counter", "Tasks executed longer than the long task budget.");
+    writeSample("threadpool_tasks_long_total", poolLabel, statistic.totalNumberOfLongTasks);
+
+    writeHeader(metrics, "threadpool_workers_scaled_up_total", "counter", "Workers added automatically because of the queue delay.");
+    writeSample("threadpool_workers_scaled_up_total", poolLabel, statistic.totalNumberOfScaledUpWorkers);
+
+    writeHeader(metrics, "threadpool_workers_retired_total", "counter", "Workers removed automatically after keep alive time.");
+    writeSample("threadpool_workers_retired_total", poolLabel, statistic.totalNumberOfRetiredWorkers);
+
+    writeHeader(metrics, "threadpool_uptime_seconds", "gauge", "Time since thread pool creation.");
+    metrics << "threadpool_uptime_seconds{" << poolLabel << "} " << toSeconds(statistic.uptimeInMicroseconds) << "\n";
+
+    writeHeader(metrics, "threadpool_workers_busy_seconds_total", "counter", "Time all workers spent executing tasks.");
+    metrics << "threadpool_workers_busy_seconds_total{" << poolLabel << "} " << toSeconds(statistic.totalWorkersBusyTimeInMicroseconds) << "\n";
+
+    writeHeader(metrics, "threadpool_workers_idle_seconds_total", "counter", "Time all workers spent parked waiting for tasks.");
+    metrics << "threadpool_workers_idle_seconds_total{" << poolLabel << "} " << toSeconds(statistic.totalWorkersIdleTimeInMicroseconds) << "\n";
+
+    writeHeader(metrics, "threadpool_workers_cpu_seconds_total", "counter", "CPU time consumed by all worker threads.");
+    metrics << "threadpool_workers_cpu_seconds_total{" << poolLabel << "} " << toSeconds(statistic.totalWorkersCpuTimeInMicroseconds) << "\n";
+
+    writeHeader(metrics, "threadpool_workers_utilization", "gauge", "Busy time of all workers divided by their busy and idle time.");
+    metrics << "threadpool_workers_utilization{" << poolLabel << "} " << statistic.workersUtilization << "\n";
+
+    // Like worker queues, counters of the worker start from zero for the new worker of the slot
+    writeHeader(metrics, "threadpool_worker_busy_seconds_total", "counter", "Time the worker spent executing tasks.");
+    for (auto && workerStatistic : workersStatistic)
+    {
+        metrics << "threadpool_worker_busy_seconds_total{" << getWorkerLabels(poolLabel, workerStatistic) << "} "
+                << toSeconds(workerStatistic.busyTime) << "\n";
+    }
+
+    writeHeader(metrics, "threadpool_worker_idle_seconds_total", "counter", "Time the worker spent parked waiting for tasks.");
+    for (auto && workerStatistic : workersStatistic)
+    {
+        metrics << "threadpool_worker_idle_seconds_total{" << getWorkerLabels(poolLabel, workerStatistic) << "} "
+                << toSeconds(workerStatistic.idleTime) << "\n";
+    }
+
+    writeHeader(metrics, "threadpool_worker_cpu_seconds_total", "counter", "CPU time consumed by the worker thread.");
+    for (auto && workerStatistic : workersStatistic)
+    {
+        metrics << "threadpool_worker_cpu_seconds_total{" << getWorkerLabels(poolLabel, workerStatistic) << "} "
+                << toSeconds(workerStatistic.cpuTime) << "\n";
+    }
+
+    writeHeader(metrics, "threadpool_worker_utilization", "gauge", "Busy time of the worker divided by its lifetime.");
+    for (auto && workerStatistic : workersStatistic)
+    {
+        metrics << "threadpool_worker_utilization{" << getWorkerLabels(poolLabel, workerStatistic) << "} "
+                << workerStatistic.utilization << "\n";
+    }
+
+    // Worker queues exist while their workers exist, so their counters start from zero for the new worker of the slot
+    writeHeader(metrics, "threadpool_queue_tasks", "gauge", "Tasks waiting in the queue.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_tasks", getQueueLabels(poolLabel, queueStatistic), queueStatistic.approximateSize);
+    }
+
+    writeHeader(metrics, "threadpool_queue_work", "gauge", "Estimated work of the tasks waiting in the queue.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_work", getQueueLabels(poolLabel, queueStatistic), queueStatistic.approximateWork);
+    }
+
+    writeHeader(metrics, "threadpool_queue_scheduled_tasks_total", "counter", "Tasks scheduled to the queue.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_scheduled_tasks_total", getQueueLabels(poolLabel, queueStatistic),
+                    queueStatistic.schedulerStatistic.totalNumberOfScheduledTasks);
+    }
+
+    writeHeader(metrics, "threadpool_queue_unscheduled_tasks_total", "counter", "Tasks removed from the queue without execution.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_unscheduled_tasks_total", getQueueLabels(poolLabel, queueStatistic),
+                    queueStatistic.schedulerStatistic.totalNumberOfUnscheduledTasks);
+    }
+
+    writeHeader(metrics, "threadpool_queue_stolen_tasks_total", "counter", "Tasks stolen from the queue.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_stolen_tasks_total", getQueueLabels(poolLabel, queueStatistic),
+                    queueStatistic.schedulerStatistic.totalNumberOfStolenTasks);
+    }
+
+    writeHeader(metrics, "threadpool_queue_got_for_execution_tasks_total", "counter", "Tasks taken from the queue for execution.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_got_for_execution_tasks_total", getQueueLabels(poolLabel, queueStatistic),
+                    queueStatistic.schedulerStatistic.totalNumberOfGotForExecutionTasks);
+    }
+
+    writeHeader(metrics, "threadpool_queue_reclaimed_tasks_total", "counter", "Canceled tasks removed from the queue without execution.");
+    for (auto && queueStatistic : queuesStatistic)
+    {
+        writeSample("threadpool_queue_reclaimed_tasks_total", getQueueLabels(poolLabel, queueStatistic),
+                    queueStatistic.schedulerStatistic.totalNumberOfReclaimedTasks);
+    }
+
+    writeHistogram(metrics, "threadpool_task_queue_wait_seconds", "Time from adding the task till worker takes it, by scheduling bucket.",
+                   poolLabel, latencyStatistic.queueWaitTime);
+    writeHistogram(metrics, "threadpool_task_execution_seconds", "Execution time of the task, by scheduling bucket.",
+                   poolLabel, latencyStatistic.executionTime);
+
+    stream << metrics.str();
+}
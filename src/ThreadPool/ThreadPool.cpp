@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <fstream>
+
 #include "FirstComeFirstServedTaskScheduler.h"
 #include "PriorityTaskScheduler.h"
 #include "ShortestJobFirstTaskScheduler.h"
+#include "FairShareTaskScheduler.h"
 #include "ThreadPool.h"
 #include "Logging.h"
 
@@ -23,48 +27,143 @@ IThreadPool::State ThreadPool::getState() const
 }
 
 
+//! Statistic is aggregated from workers' shards without any lock, so it never blocks workers or managing thread
 IThreadPool::Statistic ThreadPool::getStatistic() const
 {
-    logging_->logDebug("%" PRIu64 " is requested to get statistic", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to get statistic", id_);
+
+    const WorkersStatistic::Snapshot workersSnapshot{ workersStatistic_->getSnapshot() };
+
+    IThreadPool::Statistic statistic{};
+
+    statistic.currentNumberOfAllWorkers         = workersSnapshot.numberOfWorkers;
+    statistic.numberOfWorkersInReadyState       = workersSnapshot.numberOfWorkersInReadyState;
+    statistic.numberOfWorkersInRunningState     = workersSnapshot.numberOfWorkersInRunningState;
+    statistic.numberOfWorkersInWaitingState     = workersSnapshot.numberOfWorkersInWaitingState;
+    statistic.numberOfWorkersInPausedState      = workersSnapshot.numberOfWorkersInPausedState;
+
+    statistic.currentNumberOfBlockingWorkers    = numberOfBlockingWorkers_.load(std::memory_order_relaxed);
+    statistic.numberOfWorkersInBlockingRegion   = workersSnapshot.numberOfWorkersInBlockingRegion;
+
+    statistic.totalNumberOfAddedTasks           = totalNumberOfAddedTasks_.value.load();
+    statistic.totalNumberOfExecutedTasks        = workersSnapshot.numberOfExecutedTasks;
+    statistic.totalNumberOfNotExecutedTasks     = workersSnapshot.numberOfNotExecutedTasks;
+    statistic.totalNumberOfExpiredTasks         = workersSnapshot.numberOfExpiredTasks;
+    statistic.totalNumberOfStolenTasks          = workersSnapshot.numberOfStolenTasks;
+
+    statistic.totalNumberOfScaledUpWorkers      = totalNumberOfScaledUpWorkers_.load();
+    statistic.totalNumberOfRetiredWorkers       = totalNumberOfRetiredWorkers_.load();
+    statistic.totalNumberOfRejectedTasks        = totalNumberOfRejectedTasks_.load();
+    statistic.totalNumberOfCallerRunsTasks      = totalNumberOfCallerRunsTasks_.load();
+    statistic.totalNumberOfLongTasks            = totalNumberOfLongTasks_.load();
+
+    statistic.uptimeInMicroseconds              = uptime_.getElapsedTime();
+
+    if (statistic.uptimeInMicroseconds > 0u)
+    {
+        const double uptimeInSeconds{ static_cast<double>(statistic.uptimeInMicroseconds) / 1000000.0 };
+
+        statistic.executedTasksPerSecond        = static_cast<double>(statistic.totalNumberOfExecutedTasks) / uptimeInSeconds;
+        statistic.stolenTasksPerSecond          = static_cast<double>(statistic.totalNumberOfStolenTasks) / uptimeInSeconds;
+    }
+
+    statistic.totalWorkersBusyTimeInMicroseconds        = workersSnapshot.busyTime;
+    statistic.totalWorkersIdleTimeInMicroseconds        = workersSnapshot.idleTime;
+    statistic.totalWorkersCpuTimeInMicroseconds         = workersSnapshot.cpuTime;
+
+    if (workersSnapshot.busyTime + workersSnapshot.idleTime > 0u)
+    {
+        statistic.workersUtilization = static_cast<double>(workersSnapshot.busyTime)
+                                     / static_cast<double>(workersSnapshot.busyTime + workersSnapshot.idleTime);
+    }
+
+    LOGGING_DEBUG(logging_, "%" PRIu64 " statistic:\n%s", id_, statistic.toString().c_str());
+
+    return statistic;
+}
+
+
+IThreadPool::LatencyStatistic ThreadPool::getLatencyStatistic() const
+{
+    IThreadPool::LatencyStatistic latencyStatistic{};
+
+    for (uint8_t bucket = 0u; bucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS; ++bucket)
+    {
+        latencyStatistic.queueWaitTime[bucket] = workersStatistic_->getQueueWaitTime(bucket);
+        latencyStatistic.executionTime[bucket] = workersStatistic_->getExecutionTime(bucket);
+    }
+
+    return latencyStatistic;
+}
+
+
+std::vector<IThreadPool::QueueStatistic> ThreadPool::getQueuesStatistic() const
+{
+    std::vector<IThreadPool::QueueStatistic> queuesStatistic;
 
-    uint32_t numberOfWorkersInReadyState{ 0u };
-    uint32_t numberOfWorkersInRunningState{ 0u };
-    uint32_t numberOfWorkersInWaitingState{ 0u };
-    uint32_t numberOfWorkersInPausedState{ 0u };
+    IThreadPool::QueueStatistic threadPoolQueueStatistic{};
+    threadPoolQueueStatistic.approximateSize = taskScheduler_->getApproximateSize();
+    threadPoolQueueStatistic.approximateWork = taskScheduler_->getApproximateWork();
+    threadPoolQueueStatistic.schedulerStatistic = taskScheduler_->getStatistic();
+    queuesStatistic.push_back(threadPoolQueueStatistic);
 
+    // Only the list of workers is guarded, their queues are read without locks
     workersMutex_.lock();
 
-    for (auto && workerIt : workers_)
+    for (auto && worker : slotToWorker_)
     {
-        switch (workerIt->getState())
+        if (worker != nullptr)
         {
-            case ThreadPoolWorker::State::READY:
-                ++numberOfWorkersInReadyState;
-                break;
-            case ThreadPoolWorker::State::RUNNING:
-                ++numberOfWorkersInRunningState;
-                break;
-            case ThreadPoolWorker::State::WAITING:
-                ++numberOfWorkersInWaitingState;
-                break;
-            case ThreadPoolWorker::State::PAUSED:
-                ++numberOfWorkersInPausedState;
-            default:
-                break;
+            IThreadPool::QueueStatistic workerQueueStatistic{};
+            workerQueueStatistic.isWorkerQueue = true;
+            workerQueueStatistic.workerSlot = worker->getSlot();
+            workerQueueStatistic.isBlockingWorker = worker->isBlocking();
+            workerQueueStatistic.approximateSize = worker->getApproximateTasksSize();
+            workerQueueStatistic.approximateWork = worker->getApproximateTasksWork();
+            workerQueueStatistic.schedulerStatistic = worker->getTasksStatistic();
+            queuesStatistic.push_back(workerQueueStatistic);
         }
     }
 
-    statistic_.currentNumberOfAllWorkers        = static_cast<uint32_t>(workers_.size());
-    statistic_.numberOfWorkersInReadyState      = numberOfWorkersInReadyState;
-    statistic_.numberOfWorkersInRunningState    = numberOfWorkersInRunningState;
-    statistic_.numberOfWorkersInWaitingState    = numberOfWorkersInWaitingState;
-    statistic_.numberOfWorkersInPausedState     = numberOfWorkersInPausedState;
-
     workersMutex_.unlock();
 
-    logging_->logDebug("%" PRIu64 " statistic:\n%s", id_, statistic_.toString().c_str());
+    return queuesStatistic;
+}
+
+
+std::vector<IThreadPool::WorkerStatistic> ThreadPool::getWorkersStatistic() const
+{
+    std::vector<IThreadPool::WorkerStatistic> workersStatistic;
+
+    workersMutex_.lock();
+
+    for (auto && worker : slotToWorker_)
+    {
+        if (worker != nullptr && worker->getSlot() < workersStatistic_->getCapacity())
+        {
+            const WorkersStatistic::Shard & shard = workersStatistic_->getShard(worker->getSlot());
+
+            IThreadPool::WorkerStatistic workerStatistic{};
+            workerStatistic.slot = worker->getSlot();
+            workerStatistic.isBlocking = worker->isBlocking();
+            workerStatistic.lifetime = worker->getLifetime();
+            workerStatistic.busyTime = shard.busyTime.load();
+            workerStatistic.idleTime = shard.idleTime.load();
+            workerStatistic.cpuTime = shard.cpuTime.load();
+
+            if (workerStatistic.lifetime > 0u)
+            {
+                workerStatistic.utilization = std::min(1.0, static_cast<double>(workerStatistic.busyTime)
+                                                            / static_cast<double>(workerStatistic.lifetime));
+            }
+
+            workersStatistic.push_back(workerStatistic);
+        }
+    }
+
+    workersMutex_.unlock();
 
-    return statistic_;
+    return workersStatistic;
 }
 
 
@@ -107,42 +206,91 @@ bool ThreadPool::isTaskAdded(const uint64_t taskId) const
 }
 
 
-Result ThreadPool::waitAllTasksExecutionFinished(const int64_t timeout)
+Result ThreadPool::dumpTrace(std::ostream & stream) const
 {
-    logging_->logDebug("%" PRIu64 " is requested to wait for all tasks execution finished", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to dump trace", id_);
 
-    Result result{ Result::OK };
-    OSAL::Timeout waitTimeout{ timeout };
+    std::vector<std::string> trackNames(flightRecorder_->getNumberOfTracks());
 
-    logging_->logDebug("%" PRIu64 " is waiting for all task being got for execution...", id_);
-
-    tasksExecutionMonitor_.lock();
+    workersMutex_.lock();
 
-    // Wait for all tasks from scheduler become added to workers and workers finish execution
-    while (Result::OK == result && !areAllTasksPutForExecution_ && taskScheduler_->getSize() != 0u)
+    for (size_t slot = 0u; slot < slotToWorker_.size(); ++slot)
     {
-        result = tasksExecutionMonitor_.wait(waitTimeout.getRemainingTime());
+        const WorkersContainer::value_type & worker = slotToWorker_[slot];
+        if (worker != nullptr)
+        {
+            trackNames[slot] = "Worker " + std::to_string(worker->getId())
+                             + (worker->isBlocking() ? " (blocking)" : "")
+                             + (worker->getAffinity() >= 0 ? " CPU " + std::to_string(worker->getAffinity()) : "");
+        }
     }
 
-    workersMutex_.lock();
-    size_t tasksSizeInAllWorkers{ getTasksSizeFromAllWorkers() };
     workersMutex_.unlock();
 
-    logging_->logDebug("%" PRIu64 " is waiting for all workers to finish tasks execution...", id_);
+    flightRecorder_->writeChromeTrace(stream, id_, trackNames);
 
-    // Wait for workers to finish execution (workers use same monitor for notification about free state)
-    while (Result::OK == result && tasksSizeInAllWorkers != 0u)
+    return stream.good() ? Result::OK : Result::ERROR;
+}
+
+
+Result ThreadPool::dumpTrace(const std::string & filePath) const
+{
+    std::ofstream file{ filePath };
+
+    if (!file.is_open())
+    {
+        LOGGING_ERROR(logging_, "%" PRIu64 " can't open trace file %s", id_, filePath.c_str());
+        return Result::ERROR;
+    }
+
+    return dumpTrace(file);
+}
+
+
+Result ThreadPool::waitAllTasksExecutionFinished(const int64_t timeout)
+{
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to wait for all tasks execution finished", id_);
+
+    Result result{ Result::OK };
+    OSAL::Timeout waitTimeout{ timeout };
+
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is waiting for all task being got for execution...", id_);
+
+    tasksExecutionMonitor_.lock();
+
+    bool areTasksWaitingInScheduler{ true };
+
+    while (Result::OK == result && areTasksWaitingInScheduler)
     {
-        result = tasksExecutionMonitor_.wait(waitTimeout.getRemainingTime());
+        // Wait for all tasks from scheduler become added to workers and workers finish execution
+        while (Result::OK == result && !areAllTasksPutForExecution_ && taskScheduler_->getSize() != 0u)
+        {
+            result = tasksExecutionMonitor_.wait(waitTimeout.getRemainingTime());
+        }
 
         workersMutex_.lock();
-        tasksSizeInAllWorkers = getTasksSizeFromAllWorkers();
+        size_t tasksSizeInAllWorkers{ getTasksSizeFromAllWorkers() };
         workersMutex_.unlock();
+
+        LOGGING_DEBUG(logging_, "%" PRIu64 " is waiting for all workers to finish tasks execution...", id_);
+
+        // Wait for workers to finish execution (workers use same monitor for notification about free state)
+        while (Result::OK == result && tasksSizeInAllWorkers != 0u)
+        {
+            result = tasksExecutionMonitor_.wait(waitTimeout.getRemainingTime());
+
+            workersMutex_.lock();
+            tasksSizeInAllWorkers = getTasksSizeFromAllWorkers();
+            workersMutex_.unlock();
+        }
+
+        // Tasks of the worker executing long task could be requeued meanwhile
+        areTasksWaitingInScheduler = !areAllTasksPutForExecution_ && taskScheduler_->getSize() != 0u;
     }
 
     tasksExecutionMonitor_.unlock();
 
-    logging_->logDebug("%" PRIu64 " finish waiting for all tasks execution finished with result %s", id_, resultToStr(result).c_str());
+    LOGGING_DEBUG(logging_, "%" PRIu64 " finish waiting for all tasks execution finished with result %s", id_, resultToStr(result).c_str());
 
     return result;
 }
@@ -154,21 +302,28 @@ Result ThreadPool::addTask(const std::shared_ptr<IThreadPoolTask> task)
 
     if (task != nullptr)
     {
-        tasksExecutionMonitor_.lock();
+        task->setAddedTime(OSAL::Time::getCurrentTime());
 
-        result = taskScheduler_->schedule(task);
-        areAllTasksPutForExecution_ = false;
+        if (admitTask(task, result))
+        {
+            flightRecorder_->record(flightRecorder_->getProducersTrack(), FlightRecorder::EventType::SUBMIT, task->getId(), 0u, task->getAddedTime());
 
-        ++statistic_.totalNumberOfAddedTasks;
+            tasksExecutionMonitor_.lock();
 
-        tasksExecutionMonitor_.notifyAll();
-        tasksExecutionMonitor_.unlock();
+            result = taskScheduler_->schedule(task);
+            areAllTasksPutForExecution_ = false;
+
+            ++totalNumberOfAddedTasks_.value;
+
+            tasksExecutionMonitor_.notifyAll();
+            tasksExecutionMonitor_.unlock();
 
-        logging_->logDebug("%" PRIu64 " add task with id %" PRIu64, id_, task->getId());
+            LOGGING_DEBUG(logging_, "%" PRIu64 " add task with id %" PRIu64, id_, task->getId());
+        }
     }
     else
     {
-        logging_->logDebug("%" PRIu64 " can't add nullptr task", id_);
+        LOGGING_DEBUG(logging_, "%" PRIu64 " can't add nullptr task", id_);
     }
 
     return result;
@@ -177,28 +332,49 @@ Result ThreadPool::addTask(const std::shared_ptr<IThreadPoolTask> task)
 
 Result ThreadPool::addTasks(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) // TODO: Cover with tests
 {
-    logging_->logDebug("%" PRIu64 " is requested to add %" PRIu32 " tasks", id_, static_cast<uint32_t>(tasks.size()));
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to add %" PRIu32 " tasks", id_, static_cast<uint32_t>(tasks.size()));
 
     Result result{ Result::ERROR };
 
     if (!tasks.empty())
     {
         uint32_t addedTasksCount{ 0u };
+        const uint64_t addedTime{ OSAL::Time::getCurrentTime() };
 
-        tasksExecutionMonitor_.lock();
+        // Queue capacity is reserved before locking, since blocking producer must not hold the monitor
+        std::vector<std::shared_ptr<IThreadPoolTask>> admittedTasks;
+        Result admissionResult{ Result::OK };
 
         for (auto && taskIt : tasks)
         {
             if (taskIt != nullptr)
             {
-                result += taskScheduler_->schedule(taskIt);
-                ++addedTasksCount;
+                taskIt->setAddedTime(addedTime);
+
+                Result taskAdmissionResult{ Result::OK };
+                if (admitTask(taskIt, taskAdmissionResult))
+                {
+                    flightRecorder_->record(flightRecorder_->getProducersTrack(), FlightRecorder::EventType::SUBMIT, taskIt->getId(), 0u, addedTime);
+                    admittedTasks.push_back(taskIt);
+                }
+                else if (taskAdmissionResult != Result::OK)
+                {
+                    admissionResult = taskAdmissionResult;
+                }
             }
         }
 
+        tasksExecutionMonitor_.lock();
+
+        for (auto && taskIt : admittedTasks)
+        {
+            result += taskScheduler_->schedule(taskIt);
+            ++addedTasksCount;
+        }
+
         if (addedTasksCount > 0u)
         {
-            statistic_.totalNumberOfAddedTasks += addedTasksCount;
+            totalNumberOfAddedTasks_.value += addedTasksCount;
             areAllTasksPutForExecution_ = false;
 
             tasksExecutionMonitor_.notifyAll();
@@ -206,11 +382,16 @@ Result ThreadPool::addTasks(const std::vector<std::shared_ptr<IThreadPoolTask>>
 
         tasksExecutionMonitor_.unlock();
 
-        logging_->logDebug("%" PRIu64 " add %" PRIu32 " tasks", id_, addedTasksCount);
+        if (admissionResult != Result::OK)
+        {
+            result = admissionResult;
+        }
+
+        LOGGING_DEBUG(logging_, "%" PRIu64 " add %" PRIu32 " tasks", id_, addedTasksCount);
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " can't add empty container with tasks", id_);
+        LOGGING_WARNING(logging_, "%" PRIu64 " can't add empty container with tasks", id_);
     }
 
     return result;
@@ -219,7 +400,7 @@ Result ThreadPool::addTasks(const std::vector<std::shared_ptr<IThreadPoolTask>>
 
 Result ThreadPool::addTaskToEveryWorker(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks) // TODO: Cover with tests
 {
-    logging_->logDebug("%" PRIu64 " is requested to add %" PRIu32 " tasks to every worker", id_, static_cast<uint32_t>(tasks.size()));
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to add %" PRIu32 " tasks to every worker", id_, static_cast<uint32_t>(tasks.size()));
 
     Result result{ Result::ERROR };
 
@@ -233,17 +414,19 @@ Result ThreadPool::addTaskToEveryWorker(const std::vector<std::shared_ptr<IThrea
 
             uint32_t workersIndex{ 0u };
             uint32_t tasksIndex{ 0u };
+            const uint64_t addedTime{ OSAL::Time::getCurrentTime() };
 
             for (auto && taskIt : tasks)
             {
                 if (taskIt != nullptr)
                 {
+                    taskIt->setAddedTime(addedTime);
                     workers_[workersIndex % workersSize]->addTask(taskIt);
                     ++workersIndex;
                 }
                 else
                 {
-                    logging_->logWarning("%" PRIu64 " can't add nullptr task to worker", id_);
+                    LOGGING_WARNING(logging_, "%" PRIu64 " can't add nullptr task to worker", id_);
                 }
 
                 ++tasksIndex;
@@ -251,20 +434,20 @@ Result ThreadPool::addTaskToEveryWorker(const std::vector<std::shared_ptr<IThrea
 
             if (workersIndex > 0u)
             {
-                statistic_.totalNumberOfAddedTasks += workersIndex;
+                totalNumberOfAddedTasks_.value += workersIndex;
                 result = Result::OK;
             }
         }
         else
         {
-            logging_->logWarning("%" PRIu64 " has no workers to add task", id_);
+            LOGGING_WARNING(logging_, "%" PRIu64 " has no workers to add task", id_);
         }
 
         workersMutex_.unlock();
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " can't add empty container with tasks", id_);
+        LOGGING_WARNING(logging_, "%" PRIu64 " can't add empty container with tasks", id_);
     }
 
     return result;
@@ -273,15 +456,22 @@ Result ThreadPool::addTaskToEveryWorker(const std::vector<std::shared_ptr<IThrea
 
 std::shared_ptr<IThreadPoolTask> ThreadPool::removeOneTask(const uint64_t taskId)
 {
-    logging_->logDebug("%" PRIu64 " is requested to remove one task with id %" PRIu64, id_, taskId);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to remove one task with id %" PRIu64, id_, taskId);
+
+    const std::shared_ptr<IThreadPoolTask> removedTask{ taskScheduler_->unscheduleOne(taskId) };
 
-    return taskScheduler_->unscheduleOne(taskId);
+    if (removedTask != nullptr)
+    {
+        removedTask->detachQueuedTasksCounter(queuedTasksCounter_);
+    }
+
+    return removedTask;
 }
 
 
 std::vector<std::shared_ptr<IThreadPoolTask>> ThreadPool::removeAllTasks(const bool needsRemoveFromWorkers)
 {
-    logging_->logDebug("%" PRIu64 " is requested to remove all tasks (remove from workers = %s)", id_, std::to_string(needsRemoveFromWorkers).c_str());
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to remove all tasks (remove from workers = %s)", id_, std::to_string(needsRemoveFromWorkers).c_str());
 
     using TasksContainer = std::vector<std::shared_ptr<IThreadPoolTask>>;
 
@@ -291,35 +481,50 @@ std::vector<std::shared_ptr<IThreadPoolTask>> ThreadPool::removeAllTasks(const b
     {
         workersMutex_.lock();
 
-        for (auto && workerIt : workers_)
+        for (auto && workersIt : { &workers_, &blockingWorkers_ })
         {
-            TasksContainer removedTasksFromWorker{ workerIt->removeAllTasks() };
+            for (auto && workerIt : *workersIt)
+            {
+                TasksContainer removedTasksFromWorker{ workerIt->removeAllTasks() };
 
-            allRemovedTasks.insert(allRemovedTasks.end(),
-                std::make_move_iterator(removedTasksFromWorker.begin()),
-                std::make_move_iterator(removedTasksFromWorker.end()));
+                allRemovedTasks.insert(allRemovedTasks.end(),
+                    std::make_move_iterator(removedTasksFromWorker.begin()),
+                    std::make_move_iterator(removedTasksFromWorker.end()));
+            }
         }
 
         workersMutex_.unlock();
     }
 
+    releaseQueuedTasks(allRemovedTasks);
+
     return allRemovedTasks;
 }
 
 
 Result ThreadPool::clearAllTasks(const bool needsClearFromWorkers)
 {
-    logging_->logDebug("%" PRIu64 " is requested to clear all tasks (clear from workers = %s)", id_, std::to_string(needsClearFromWorkers).c_str());
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to clear all tasks (clear from workers = %s)", id_, std::to_string(needsClearFromWorkers).c_str());
+
+    // Cleared tasks are taken out instead of being destroyed in the queues, since they must give their places back
+    const std::vector<std::shared_ptr<IThreadPoolTask>> clearedTasks{ taskScheduler_->unscheduleAll() };
+    Result result{ clearedTasks.empty() ? Result::ERROR : Result::OK };
 
-    Result result{ taskScheduler_->clearAll() };
+    releaseQueuedTasks(clearedTasks);
 
     if (needsClearFromWorkers)
     {
         workersMutex_.lock();
 
-        for (auto && workerIt : workers_)
+        for (auto && workersIt : { &workers_, &blockingWorkers_ })
         {
-            result += workerIt->clearAllTasks();
+            for (auto && workerIt : *workersIt)
+            {
+                const std::vector<std::shared_ptr<IThreadPoolTask>> clearedWorkerTasks{ workerIt->removeAllTasks() };
+                result += clearedWorkerTasks.empty() ? Result::ERROR : Result::OK;
+
+                releaseQueuedTasks(clearedWorkerTasks);
+            }
         }
 
         workersMutex_.unlock();
@@ -351,7 +556,7 @@ Result ThreadPool::decreaseWorkers(const uint32_t number, const bool needsResche
 
 Result ThreadPool::startExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to start execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to start execution", id_);
 
     workersMutex_.lock();
 
@@ -362,14 +567,14 @@ Result ThreadPool::startExecution()
         result = createManagingThread();
         if (result != Result::OK)
         {
-            logging_->logError("%" PRIu64 " can't create load balancing thread", id_);
+            LOGGING_ERROR(logging_, "%" PRIu64 " can't create load balancing thread", id_);
         }
 
         result += createWorkerThreads();
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " has already been started", id_);
+        LOGGING_WARNING(logging_, "%" PRIu64 " has already been started", id_);
     }
 
     workersMutex_.unlock();
@@ -380,7 +585,7 @@ Result ThreadPool::startExecution()
 
 Result ThreadPool::pauseExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to pause execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to pause execution", id_);
 
     workersMutex_.lock();
 
@@ -395,7 +600,7 @@ Result ThreadPool::pauseExecution()
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " is not running", id_);
+        LOGGING_WARNING(logging_, "%" PRIu64 " is not running", id_);
     }
 
     workersMutex_.unlock();
@@ -406,7 +611,7 @@ Result ThreadPool::pauseExecution()
 
 Result ThreadPool::resumeExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to resume execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to resume execution", id_);
 
     workersMutex_.lock();
 
@@ -421,7 +626,7 @@ Result ThreadPool::resumeExecution()
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " is not paused", id_);
+        LOGGING_WARNING(logging_, "%" PRIu64 " is not paused", id_);
     }
 
     workersMutex_.unlock();
@@ -437,164 +642,702 @@ Result ThreadPool::resumeExecution()
 ///////////////////////////////////////////////////////////////////////////////////////////////
 
 //! ATTENTION! This method is called with the workersMutex_ locked
+//! Published (approximate) tasks sizes are used, so workers' schedulers aren't locked during balancing.
+//! They may lag behind the exact sizes by the changes in progress, which is fine for the one task move per pass.
 void ThreadPool::loadBalance()
 {
-    logging_->logDebug("%" PRIu64 " is requested to do load balancing", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to do load balancing", id_);
 
     if (!workers_.empty())
     {
-        const auto workerWithMinMaxTasksSizeIt = std::minmax_element(workers_.cbegin(), workers_.cend(),
-                                                 [](const WorkersContainer::value_type & lhsWorker, const WorkersContainer::value_type & rhsWorker)
-                                                 {
-                                                     return lhsWorker->getTasksSize() < rhsWorker->getTasksSize();
-                                                 });
+        auto workerWithMinTasksSizeIt = workers_.cend();
+        auto workerWithMaxTasksSizeIt = workers_.cend();
+        size_t minTasksSize{ 0u };
+        size_t maxTasksSize{ 0u };
+
+        // Every size is read once, so min and max are consistent with each other
+        for (auto workerIt = workers_.cbegin(); workerIt != workers_.cend(); ++workerIt)
+        {
+            const size_t tasksSize{ (*workerIt)->getApproximateTasksSize() };
+
+            // Reserved worker would steal any task, so it never steals, as well as worker executing long task
+            if (!isReservedWorker(*workerIt) && !longTaskWorkersSlots_->isSet((*workerIt)->getSlot())
+                && (workerWithMinTasksSizeIt == workers_.cend() || tasksSize < minTasksSize))
+            {
+                minTasksSize = tasksSize;
+                workerWithMinTasksSizeIt = workerIt;
+            }
 
-        const auto minTasksSize = (*workerWithMinMaxTasksSizeIt.first)->getTasksSize();
-        const auto maxTasksSize = (*workerWithMinMaxTasksSizeIt.second)->getTasksSize();
+            if (workerWithMaxTasksSizeIt == workers_.cend() || tasksSize > maxTasksSize)
+            {
+                maxTasksSize = tasksSize;
+                workerWithMaxTasksSizeIt = workerIt;
+            }
+        }
 
         //! We don't consider case when first workers has for example 10 tasks and other 11 as imbalanced situation.
-        const bool isLoadBalanced{ minTasksSize == maxTasksSize || minTasksSize + 1u == maxTasksSize };
+        bool isLoadBalanced{ workerWithMinTasksSizeIt == workers_.cend() || minTasksSize == maxTasksSize || minTasksSize + 1u == maxTasksSize };
+
+        if (!isLoadBalanced && !affinityCpus_.empty())
+        {
+            // Stolen task keeps its data in the shared cache, if there is a loaded enough worker nearby
+            auto victimIt = findVictimSharingCache(workerWithMinTasksSizeIt, minTasksSize + 2u);
+
+            // Then it stays in the local memory of the node
+            if (victimIt == workers_.cend() && options_.isNumaAware())
+            {
+                victimIt = findVictimOnNumaNode(workerWithMinTasksSizeIt, minTasksSize + 2u);
+
+                // Remote memory access is worse than waiting, so other nodes are robbed only when this one has nothing to execute
+                if (victimIt == workers_.cend() && hasNumaNodeTasks(getWorkerNumaNode(*workerWithMinTasksSizeIt)))
+                {
+                    isLoadBalanced = true;
+                }
+            }
+
+            if (victimIt != workers_.cend())
+            {
+                workerWithMaxTasksSizeIt = victimIt;
+            }
+        }
+
         if (!isLoadBalanced)
         {
-            logging_->logDebug("%" PRIu64 " is load balancing tasks between workers (add to %" PRIu32 ", steal from %" PRIu32 ")",
-                               id_, (*workerWithMinMaxTasksSizeIt.first)->getId(), (*workerWithMinMaxTasksSizeIt.second)->getId());
+            LOGGING_DEBUG(logging_, "%" PRIu64 " is load balancing tasks between workers (add to %" PRIu64 ", steal from %" PRIu64 ")",
+                                    id_, (*workerWithMinTasksSizeIt)->getId(), (*workerWithMaxTasksSizeIt)->getId());
 
             // TODO: Add feature for stealing multiple tasks
-            (*workerWithMinMaxTasksSizeIt.first)->addTask((*workerWithMinMaxTasksSizeIt.second)->stealTask());
+            const std::shared_ptr<IThreadPoolTask> stolenTask{ (*workerWithMaxTasksSizeIt)->stealTask() };
+            if (stolenTask != nullptr)
+            {
+                flightRecorder_->record(flightRecorder_->getManagerTrack(), FlightRecorder::EventType::STEAL,
+                                        stolenTask->getId(), (*workerWithMinTasksSizeIt)->getSlot());
+
+                (*workerWithMinTasksSizeIt)->addTask(stolenTask);
+            }
         }
         else
         {
-            logging_->logDebug("%" PRIu64 " is load balanced", id_);
+            LOGGING_DEBUG(logging_, "%" PRIu64 " is load balanced", id_);
         }
     }
 }
 
 
 //! ATTENTION! This method is called with the workersMutex_ locked
-ThreadPool::WorkersContainer::value_type ThreadPool::getAvailableWorker()
+ThreadPool::WorkersContainer::const_iterator ThreadPool::findVictimSharingCache(const WorkersContainer::const_iterator thief, const size_t minVictimTasksSize) const
 {
-    WorkersContainer::value_type availableWorker{};
+    auto victimIt = workers_.cend();
+    size_t maxTasksSize{ 0u };
 
-    if (!workers_.empty())
-    {
-        // Firstly try to find empty and waiting worker
-        const auto emptyWaitingWorkerIt = std::find_if(workers_.cbegin(), workers_.cend(),
-                                            [](const WorkersContainer::value_type & worker)
-                                            {
-                                                return worker->getTasksSize() == 0u && worker->getState() == ThreadPoolWorker::State::WAITING;
-                                            });
+    const int64_t thiefCpu{ (*thief)->getAffinity() };
 
-        if (emptyWaitingWorkerIt != workers_.cend())
+    for (auto workerIt = workers_.cbegin(); workerIt != workers_.cend(); ++workerIt)
+    {
+        if (workerIt == thief || !cpuTopology_.areSharingCache(thiefCpu, (*workerIt)->getAffinity()))
         {
-            availableWorker = std::move(*emptyWaitingWorkerIt);
+            continue;
         }
-        // If there are no empty and waiting worker then check for worker with minimun tasks
-        else
-        {
-            //! std::min_element can't be applied here since it requires strict weak ordering, when the arguments are compared
-            //! each of the elements is running worker(thread) so, there are no guarantee in weak ordering comparison
-
-            static const auto firstHasLessTasksThenSecond =
-                [](const WorkersContainer::value_type & lhsWorker, const WorkersContainer::value_type & rhsWorker)
-                {
-                    return lhsWorker->getTasksSize() < rhsWorker->getTasksSize();
-                };
 
-            auto workerWithMinimumTasks = workers_.cbegin();
+        const size_t tasksSize{ (*workerIt)->getApproximateTasksSize() };
 
-            for (auto workerIt = workers_.cbegin(); workerIt != workers_.cend(); ++workerIt)
-            {
-                if (firstHasLessTasksThenSecond(*workerIt, *workerWithMinimumTasks))
-                {
-                    workerWithMinimumTasks = workerIt;
-                }
-            }
-
-            availableWorker = *workerWithMinimumTasks;
+        if (tasksSize >= minVictimTasksSize && tasksSize > maxTasksSize)
+        {
+            maxTasksSize = tasksSize;
+            victimIt = workerIt;
         }
     }
 
-    return availableWorker;
+    return victimIt;
 }
 
 
-//! ATTENTION! This method is called with the tasksExecutionMonitor_ locked
-std::shared_ptr<IThreadPoolTask> ThreadPool::getTaskForExecution()
+//! ATTENTION! This method is called with the workersMutex_ locked
+ThreadPool::WorkersContainer::const_iterator ThreadPool::findVictimOnNumaNode(const WorkersContainer::const_iterator thief, const size_t minVictimTasksSize) const
 {
-    logging_->logDebug("%" PRIu64 " requested to get task for execution", id_);
-
-    return taskScheduler_->getTaskForExecution();
-}
+    auto victimIt = workers_.cend();
+    size_t maxTasksSize{ 0u };
 
+    const int64_t thiefNumaNode{ getWorkerNumaNode(*thief) };
 
-ITaskScheduler* ThreadPool::getNewTaskScheduler(const ThreadPoolOptions::SchedulerType schedulerType) const
-{
-    switch (schedulerType)
+    for (auto workerIt = workers_.cbegin(); workerIt != workers_.cend(); ++workerIt)
     {
-        case ThreadPoolOptions::SchedulerType::FCFS:        return new FirstComeFirstServedTaskScheduler    { logging_->getNewLoggingInstance("FCFS") };
-        case ThreadPoolOptions::SchedulerType::PRIORITY:    return new PriorityTaskScheduler                { logging_->getNewLoggingInstance("PriorityScheduler") };
-        case ThreadPoolOptions::SchedulerType::SJF:         return new ShortestJobFirstTaskScheduler        { logging_->getNewLoggingInstance("SJF") };
-        default:
-            logging_->logWarning("%" PRIu64 " Undefined scheduler type provided", id_);
-            return nullptr;
+        if (workerIt == thief || getWorkerNumaNode(*workerIt) != thiefNumaNode)
+        {
+            continue;
+        }
+
+        const size_t tasksSize{ (*workerIt)->getApproximateTasksSize() };
+
+        if (tasksSize >= minVictimTasksSize && tasksSize > maxTasksSize)
+        {
+            maxTasksSize = tasksSize;
+            victimIt = workerIt;
+        }
     }
+
+    return victimIt;
 }
 
 
-void ThreadPool::waitFinished(const int64_t timeout)
+//! ATTENTION! This method is called with the workersMutex_ locked
+//! Idle worker of the node is preferred, then the one with minimum estimated work
+ThreadPool::WorkersContainer::value_type ThreadPool::getAvailableWorkerOnNumaNode(const int64_t numaNode)
 {
-    if (options_.needsWaitAllTasksExecutionFinished())
+    WorkersContainer::value_type availableWorker{};
+    uint64_t minimumWork{ 0u };
+
+    for (auto && workerIt : workers_)
     {
-        waitAllTasksExecutionFinished(timeout);
-    }
+        // Same as for not hinted tasks, worker executing long task could keep new task waiting for a long time
+        if (getWorkerNumaNode(workerIt) != numaNode || !canExecute(workerIt, currentTaskForExecution_)
+            || longTaskWorkersSlots_->isSet(workerIt->getSlot()))
+        {
+            continue;
+        }
 
-    threadMustEnd_ = true;
+        if (idleWorkersBitmap_->acquire(workerIt->getSlot()))
+        {
+            return workerIt;
+        }
 
-    // Stops workers execution to avoid waiting during destruction
-    workersMutex_.lock();
-    stopWorkerThreadsExecution();
-    workersMutex_.unlock();
+        const uint64_t work{ workerIt->getApproximateTasksWork() };
 
-    tasksExecutionMonitor_.lock();
-    tasksExecutionMonitor_.notifyAll();
-    tasksExecutionMonitor_.unlock();
+        if (nullptr == availableWorker || work < minimumWork)
+        {
+            minimumWork = work;
+            availableWorker = workerIt;
+        }
+    }
 
-    logging_->logDebug("%" PRIu64 " is waiting manager thread finished...", id_);
+    return availableWorker;
+}
 
-    OSAL::ManagedThread::waitFinished(timeout);
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+int64_t ThreadPool::getWorkerNumaNode(const WorkersContainer::value_type & worker) const
+{
+    const uint32_t slot{ worker->getSlot() };
+
+    return slot < slotToNumaNode_.size() ? slotToNumaNode_[slot] : OSAL::CpuTopology::UNKNOWN_NUMA_NODE;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////////
-///
-/// Private OSAL::ManagedThread methods
-///
-///////////////////////////////////////////////////////////////////////////////////////////////
 
-//! Loop is created in OSAL::ManagedThread
-void ThreadPool::managedRun()
+//! ATTENTION! This method is called with the workersMutex_ locked
+bool ThreadPool::hasNumaNodeTasks(const int64_t numaNode) const
 {
-    if (needsGetNewTaskForExecution_)
+    for (auto && workerIt : workers_)
     {
-        tasksExecutionMonitor_.lock();
+        if (getWorkerNumaNode(workerIt) == numaNode && workerIt->getApproximateTasksSize() != 0u)
+        {
+            return true;
+        }
+    }
 
-        currentTaskForExecution_ = getTaskForExecution();
-        needsGetNewTaskForExecution_ = (nullptr == currentTaskForExecution_);
+    return false;
+}
 
-        areAllTasksPutForExecution_ = needsGetNewTaskForExecution_;
 
-        if (areAllTasksPutForExecution_)
+//! ATTENTION! This method is called with the workersMutex_ locked
+ThreadPool::WorkersContainer::value_type ThreadPool::getAvailableWorker()
+{
+    WorkersContainer::value_type availableWorker{};
+
+    // Blocking task never occupies ordinary worker, if there is a class of blocking workers
+    if (options_.getMaxNumberOfBlockingWorkers() > 0u && currentTaskForExecution_ != nullptr && currentTaskForExecution_->isBlocking())
+    {
+        availableWorker = getAvailableBlockingWorker();
+        if (availableWorker != nullptr)
         {
-            logging_->logDebug("%" PRIu64 " give all tasks for execution", id_);
-            tasksExecutionMonitor_.notifyAll();
+            return availableWorker;
         }
-
-        tasksExecutionMonitor_.unlock();
     }
 
-    // Avoid further proceding if thread must end at this point
-    if (threadMustEnd_)
+    // Task with NUMA node hint is kept on its node, if the node has any worker
+    if (options_.isNumaAware() && currentTaskForExecution_ != nullptr && currentTaskForExecution_->getNumaNode() != IThreadPoolTask::ANY_NUMA_NODE)
     {
-        return;
+        availableWorker = getAvailableWorkerOnNumaNode(currentTaskForExecution_->getNumaNode());
+    }
+
+    if (nullptr == availableWorker && !workers_.empty())
+    {
+        const bool needsSkipReservedWorkers{ numberOfReservedWorkers_ > 0u && !isReservedPriorityTask(currentTaskForExecution_) };
+
+        // Firstly try to find idle worker, workers publish it themselves, so no need to lock each of them
+        const int64_t idleSlot{ needsSkipReservedWorkers ? idleWorkersBitmap_->acquireFirstExcept(*reservedWorkersSlots_)
+                                                         : idleWorkersBitmap_->acquireFirst() };
+
+        if (idleSlot != IdleWorkersBitmap::INVALID_SLOT && slotToWorker_[static_cast<size_t>(idleSlot)] != nullptr)
+        {
+            availableWorker = slotToWorker_[static_cast<size_t>(idleSlot)];
+        }
+        // If there is no idle worker then check for worker with minimum estimated work
+        else
+        {
+            //! Published work of each worker is read once, so comparison is consistent even though workers keep running
+            auto workerWithMinimumWork = workers_.cend();
+            uint64_t minimumWork{ 0u };
+
+            for (auto workerIt = workers_.cbegin(); workerIt != workers_.cend(); ++workerIt)
+            {
+                // Worker executing long task could keep new task waiting for a long time
+                if ((needsSkipReservedWorkers && isReservedWorker(*workerIt)) || longTaskWorkersSlots_->isSet((*workerIt)->getSlot()))
+                {
+                    continue;
+                }
+
+                const uint64_t work{ (*workerIt)->getApproximateTasksWork() };
+
+                if (workerWithMinimumWork == workers_.cend() || work < minimumWork)
+                {
+                    minimumWork = work;
+                    workerWithMinimumWork = workerIt;
+                }
+
+                if (0u == minimumWork)
+                {
+                    break;
+                }
+            }
+
+            if (workerWithMinimumWork != workers_.cend())
+            {
+                availableWorker = *workerWithMinimumWork;
+            }
+            // All allowed workers execute long tasks, so task waits behind one of them, reserved workers are never given lower priority task
+            else
+            {
+                auto allowedWorkerIt = std::find_if(workers_.cbegin(), workers_.cend(),
+                                                    [this](const WorkersContainer::value_type & worker)
+                                                    {
+                                                        return canExecute(worker, currentTaskForExecution_);
+                                                    });
+
+                if (allowedWorkerIt != workers_.cend())
+                {
+                    availableWorker = *allowedWorkerIt;
+                }
+            }
+        }
+    }
+
+    return availableWorker;
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+//! Blocking workers are created on demand, so idle one is preferred, then new one, then the one with minimum work
+ThreadPool::WorkersContainer::value_type ThreadPool::getAvailableBlockingWorker()
+{
+    const int64_t idleSlot{ idleBlockingWorkersBitmap_->acquireFirst() };
+
+    if (idleSlot != IdleWorkersBitmap::INVALID_SLOT && slotToWorker_[static_cast<size_t>(idleSlot)] != nullptr)
+    {
+        return slotToWorker_[static_cast<size_t>(idleSlot)];
+    }
+
+    if (blockingWorkers_.size() < options_.getMaxNumberOfBlockingWorkers() && !freeSlots_.empty())
+    {
+        WorkersContainer::value_type worker{ createWorker(options_.getSchedulerType(), true) };
+
+        if (IThreadPool::State::READY == state_ || Result::OK == worker->create())
+        {
+            if (IThreadPool::State::PAUSED == state_)
+            {
+                worker->pauseExecution();
+            }
+
+            blockingWorkers_.push_back(worker);
+            numberOfBlockingWorkers_.store(static_cast<uint32_t>(blockingWorkers_.size()), std::memory_order_relaxed);
+
+            LOGGING_DEBUG(logging_, "%" PRIu64 " created blocking worker with id %" PRIu64, id_, worker->getId());
+
+            return worker;
+        }
+
+        LOGGING_ERROR(logging_, "%" PRIu64 " can't create blocking worker with id %" PRIu64, id_, worker->getId());
+        releaseWorkerSlot(worker);
+    }
+
+    WorkersContainer::value_type availableWorker{};
+    uint64_t minimumWork{ 0u };
+
+    for (auto && workerIt : blockingWorkers_)
+    {
+        const uint64_t work{ workerIt->getApproximateTasksWork() };
+
+        if (nullptr == availableWorker || work < minimumWork)
+        {
+            minimumWork = work;
+            availableWorker = workerIt;
+        }
+    }
+
+    return availableWorker;
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+//! Idle workers are reserved first, since they have no lower priority tasks in the queue
+void ThreadPool::reserveWorkers()
+{
+    const uint32_t requiredNumberOfReservedWorkers{ options_.getNumberOfReservedWorkers() };
+
+    for (const bool needsIdleWorker : { true, false })
+    {
+        for (auto && workerIt : workers_)
+        {
+            if (numberOfReservedWorkers_ >= requiredNumberOfReservedWorkers)
+            {
+                return;
+            }
+
+            if (!isReservedWorker(workerIt) && (!needsIdleWorker || workerIt->getApproximateTasksSize() == 0u))
+            {
+                reservedWorkersSlots_->set(workerIt->getSlot());
+                ++numberOfReservedWorkers_;
+
+                LOGGING_DEBUG(logging_, "%" PRIu64 " reserved worker with id %" PRIu64, id_, workerIt->getId());
+            }
+        }
+    }
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+bool ThreadPool::isReservedWorker(const WorkersContainer::value_type & worker) const
+{
+    return numberOfReservedWorkers_ > 0u && reservedWorkersSlots_->isSet(worker->getSlot());
+}
+
+
+bool ThreadPool::isReservedPriorityTask(const std::shared_ptr<IThreadPoolTask> & task) const
+{
+    const std::shared_ptr<PriorityTask> priorityTask{ std::dynamic_pointer_cast<PriorityTask>(task) };
+
+    // Lower value means higher priority
+    return priorityTask != nullptr && priorityTask->getPriority() <= options_.getReservedWorkersPriority();
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+bool ThreadPool::canExecute(const WorkersContainer::value_type & worker, const std::shared_ptr<IThreadPoolTask> & task) const
+{
+    return !isReservedWorker(worker) || isReservedPriorityTask(task);
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+void ThreadPool::watchLongTasks()
+{
+    const uint64_t longTaskBudget{ options_.getLongTaskBudget() };
+
+    if (0u == longTaskBudget)
+    {
+        return;
+    }
+
+    const uint64_t currentTime{ OSAL::Time::getCurrentTime() };
+
+    // Rate limit checks, since manager comes here after every added task
+    if (currentTime - lastLongTasksCheckTime_ < autoScalingCheckPeriodInMicroseconds_)
+    {
+        return;
+    }
+
+    lastLongTasksCheckTime_ = currentTime;
+
+    uint32_t numberOfWorkersWithLongTasks{ 0u };
+
+    for (auto && worker : workers_)
+    {
+        const uint32_t slot{ worker->getSlot() };
+        uint64_t taskId{ 0u };
+        uint64_t startTime{ 0u };
+
+        if (!workersStatistic_->getCurrentTask(slot, taskId, startTime) || currentTime < startTime || currentTime - startTime < longTaskBudget)
+        {
+            longTaskWorkersSlots_->reset(slot);
+            continue;
+        }
+
+        longTaskWorkersSlots_->set(slot);
+        ++numberOfWorkersWithLongTasks;
+
+        if (slotToReportedLongTaskStartTime_[slot] == startTime)
+        {
+            continue;
+        }
+
+        slotToReportedLongTaskStartTime_[slot] = startTime;
+        ++totalNumberOfLongTasks_;
+
+        LOGGING_WARNING(logging_, "%" PRIu64 " task %" PRIu64 " is executed by worker %" PRIu64 " for %" PRIu64 " us",
+                                  id_, taskId, worker->getId(), currentTime - startTime);
+
+        if (options_.getLongTaskCallback() != nullptr)
+        {
+            options_.getLongTaskCallback()(taskId, currentTime - startTime);
+        }
+
+        // Tasks queued behind the long one would wait for it, so they are given to other workers
+        if (options_.needsCompensateLongTasks())
+        {
+            longTaskWorkersToRequeue_.push_back(worker);
+        }
+    }
+
+    numberOfWorkersWithLongTasks_ = numberOfWorkersWithLongTasks;
+}
+
+
+//! Tasks are moved under tasksExecutionMonitor_ as addTask schedules them, so waiting for all tasks sees them in the worker or in the queue
+void ThreadPool::requeueTasksOfLongTaskWorkers()
+{
+    if (longTaskWorkersToRequeue_.empty())
+    {
+        return;
+    }
+
+    tasksExecutionMonitor_.lock();
+
+    for (auto && worker : longTaskWorkersToRequeue_)
+    {
+        const auto &removedTasks = worker->removeAllTasks();
+        for (auto && taskIt : removedTasks)
+        {
+            taskScheduler_->schedule(std::move(taskIt));
+            areAllTasksPutForExecution_ = false;
+        }
+
+        LOGGING_DEBUG(logging_, "%" PRIu64 " requeued %" PRIu32 " tasks of worker %" PRIu64 " executing long task",
+                                id_, static_cast<uint32_t>(removedTasks.size()), worker->getId());
+    }
+
+    tasksExecutionMonitor_.notifyAll();
+    tasksExecutionMonitor_.unlock();
+
+    longTaskWorkersToRequeue_.clear();
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+void ThreadPool::compensateBlockedWorkers()
+{
+    if (state_ != IThreadPool::State::RUNNING)
+    {
+        return;
+    }
+
+    const uint32_t numberOfWorkersInBlockingRegion{ workersStatistic_->getNumberOfWorkersInBlockingRegion() };
+
+    // Worker stuck with long task doesn't drain the queue the same way as blocked one
+    const uint32_t numberOfBlockedWorkers{ numberOfWorkersInBlockingRegion
+                                           + (options_.needsCompensateLongTasks() ? numberOfWorkersWithLongTasks_ : 0u) };
+
+    // Unlike BlockingRegion, long tasks are compensated only up to max number of workers
+    const bool canAddCompensationWorker{ numberOfWorkersInBlockingRegion > numberOfCompensationWorkers_
+                                         || workers_.size() < options_.getMaxNumberOfWorkers() };
+
+    if (numberOfBlockedWorkers > numberOfCompensationWorkers_ && numberOfCompensationWorkers_ < options_.getMaxNumberOfWorkers()
+        && canAddCompensationWorker)
+    {
+        // Compensation worker raises the limit by itself, so it's created even if thread pool has max number of workers
+        ++numberOfCompensationWorkers_;
+
+        if (Result::OK == increaseWorkersInternal(1u))
+        {
+            LOGGING_DEBUG(logging_, "%" PRIu64 " added compensation worker for %" PRIu32 " blocked workers", id_, numberOfBlockedWorkers);
+        }
+        else
+        {
+            --numberOfCompensationWorkers_;
+        }
+    }
+    else if (numberOfBlockedWorkers < numberOfCompensationWorkers_)
+    {
+        // Ordinary workers are interchangeable, so any idle one is removed instead of the compensation one
+        auto idleWorkerIt = std::find_if(workers_.begin(), workers_.end(),
+                                         [](const WorkersContainer::value_type & worker)
+                                         {
+                                             return worker->getState() == ThreadPoolWorker::State::WAITING && worker->getApproximateTasksSize() == 0u;
+                                         });
+
+        if (idleWorkerIt != workers_.end())
+        {
+            eraseWorkersAndRescheduleTasks(idleWorkerIt, idleWorkerIt + 1);
+            --numberOfCompensationWorkers_;
+
+            LOGGING_DEBUG(logging_, "%" PRIu64 " removed compensation worker", id_);
+        }
+    }
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+uint32_t ThreadPool::retireIdleBlockingWorkers()
+{
+    const uint64_t keepAliveTime{ options_.getBlockingWorkerKeepAliveTime() };
+
+    auto idleWorkersBeginIt = std::partition(blockingWorkers_.begin(), blockingWorkers_.end(),
+                                        [keepAliveTime](const WorkersContainer::value_type & worker)
+                                        {
+                                            return worker->getState() != ThreadPoolWorker::State::WAITING
+                                                || worker->getApproximateTasksSize() != 0u
+                                                || worker->getWaitingTime() < keepAliveTime;
+                                        });
+
+    const uint32_t numberOfRetiredWorkers{ static_cast<uint32_t>(std::distance(idleWorkersBeginIt, blockingWorkers_.end())) };
+
+    for (auto workerIt = idleWorkersBeginIt; workerIt != blockingWorkers_.end(); ++workerIt)
+    {
+        (*workerIt)->stopExecution();
+        releaseWorkerSlot(*workerIt);
+    }
+
+    blockingWorkers_.erase(idleWorkersBeginIt, blockingWorkers_.end());
+    numberOfBlockingWorkers_.store(static_cast<uint32_t>(blockingWorkers_.size()), std::memory_order_relaxed);
+
+    return numberOfRetiredWorkers;
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+void ThreadPool::autoScale()
+{
+    if (!options_.isWorkersAutoScalingEnabled() || state_ != IThreadPool::State::RUNNING)
+    {
+        return;
+    }
+
+    const uint64_t currentTime{ OSAL::Time::getCurrentTime() };
+
+    // Rate limit checks, since manager comes here after every added task
+    if (currentTime - lastAutoScalingCheckTime_ < autoScalingCheckPeriodInMicroseconds_)
+    {
+        return;
+    }
+
+    lastAutoScalingCheckTime_ = currentTime;
+
+    const bool isCooldownElapsed{ currentTime - lastWorkersScalingTime_ >= options_.getWorkersScalingCooldown() };
+    if (!isCooldownElapsed)
+    {
+        return;
+    }
+
+    const uint64_t oldestTaskAddedTime{ getOldestTaskAddedTime() };
+    const uint64_t queueDelay{ (oldestTaskAddedTime != 0u && currentTime > oldestTaskAddedTime) ? currentTime - oldestTaskAddedTime : 0u };
+    const uint64_t queueDelayToIncrease{ options_.getQueueDelayToIncreaseWorkers() };
+
+    if (queueDelayToIncrease != 0u && queueDelay > queueDelayToIncrease)
+    {
+        if (workers_.size() < options_.getMaxNumberOfWorkers() && Result::OK == increaseWorkersInternal(1u))
+        {
+            LOGGING_DEBUG(logging_, "%" PRIu64 " scaled up workers since queue delay is %" PRIu64, id_, queueDelay);
+
+            ++totalNumberOfScaledUpWorkers_;
+            lastWorkersScalingTime_ = currentTime;
+        }
+    }
+    // Retire only when queue delay is far below the threshold, otherwise workers flap between scaling up and retiring
+    else if (options_.getWorkerKeepAliveTime() != 0u && (queueDelayToIncrease == 0u || queueDelay <= queueDelayToIncrease / 2u))
+    {
+        const uint32_t numberOfRetiredWorkers{ retireIdleWorkers() };
+        if (numberOfRetiredWorkers > 0u)
+        {
+            LOGGING_DEBUG(logging_, "%" PRIu64 " retired %" PRIu32 " idle workers", id_, numberOfRetiredWorkers);
+
+            totalNumberOfRetiredWorkers_ += numberOfRetiredWorkers;
+            lastWorkersScalingTime_ = currentTime;
+        }
+    }
+}
+
+
+//! ATTENTION! This method is called with the tasksExecutionMonitor_ locked
+std::shared_ptr<IThreadPoolTask> ThreadPool::getTaskForExecution()
+{
+    LOGGING_DEBUG(logging_, "%" PRIu64 " requested to get task for execution", id_);
+
+    return taskScheduler_->getTaskForExecution();
+}
+
+
+ITaskScheduler* ThreadPool::getNewTaskScheduler(const ThreadPoolOptions::SchedulerType schedulerType) const
+{
+    switch (schedulerType)
+    {
+        case ThreadPoolOptions::SchedulerType::FCFS:        return new FirstComeFirstServedTaskScheduler    { logging_->getSubInstance("FCFS") };
+        case ThreadPoolOptions::SchedulerType::PRIORITY:    return new PriorityTaskScheduler                { logging_->getSubInstance("PriorityScheduler") };
+        case ThreadPoolOptions::SchedulerType::SJF:         return new ShortestJobFirstTaskScheduler        { logging_->getSubInstance("SJF") };
+        case ThreadPoolOptions::SchedulerType::FAIR_SHARE:  return new FairShareTaskScheduler               { options_.getTenantWeights(), logging_->getSubInstance("FairShare") };
+        default:
+            LOGGING_WARNING(logging_, "%" PRIu64 " Undefined scheduler type provided", id_);
+            return nullptr;
+    }
+}
+
+
+void ThreadPool::waitFinished(const int64_t timeout)
+{
+    if (options_.needsWaitAllTasksExecutionFinished())
+    {
+        waitAllTasksExecutionFinished(timeout);
+    }
+
+    threadMustEnd_ = true;
+
+    if (metricsExportThread_ != nullptr)
+    {
+        metricsExportThread_->stop();
+    }
+
+    // Stops workers execution to avoid waiting during destruction
+    workersMutex_.lock();
+    stopWorkerThreadsExecution();
+    workersMutex_.unlock();
+
+    tasksExecutionMonitor_.lock();
+    tasksExecutionMonitor_.notifyAll();
+    tasksExecutionMonitor_.unlock();
+
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is waiting manager thread finished...", id_);
+
+    OSAL::ManagedThread::waitFinished(timeout);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Private OSAL::ManagedThread methods
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+//! Loop is created in OSAL::ManagedThread
+void ThreadPool::managedRun()
+{
+    if (needsGetNewTaskForExecution_)
+    {
+        tasksExecutionMonitor_.lock();
+
+        currentTaskForExecution_ = getTaskForExecution();
+        needsGetNewTaskForExecution_ = (nullptr == currentTaskForExecution_);
+
+        areAllTasksPutForExecution_ = needsGetNewTaskForExecution_;
+
+        if (areAllTasksPutForExecution_)
+        {
+            LOGGING_DEBUG(logging_, "%" PRIu64 " give all tasks for execution", id_);
+            tasksExecutionMonitor_.notifyAll();
+        }
+
+        tasksExecutionMonitor_.unlock();
+    }
+
+    // Avoid further proceding if thread must end at this point
+    if (threadMustEnd_)
+    {
+        return;
     }
 
     if (currentTaskForExecution_ != nullptr)
@@ -602,25 +1345,45 @@ void ThreadPool::managedRun()
         workersMutex_.lock();
 
         const WorkersContainer::value_type &availableWorker = getAvailableWorker();
+
+        // Only reserved workers are left for the task, so it's kept till any other worker becomes available
+        const bool needsWaitWorkerAvailability{ nullptr == availableWorker && !workers_.empty() };
+
         if (availableWorker != nullptr)
         {
-            logging_->logDebug("%" PRIu64 " manager thread add task %" PRIu64 " to worker %" PRIu64,
-                               id_, currentTaskForExecution_->getId(), availableWorker->getId());
+            LOGGING_DEBUG(logging_, "%" PRIu64 " manager thread add task %" PRIu64 " to worker %" PRIu64,
+                                    id_, currentTaskForExecution_->getId(), availableWorker->getId());
+
+            flightRecorder_->record(flightRecorder_->getManagerTrack(), FlightRecorder::EventType::DISPATCH,
+                                    currentTaskForExecution_->getId(), availableWorker->getSlot());
 
             availableWorker->addTask(std::move(currentTaskForExecution_));
             needsGetNewTaskForExecution_ = true;
         }
 
+        autoScale();
+        watchLongTasks();
+        compensateBlockedWorkers();
+
         workersMutex_.unlock();
+
+        requeueTasksOfLongTaskWorkers();
+
+        if (needsWaitWorkerAvailability && !threadMustEnd_)
+        {
+            tasksExecutionMonitor_.lock();
+            tasksExecutionMonitor_.wait(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_);
+            tasksExecutionMonitor_.unlock();
+        }
     }
     else
     {
-        logging_->logDebug("%" PRIu64 " manager thread is waiting....", id_);
+        LOGGING_DEBUG(logging_, "%" PRIu64 " manager thread is waiting....", id_);
 
         // If we are going to wait for new task for execution but at this moment new task arrives, then skip waiting
         if (needsGetNewTaskForExecution_ && taskScheduler_->getSize() != 0u)
         {
-            logging_->logDebug("%" PRIu64 " manager thread bypass waiting", id_);
+            LOGGING_DEBUG(logging_, "%" PRIu64 " manager thread bypass waiting", id_);
         }
         // Else we don't have either task or available worker, so go for waiting if thread must not end
         else if (!threadMustEnd_)
@@ -630,22 +1393,27 @@ void ThreadPool::managedRun()
             const Result result = tasksExecutionMonitor_.wait(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_);
             tasksExecutionMonitor_.unlock();
 
-            logging_->logDebug("%" PRIu64 " manager thread finish waiting with result %s", id_, resultToStr(result).c_str());
+            LOGGING_DEBUG(logging_, "%" PRIu64 " manager thread finish waiting with result %s", id_, resultToStr(result).c_str());
         }
 
         // If after waiting thread pool must end then we avoid load balancing
         if (!threadMustEnd_)
         {
             workersMutex_.lock();
+            autoScale();
+            watchLongTasks();
+            compensateBlockedWorkers();
             loadBalance();
+
+            if (!blockingWorkers_.empty())
+            {
+                retireIdleBlockingWorkers();
+            }
+
             workersMutex_.unlock();
-        }
-    }
 
-    // Avoid further proceding if thread must end at this point
-    if (threadMustEnd_)
-    {
-        return;
+            requeueTasksOfLongTaskWorkers();
+        }
     }
 }
 
@@ -659,28 +1427,99 @@ void ThreadPool::managedRun()
 ThreadPool::ThreadPool(const ThreadPoolOptions & options, Logging * logging)
     : options_{ options }
     , state_{ IThreadPool::State::READY }
-    , logging_{ logging == nullptr ? new Logging{ "ThreadPool" } : logging }
+    , tasksExecutionMonitor_{ (logging == nullptr ? Logging::getInstance("ThreadPool") : logging)->getSubInstance("TasksExecutionMonitor") }
+    , workersMutex_{ (logging == nullptr ? Logging::getInstance("ThreadPool") : logging)->getSubInstance("WorkersMutex") }
+    , logging_{ logging == nullptr ? Logging::getInstance("ThreadPool") : logging }
+    , numberOfReservedWorkers_{ 0u }
+    , numberOfCompensationWorkers_{ 0u }
+    , numberOfBlockingWorkers_{ 0u }
+    , slotToReportedLongTaskStartTime_{}
+    , numberOfWorkersWithLongTasks_{ 0u }
     , waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_{ 5000000u }
+    , autoScalingCheckPeriodInMicroseconds_{ 1000u }
+    , queueCapacityCheckPeriodInMicroseconds_{ 1000 }
+    , lastAutoScalingCheckTime_{ 0u }
+    , lastWorkersScalingTime_{ 0u }
+    , lastLongTasksCheckTime_{ 0u }
     , currentTaskForExecution_{}
     , needsGetNewTaskForExecution_{ true }
     , areAllTasksPutForExecution_{ true }
-    , tasksExecutionMonitor_{ logging == nullptr ? new Logging{ "ThreadPool(TasksExecutionMonitor)" }
-                                                 : logging->getNewLoggingInstance("TasksExecutionMonitor") }
-    , workersMutex_{ logging == nullptr ? new Logging{ "ThreadPool(WorkersMutex)" }
-                                        : logging->getNewLoggingInstance("WorkersMutex") }
 {
     static std::atomic<uint64_t> id{ 1u };
     id_ = id.load();
     id.fetch_add(1u);
 
+    // Manager must wake up often enough to notice queue delay or idle workers
+    if (options_.getQueueDelayToIncreaseWorkers() != 0u)
+    {
+        waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_ = std::min(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_,
+                                                                            static_cast<int64_t>(std::max(options_.getQueueDelayToIncreaseWorkers(), autoScalingCheckPeriodInMicroseconds_)));
+    }
+
+    if (options_.getMaxNumberOfBlockingWorkers() != 0u)
+    {
+        waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_ = std::min(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_,
+                                                                            static_cast<int64_t>(std::max(options_.getBlockingWorkerKeepAliveTime(), autoScalingCheckPeriodInMicroseconds_)));
+    }
+
+    if (options_.getWorkerKeepAliveTime() != 0u)
+    {
+        waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_ = std::min(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_,
+                                                                            static_cast<int64_t>(std::max(options_.getWorkerKeepAliveTime(), autoScalingCheckPeriodInMicroseconds_)));
+    }
+
+    // Long task is noticed within a quarter of the budget
+    if (options_.getLongTaskBudget() != 0u)
+    {
+        waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_ = std::min(waitForNewTaskOrWorkerAvailabilityTimeoutInMicroseconds_,
+                                                                            static_cast<int64_t>(std::max(options_.getLongTaskBudget() / 4u, autoScalingCheckPeriodInMicroseconds_)));
+    }
+
+    if (options_.getAffinityPolicy() != ThreadPoolOptions::AffinityPolicy::NONE || options_.isNumaAware())
+    {
+        cpuTopology_ = OSAL::CpuTopology::read();
+        affinityCpus_ = getAffinityCpus();
+    }
+
     const ThreadPoolOptions::SchedulerType schedulerType{ options.getSchedulerType() };
     taskScheduler_.reset(getNewTaskScheduler(schedulerType));
 
+    // Ordinary workers, up to the same number of compensation workers and blocking workers share one slots space
+    const uint32_t maxWorkersSize{ 2u * options_.getMaxNumberOfWorkers() + options_.getMaxNumberOfBlockingWorkers() };
+    idleWorkersBitmap_ = std::make_shared<IdleWorkersBitmap>(maxWorkersSize);
+    idleBlockingWorkersBitmap_ = std::make_shared<IdleWorkersBitmap>(maxWorkersSize);
+    reservedWorkersSlots_ = std::make_shared<IdleWorkersBitmap>(maxWorkersSize);
+    longTaskWorkersSlots_ = std::make_shared<IdleWorkersBitmap>(maxWorkersSize);
+    workersStatistic_ = std::make_shared<WorkersStatistic>(maxWorkersSize);
+    flightRecorder_ = std::make_shared<FlightRecorder>(maxWorkersSize, options_.getFlightRecorderCapacity());
+    queuedTasksCounter_ = std::make_shared<IThreadPoolTask::QueuedTasksCounter>(0u);
+    slotToWorker_.resize(maxWorkersSize);
+    slotToReportedLongTaskStartTime_.resize(maxWorkersSize, 0u);
+    slotToNumaNode_.resize(maxWorkersSize, OSAL::CpuTopology::UNKNOWN_NUMA_NODE);
+    affinityCpusUsage_.resize(affinityCpus_.size(), 0u);
+    // Index past the end marks not pinned slot
+    slotToAffinityCpuIndex_.resize(maxWorkersSize, affinityCpus_.size());
+
+    // Reversed order to hand out lower slots first
+    for (uint32_t i = maxWorkersSize; i > 0u; --i)
+    {
+        freeSlots_.push_back(i - 1u);
+    }
+
     const uint32_t workersSize{ options_.getInitialNumberOfWorkers() };
     for (uint32_t i = 0u; i < workersSize; ++i)
     {
-        workers_.emplace_back(
-            new ThreadPoolWorker{ getNewTaskScheduler(schedulerType), tasksExecutionMonitor_, logging_->getNewLoggingInstance("Worker") });
+        workers_.emplace_back(createWorker(schedulerType));
+    }
+
+    reserveWorkers();
+
+    // Slow exporter must not delay the manager thread, so it's called by its own thread
+    if (options_.getMetricsExporter() != nullptr && options_.getMetricsExportPeriod() != 0u)
+    {
+        metricsExportThread_.reset(new MetricsExportThread{ *this, options_.getMetricsExporter(), options_.getMetricsExportPeriod(),
+                                                            logging_->getSubInstance("MetricsExportThread") });
+        metricsExportThread_->create();
     }
 
     if (!options.needsPostponeExecution())
@@ -695,13 +1534,109 @@ ThreadPool::~ThreadPool()
     threadMustEnd_ = true;
 
     waitFinished(-1);
+
+    // Workers are stopped, so trace ends with their last events
+    if (!options_.getTraceFilePath().empty())
+    {
+        dumpTrace(options_.getTraceFilePath());
+    }
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+ThreadPool::WorkersContainer::value_type ThreadPool::createWorker(const ThreadPoolOptions::SchedulerType schedulerType, const bool isBlocking)
+{
+    // tasksExecutionMonitor_ works as free state monitor
+    WorkersContainer::value_type worker{
+        new ThreadPoolWorker{ getNewTaskScheduler(schedulerType), tasksExecutionMonitor_, logging_->getSubInstance("Worker") } };
+
+    //! Number of workers never exceeds max number of workers, so free slot is always available here
+    if (!freeSlots_.empty())
+    {
+        const uint32_t slot{ freeSlots_.back() };
+        freeSlots_.pop_back();
+
+        worker->setBlocking(isBlocking);
+        worker->attach(slot, isBlocking ? idleBlockingWorkersBitmap_ : idleWorkersBitmap_, workersStatistic_, flightRecorder_);
+        slotToWorker_[slot] = worker;
+
+        // Blocking workers mostly wait, so they aren't pinned and leave CPUs to ordinary workers
+        if (!affinityCpus_.empty() && !isBlocking)
+        {
+            // First least used CPU keeps the policy order while every CPU gets a worker
+            const auto leastUsedIt = std::min_element(affinityCpusUsage_.cbegin(), affinityCpusUsage_.cend());
+            const size_t cpuIndex{ static_cast<size_t>(leastUsedIt - affinityCpusUsage_.cbegin()) };
+            const uint32_t cpu{ affinityCpus_[cpuIndex] };
+
+            ++affinityCpusUsage_[cpuIndex];
+            slotToAffinityCpuIndex_[slot] = cpuIndex;
+
+            worker->setAffinity(cpu);
+            slotToNumaNode_[slot] = cpuTopology_.getNumaNode(cpu);
+        }
+    }
+
+    return worker;
+}
+
+
+std::vector<uint32_t> ThreadPool::getAffinityCpus() const
+{
+    switch (options_.getAffinityPolicy())
+    {
+        case ThreadPoolOptions::AffinityPolicy::COMPACT:
+            return cpuTopology_.getCompactOrder();
+        case ThreadPoolOptions::AffinityPolicy::SCATTER:
+            return cpuTopology_.getScatterOrder();
+        case ThreadPoolOptions::AffinityPolicy::PHYSICAL_CORES:
+            return cpuTopology_.getPhysicalCoresOrder();
+        case ThreadPoolOptions::AffinityPolicy::EXPLICIT:
+            return options_.getAffinityCpus();
+        case ThreadPoolOptions::AffinityPolicy::NONE:
+            // NUMA aware workers must stay on their nodes, so they are spread over the nodes
+            return options_.isNumaAware() ? cpuTopology_.getScatterOrder() : std::vector<uint32_t>{};
+        default:
+            return std::vector<uint32_t>{};
+    }
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+void ThreadPool::releaseWorkerSlot(const WorkersContainer::value_type & worker)
+{
+    const uint32_t slot{ worker->getSlot() };
+
+    if (slot < slotToWorker_.size() && slotToWorker_[slot] == worker)
+    {
+        idleWorkersBitmap_->reset(slot);
+        idleBlockingWorkersBitmap_->reset(slot);
+        workersStatistic_->release(slot);
+
+        if (reservedWorkersSlots_->isSet(slot))
+        {
+            reservedWorkersSlots_->reset(slot);
+            --numberOfReservedWorkers_;
+        }
+
+        if (slotToAffinityCpuIndex_[slot] < affinityCpusUsage_.size())
+        {
+            --affinityCpusUsage_[slotToAffinityCpuIndex_[slot]];
+            slotToAffinityCpuIndex_[slot] = affinityCpusUsage_.size();
+        }
+
+        longTaskWorkersSlots_->reset(slot);
+        slotToReportedLongTaskStartTime_[slot] = 0u;
+        slotToNumaNode_[slot] = OSAL::CpuTopology::UNKNOWN_NUMA_NODE;
+        slotToWorker_[slot].reset();
+        freeSlots_.push_back(slot);
+    }
 }
 
 
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::createManagingThread()
 {
-    logging_->logDebug("%" PRIu64 " is requested to create managing thread", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to create managing thread", id_);
 
     Result result{ Result::ERROR };
 
@@ -714,7 +1649,7 @@ Result ThreadPool::createManagingThread()
         }
         else
         {
-            logging_->logError("%" PRIu64 " can't create thread for managing workers and tasks", id_);
+            LOGGING_ERROR(logging_, "%" PRIu64 " can't create thread for managing workers and tasks", id_);
         }
     }
 
@@ -725,19 +1660,22 @@ Result ThreadPool::createManagingThread()
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::createWorkerThreads()
 {
-    logging_->logDebug("%" PRIu64 " is requested to create worker threads", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to create worker threads", id_);
 
     Result result{ Result::OK };
 
-    for (auto && workerIt: workers_)
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
     {
-        if (workerIt->getState() == ThreadPoolWorker::State::READY)
+        for (auto && workerIt : *workersIt)
         {
-            const Result createResult{ workerIt->create() };
-            if (createResult != Result::OK)
+            if (workerIt->getState() == ThreadPoolWorker::State::READY)
             {
-                logging_->logError("%" PRIu64 " can't create worker with id %" PRIu64, id_, workerIt->getId());
-                result = createResult;
+                const Result createResult{ workerIt->create() };
+                if (createResult != Result::OK)
+                {
+                    LOGGING_ERROR(logging_, "%" PRIu64 " can't create worker with id %" PRIu64, id_, workerIt->getId());
+                    result = createResult;
+                }
             }
         }
     }
@@ -749,13 +1687,16 @@ Result ThreadPool::createWorkerThreads()
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::stopWorkerThreadsExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to stop worker threads execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to stop worker threads execution", id_);
 
     Result result{ Result::OK };
 
-    for (auto && workerIt: workers_)
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
     {
-        result += workerIt->stopExecution();
+        for (auto && workerIt : *workersIt)
+        {
+            result += workerIt->stopExecution();
+        }
     }
 
     return result;
@@ -765,13 +1706,16 @@ Result ThreadPool::stopWorkerThreadsExecution()
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::pauseWorkerThreadsExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to pause worker threads execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to pause worker threads execution", id_);
 
     Result result{ Result::OK };
 
-    for (auto && workerIt: workers_)
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
     {
-        result += workerIt->pauseExecution();
+        for (auto && workerIt : *workersIt)
+        {
+            result += workerIt->pauseExecution();
+        }
     }
 
     return result;
@@ -781,13 +1725,16 @@ Result ThreadPool::pauseWorkerThreadsExecution()
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::resumeWorkerThreadsExecution()
 {
-    logging_->logDebug("%" PRIu64 " is requested to resume worker threads execution", id_);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to resume worker threads execution", id_);
 
     Result result{ Result::OK };
 
-    for (auto && workerIt: workers_)
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
     {
-        result += workerIt->resumeExecution();
+        for (auto && workerIt : *workersIt)
+        {
+            result += workerIt->resumeExecution();
+        }
     }
 
     return result;
@@ -807,21 +1754,30 @@ void ThreadPool::eraseWorkersAndRescheduleTasks(const WorkersContainer::iterator
                 taskScheduler_->schedule(std::move(taskIt));
             }
         }
+        // Tasks of the erased worker are dropped
+        else
+        {
+            releaseQueuedTasks((*workerIt)->removeAllTasks());
+        }
 
         // Stop execution to successfully erase worker
         (*workerIt)->stopExecution();
+        releaseWorkerSlot(*workerIt);
 
-        logging_->logDebug("%" PRIu64 " marked for erase worker with id %" PRIu64, id_, (*workerIt)->getId());
+        LOGGING_DEBUG(logging_, "%" PRIu64 " marked for erase worker with id %" PRIu64, id_, (*workerIt)->getId());
     }
 
     workers_.erase(begin, end);
+
+    // Keep number of reserved workers, if reserved ones were erased
+    reserveWorkers();
 }
 
 
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::increaseWorkersInternal(const uint32_t number)
 {
-    logging_->logDebug("%" PRIu64 " is requested to increase workers by %" PRIu32, id_, number);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to increase workers by %" PRIu32, id_, number);
 
     Result result{ Result::ERROR };
 
@@ -832,11 +1788,11 @@ Result ThreadPool::increaseWorkersInternal(const uint32_t number)
         const ThreadPoolOptions::SchedulerType schedulerType{ options_.getSchedulerType() };
         for (uint32_t i = 0u; i < numberOfIncrease; ++i)
         {
-            // tasksExecutionMonitor_ works as free state monitor
-            workers_.emplace_back(
-                new ThreadPoolWorker{ getNewTaskScheduler(schedulerType), tasksExecutionMonitor_, logging_->getNewLoggingInstance("Worker") });
+            workers_.emplace_back(createWorker(schedulerType));
         }
 
+        reserveWorkers();
+
         switch (state_)
         {
             case IThreadPool::State::READY:
@@ -853,11 +1809,11 @@ Result ThreadPool::increaseWorkersInternal(const uint32_t number)
                 break;
         }
 
-        logging_->logDebug("%" PRIu64 " increased workers by %" PRIu32, id_, numberOfIncrease);
+        LOGGING_DEBUG(logging_, "%" PRIu64 " increased workers by %" PRIu32, id_, numberOfIncrease);
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " can't increase workers by %" PRIu32, id_, number);
+        LOGGING_WARNING(logging_, "%" PRIu64 " can't increase workers by %" PRIu32, id_, number);
     }
 
     return result;
@@ -867,7 +1823,7 @@ Result ThreadPool::increaseWorkersInternal(const uint32_t number)
 //! ATTENTION! This method is called with the workersMutex_ locked
 Result ThreadPool::decreaseWorkersInternal(const uint32_t number, const bool needsRescheduleTasks)
 {
-    logging_->logDebug("%" PRIu64 " is requested to decrease workers by %" PRIu32, id_, number);
+    LOGGING_DEBUG(logging_, "%" PRIu64 " is requested to decrease workers by %" PRIu32, id_, number);
 
     Result result{ Result::ERROR };
 
@@ -888,14 +1844,14 @@ Result ThreadPool::decreaseWorkersInternal(const uint32_t number, const bool nee
             const uint32_t numberOfEmptyWorkers{ static_cast<uint32_t>(std::distance(emptyWorkersBeginIt, workers_.end())) };
             if (numberOfEmptyWorkers > numberOfDecrease)
             {
-                logging_->logDebug("%" PRIu64 " remove %" PRIu32 " empty workers", id_, numberOfDecrease);
+                LOGGING_DEBUG(logging_, "%" PRIu64 " remove %" PRIu32 " empty workers", id_, numberOfDecrease);
 
                 eraseWorkersAndRescheduleTasks(emptyWorkersBeginIt, emptyWorkersBeginIt + numberOfDecrease, needsRescheduleTasks);
                 numberOfDecrease = 0u;
             }
             else
             {
-                logging_->logDebug("%" PRIu64 " remove %" PRIu32 " empty workers", id_, numberOfEmptyWorkers);
+                LOGGING_DEBUG(logging_, "%" PRIu64 " remove %" PRIu32 " empty workers", id_, numberOfEmptyWorkers);
 
                 eraseWorkersAndRescheduleTasks(emptyWorkersBeginIt, workers_.end(), needsRescheduleTasks);
                 numberOfDecrease -= numberOfEmptyWorkers;
@@ -907,7 +1863,7 @@ Result ThreadPool::decreaseWorkersInternal(const uint32_t number, const bool nee
         // If after removing empty workers we still have to decrease workers, remove other workers
         if (numberOfDecrease > 0u)
         {
-            logging_->logDebug("%" PRIu64 " remove %" PRIu32 " non empty workers", id_, numberOfDecrease);
+            LOGGING_DEBUG(logging_, "%" PRIu64 " remove %" PRIu32 " non empty workers", id_, numberOfDecrease);
 
             //! It's secure to do workers_.begin() + numberOfDecrease because we have check at the beginning of method
             eraseWorkersAndRescheduleTasks(workers_.begin(), workers_.begin() + numberOfDecrease, needsRescheduleTasks);
@@ -917,7 +1873,7 @@ Result ThreadPool::decreaseWorkersInternal(const uint32_t number, const bool nee
     }
     else
     {
-        logging_->logWarning("%" PRIu64 " can't decrease workers by %" PRIu32, id_, number);
+        LOGGING_WARNING(logging_, "%" PRIu64 " can't decrease workers by %" PRIu32, id_, number);
     }
 
     return result;
@@ -928,7 +1884,7 @@ Result ThreadPool::decreaseWorkersInternal(const uint32_t number, const bool nee
 uint32_t ThreadPool::getNumberOfWorkersToIncrease(const uint32_t initialNumber) const
 {
     const uint32_t currentNumberOfWorkers   { static_cast<uint32_t>(workers_.size()) };
-    const uint32_t maxNumberOfWorkers       { options_.getMaxNumberOfWorkers() };
+    const uint32_t maxNumberOfWorkers       { options_.getMaxNumberOfWorkers() + numberOfCompensationWorkers_ };
 
     uint32_t numberOfIncrease{ initialNumber };
 
@@ -958,17 +1914,229 @@ uint32_t ThreadPool::getNumberOfWorkersToDecrease(const uint32_t initialNumber)
 }
 
 
+//! ATTENTION! This method is called with the workersMutex_ locked
+uint64_t ThreadPool::getOldestTaskAddedTime() const
+{
+    uint64_t oldestTaskAddedTime{ taskScheduler_->getApproximateOldestTaskAddedTime() };
+
+    for (auto && workerIt : workers_)
+    {
+        const uint64_t addedTime{ workerIt->getApproximateOldestTaskAddedTime() };
+
+        if (addedTime != 0u && (0u == oldestTaskAddedTime || addedTime < oldestTaskAddedTime))
+        {
+            oldestTaskAddedTime = addedTime;
+        }
+    }
+
+    return oldestTaskAddedTime;
+}
+
+
+//! ATTENTION! This method is called with the workersMutex_ locked
+uint32_t ThreadPool::retireIdleWorkers()
+{
+    const uint64_t keepAliveTime{ options_.getWorkerKeepAliveTime() };
+
+    // Partition workers in a 2 groups: needed and idle longer than keep alive time
+    auto idleWorkersBeginIt = std::partition(workers_.begin(), workers_.end(),
+                                        [keepAliveTime](const WorkersContainer::value_type & worker)
+                                        {
+                                            return worker->getState() != ThreadPoolWorker::State::WAITING
+                                                || worker->getApproximateTasksSize() != 0u
+                                                || worker->getWaitingTime() < keepAliveTime;
+                                        });
+
+    const uint32_t numberOfIdleWorkers{ static_cast<uint32_t>(std::distance(idleWorkersBeginIt, workers_.end())) };
+    const uint32_t numberOfRetiredWorkers{ getNumberOfWorkersToDecrease(numberOfIdleWorkers) };
+
+    if (numberOfRetiredWorkers > 0u)
+    {
+        eraseWorkersAndRescheduleTasks(idleWorkersBeginIt, idleWorkersBeginIt + numberOfRetiredWorkers);
+    }
+
+    return numberOfRetiredWorkers;
+}
+
+
 //! ATTENTION! This method is called with the workersMutex_ locked
 size_t ThreadPool::getTasksSizeFromAllWorkers() const
 {
     size_t tasksSize{ 0u };
 
     // Suppressing cppcheck warning suggesting usage of std::accumulate due to performance
-    for (auto && workerIt : workers_)
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
     {
-        // cppcheck-suppress useStlAlgorithm
-        tasksSize += workerIt->getTasksSize();
+        for (auto && workerIt : *workersIt)
+        {
+            // cppcheck-suppress useStlAlgorithm
+            tasksSize += workerIt->getTasksSize();
+        }
     }
 
     return tasksSize;
 }
+
+
+//! Queue capacity is reserved without holding workersMutex_ or tasksExecutionMonitor_, since the producer could wait for it
+bool ThreadPool::admitTask(const std::shared_ptr<IThreadPoolTask> & task, Result & result)
+{
+    const size_t queueCapacity{ options_.getQueueCapacity() };
+
+    if (0u == queueCapacity)
+    {
+        return true;
+    }
+
+    bool isAdmitted{ reserveQueueCapacity(queueCapacity) };
+
+    if (!isAdmitted)
+    {
+        switch (options_.getQueueOverflowPolicy())
+        {
+            case ThreadPoolOptions::QueueOverflowPolicy::BLOCK:
+            {
+                OSAL::Timeout waitTimeout{ options_.getQueueBlockTimeout() };
+                int64_t remainingTime{ waitTimeout.getRemainingTime() };
+
+                // Workers don't notify about every task they take, so free capacity is checked periodically
+                while (!isAdmitted && remainingTime != 0 && !threadMustEnd_)
+                {
+                    tasksExecutionMonitor_.lock();
+                    tasksExecutionMonitor_.wait(remainingTime < 0 ? queueCapacityCheckPeriodInMicroseconds_
+                                                                  : std::min(remainingTime, queueCapacityCheckPeriodInMicroseconds_));
+                    tasksExecutionMonitor_.unlock();
+
+                    isAdmitted = reserveQueueCapacity(queueCapacity);
+                    remainingTime = waitTimeout.getRemainingTime();
+                }
+
+                result = isAdmitted ? Result::OK : Result::TIMEOUT;
+                break;
+            }
+
+            case ThreadPoolOptions::QueueOverflowPolicy::CALLER_RUNS:
+                result = task->execute();
+                ++totalNumberOfCallerRunsTasks_;
+
+                LOGGING_DEBUG(logging_, "%" PRIu64 " queue is full, task %" PRIu64 " is executed by the caller", id_, task->getId());
+                return false;
+
+            case ThreadPoolOptions::QueueOverflowPolicy::DROP_OLDEST:
+            {
+                // Canceled task gives its place back, but concurrent producer could take it first or dropped task
+                // could have no place (e.g. added by addTaskToEveryWorker), then the next oldest task is dropped
+                bool hasDroppedTask{ true };
+
+                while (!isAdmitted && hasDroppedTask)
+                {
+                    const std::shared_ptr<IThreadPoolTask> droppedTask{ removeOldestTask() };
+                    hasDroppedTask = droppedTask != nullptr;
+
+                    if (hasDroppedTask)
+                    {
+                        droppedTask->cancel();
+                        ++totalNumberOfRejectedTasks_;
+
+                        LOGGING_DEBUG(logging_, "%" PRIu64 " queue is full, drop the oldest task %" PRIu64, id_, droppedTask->getId());
+                    }
+
+                    // Nothing to drop means the queue was drained meanwhile or places are taken by tasks not queued yet
+                    isAdmitted = reserveQueueCapacity(queueCapacity);
+                }
+
+                result = isAdmitted ? Result::OK : Result::ERROR;
+                break;
+            }
+
+            case ThreadPoolOptions::QueueOverflowPolicy::REJECT:
+            default:
+                result = Result::ERROR;
+                break;
+        }
+    }
+
+    if (isAdmitted)
+    {
+        // Task, which isn't submitted or is already queued, doesn't take the place
+        if (!task->attachQueuedTasksCounter(queuedTasksCounter_))
+        {
+            queuedTasksCounter_->fetch_sub(1u);
+        }
+    }
+    else
+    {
+        ++totalNumberOfRejectedTasks_;
+
+        LOGGING_DEBUG(logging_, "%" PRIu64 " queue is full, task %" PRIu64 " is rejected by %s policy", id_, task->getId(),
+                                ThreadPoolOptions::queueOverflowPolicyToString(options_.getQueueOverflowPolicy()).c_str());
+    }
+
+    return isAdmitted;
+}
+
+
+void ThreadPool::releaseQueuedTasks(const std::vector<std::shared_ptr<IThreadPoolTask>> & tasks)
+{
+    for (auto && taskIt : tasks)
+    {
+        taskIt->detachQueuedTasksCounter(queuedTasksCounter_);
+    }
+}
+
+
+//! Concurrent producers reserve places one by one, so the queue never exceeds its capacity
+bool ThreadPool::reserveQueueCapacity(const size_t queueCapacity)
+{
+    size_t queuedTasksSize{ queuedTasksCounter_->load(std::memory_order_relaxed) };
+
+    while (queuedTasksSize < queueCapacity)
+    {
+        if (queuedTasksCounter_->compare_exchange_weak(queuedTasksSize, queuedTasksSize + 1u, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+std::shared_ptr<IThreadPoolTask> ThreadPool::removeOldestTask()
+{
+    std::shared_ptr<IThreadPoolTask> removedTask{};
+
+    workersMutex_.lock();
+
+    // The oldest task is looked up in the thread pool queue and in every worker queue
+    WorkersContainer::value_type oldestWorker{};
+    uint64_t oldestTaskAddedTime{ taskScheduler_->getApproximateOldestTaskAddedTime() };
+
+    for (auto && workersIt : { &workers_, &blockingWorkers_ })
+    {
+        for (auto && workerIt : *workersIt)
+        {
+            const uint64_t addedTime{ workerIt->getApproximateOldestTaskAddedTime() };
+
+            if (addedTime != 0u && (0u == oldestTaskAddedTime || addedTime < oldestTaskAddedTime))
+            {
+                oldestTaskAddedTime = addedTime;
+                oldestWorker = workerIt;
+            }
+        }
+    }
+
+    if (oldestWorker != nullptr)
+    {
+        removedTask = oldestWorker->removeOldestTask();
+    }
+
+    workersMutex_.unlock();
+
+    if (nullptr == removedTask)
+    {
+        removedTask = taskScheduler_->unscheduleOldest();
+    }
+
+    return removedTask;
+}
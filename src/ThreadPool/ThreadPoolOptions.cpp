@@ -10,6 +10,27 @@ ThreadPoolOptions::ThreadPoolOptions(const SchedulerType schedulerType,
     , initialNumberOfWorkers_{ initialNumberOfWorkers }
     , needsPostponeExecution_{ needsPostponeExecution }
     , needsWaitAllTasksExecutionFinished_{ needsWaitAllTasksExecutionFinished }
+    , queueDelayToIncreaseWorkersInMicroseconds_{ 0u }
+    , workerKeepAliveTimeInMicroseconds_{ 0u }
+    , workersScalingCooldownInMicroseconds_{ 1000000u }
+    , affinityPolicy_{ AffinityPolicy::NONE }
+    , affinityCpus_{}
+    , isNumaAware_{ false }
+    , maxNumberOfBlockingWorkers_{ 0u }
+    , blockingWorkerKeepAliveTimeInMicroseconds_{ 10000000u }
+    , numberOfReservedWorkers_{ 0u }
+    , reservedWorkersPriority_{ Priority::HIGH }
+    , tenantWeights_{}
+    , queueCapacity_{ 0u }
+    , queueOverflowPolicy_{ QueueOverflowPolicy::BLOCK }
+    , queueBlockTimeoutInMicroseconds_{ -1 }
+    , flightRecorderCapacity_{ 1024u }
+    , traceFilePath_{}
+    , metricsExporter_{}
+    , metricsExportPeriodInMicroseconds_{ 1000000u }
+    , longTaskBudgetInMicroseconds_{ 0u }
+    , longTaskCallback_{}
+    , needsCompensateLongTasks_{ false }
 {
     // Set min number of workers.
     setMinNumberOfWorkers(minNumberOfWorkers);
@@ -122,11 +143,276 @@ void ThreadPoolOptions::setWaitAllTasksExecutionFinished(const bool needsWaitAll
 }
 
 
+uint64_t ThreadPoolOptions::getQueueDelayToIncreaseWorkers() const
+{
+    return queueDelayToIncreaseWorkersInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setQueueDelayToIncreaseWorkers(const uint64_t delayInMicroseconds)
+{
+    queueDelayToIncreaseWorkersInMicroseconds_ = delayInMicroseconds;
+}
+
+
+uint64_t ThreadPoolOptions::getWorkerKeepAliveTime() const
+{
+    return workerKeepAliveTimeInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setWorkerKeepAliveTime(const uint64_t timeInMicroseconds)
+{
+    workerKeepAliveTimeInMicroseconds_ = timeInMicroseconds;
+}
+
+
+uint64_t ThreadPoolOptions::getWorkersScalingCooldown() const
+{
+    return workersScalingCooldownInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setWorkersScalingCooldown(const uint64_t timeInMicroseconds)
+{
+    workersScalingCooldownInMicroseconds_ = timeInMicroseconds;
+}
+
+
+bool ThreadPoolOptions::isWorkersAutoScalingEnabled() const
+{
+    return queueDelayToIncreaseWorkersInMicroseconds_ != 0u || workerKeepAliveTimeInMicroseconds_ != 0u;
+}
+
+
+ThreadPoolOptions::AffinityPolicy ThreadPoolOptions::getAffinityPolicy() const
+{
+    return affinityPolicy_;
+}
+
+
+void ThreadPoolOptions::setAffinityPolicy(const AffinityPolicy affinityPolicy)
+{
+    affinityPolicy_ = affinityPolicy;
+}
+
+
+const std::vector<uint32_t> & ThreadPoolOptions::getAffinityCpus() const
+{
+    return affinityCpus_;
+}
+
+
+void ThreadPoolOptions::setAffinityCpus(const std::vector<uint32_t> & cpus)
+{
+    affinityCpus_ = cpus;
+
+    if (!affinityCpus_.empty())
+    {
+        affinityPolicy_ = AffinityPolicy::EXPLICIT;
+    }
+}
+
+
+bool ThreadPoolOptions::isNumaAware() const
+{
+    return isNumaAware_;
+}
+
+
+void ThreadPoolOptions::setNumaAware(const bool isNumaAware)
+{
+    isNumaAware_ = isNumaAware;
+}
+
+
+uint32_t ThreadPoolOptions::getMaxNumberOfBlockingWorkers() const
+{
+    return maxNumberOfBlockingWorkers_;
+}
+
+
+void ThreadPoolOptions::setMaxNumberOfBlockingWorkers(const uint32_t value)
+{
+    maxNumberOfBlockingWorkers_ = value;
+}
+
+
+uint64_t ThreadPoolOptions::getBlockingWorkerKeepAliveTime() const
+{
+    return blockingWorkerKeepAliveTimeInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setBlockingWorkerKeepAliveTime(const uint64_t timeInMicroseconds)
+{
+    blockingWorkerKeepAliveTimeInMicroseconds_ = timeInMicroseconds;
+}
+
+
+uint32_t ThreadPoolOptions::getNumberOfReservedWorkers() const
+{
+    return numberOfReservedWorkers_;
+}
+
+
+Priority ThreadPoolOptions::getReservedWorkersPriority() const
+{
+    return reservedWorkersPriority_;
+}
+
+
+void ThreadPoolOptions::setReservedWorkers(const uint32_t numberOfReservedWorkers, const Priority priority)
+{
+    numberOfReservedWorkers_ = numberOfReservedWorkers;
+    reservedWorkersPriority_ = priority;
+}
+
+
+const std::map<std::string, uint32_t> & ThreadPoolOptions::getTenantWeights() const
+{
+    return tenantWeights_;
+}
+
+
+void ThreadPoolOptions::setTenantWeight(const std::string & tenant, const uint32_t weight)
+{
+    tenantWeights_[tenant] = weight;
+}
+
+
+uint32_t ThreadPoolOptions::getQueueCapacity() const
+{
+    return queueCapacity_;
+}
+
+
+ThreadPoolOptions::QueueOverflowPolicy ThreadPoolOptions::getQueueOverflowPolicy() const
+{
+    return queueOverflowPolicy_;
+}
+
+
+void ThreadPoolOptions::setQueueCapacity(const uint32_t capacity, const QueueOverflowPolicy queueOverflowPolicy)
+{
+    queueCapacity_ = capacity;
+    queueOverflowPolicy_ = queueOverflowPolicy;
+}
+
+
+int64_t ThreadPoolOptions::getQueueBlockTimeout() const
+{
+    return queueBlockTimeoutInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setQueueBlockTimeout(const int64_t timeoutInMicroseconds)
+{
+    queueBlockTimeoutInMicroseconds_ = timeoutInMicroseconds;
+}
+
+
+uint32_t ThreadPoolOptions::getFlightRecorderCapacity() const
+{
+    return flightRecorderCapacity_;
+}
+
+
+void ThreadPoolOptions::setFlightRecorderCapacity(const uint32_t numberOfEvents)
+{
+    flightRecorderCapacity_ = numberOfEvents;
+}
+
+
+const std::string & ThreadPoolOptions::getTraceFilePath() const
+{
+    return traceFilePath_;
+}
+
+
+void ThreadPoolOptions::setTraceFilePath(const std::string & traceFilePath)
+{
+    traceFilePath_ = traceFilePath;
+}
+
+
+const std::shared_ptr<IMetricsExporter> & ThreadPoolOptions::getMetricsExporter() const
+{
+    return metricsExporter_;
+}
+
+
+uint64_t ThreadPoolOptions::getMetricsExportPeriod() const
+{
+    return metricsExportPeriodInMicroseconds_;
+}
+
+
+void ThreadPoolOptions::setMetricsExporter(const std::shared_ptr<IMetricsExporter> & metricsExporter, const uint64_t periodInMicroseconds)
+{
+    metricsExporter_ = metricsExporter;
+    metricsExportPeriodInMicroseconds_ = periodInMicroseconds;
+}
+
+
+uint64_t ThreadPoolOptions::getLongTaskBudget() const
+{
+    return longTaskBudgetInMicroseconds_;
+}
+
+
+const ThreadPoolOptions::LongTaskCallback & ThreadPoolOptions::getLongTaskCallback() const
+{
+    return longTaskCallback_;
+}
+
+
+bool ThreadPoolOptions::needsCompensateLongTasks() const
+{
+    return needsCompensateLongTasks_;
+}
+
+
+void ThreadPoolOptions::setLongTaskWatchdog(const uint64_t budgetInMicroseconds, const LongTaskCallback & longTaskCallback,
+                                            const bool needsCompensateLongTasks)
+{
+    longTaskBudgetInMicroseconds_ = budgetInMicroseconds;
+    longTaskCallback_ = longTaskCallback;
+    needsCompensateLongTasks_ = needsCompensateLongTasks;
+}
+
+
 std::string ThreadPoolOptions::toString() const
 {
+    std::string tenantWeights;
+    for (auto && tenantWeightIt : tenantWeights_)
+    {
+        tenantWeights += (tenantWeights.empty() ? "" : ", ") + tenantWeightIt.first + "=" + std::to_string(tenantWeightIt.second);
+    }
+
     return "Scheduler type: "                   + ThreadPoolOptions::schedulerTypeToString(schedulerType_)
          + "\nInitial number of workers : "     + std::to_string(initialNumberOfWorkers_)
          + "\nMin number of workers : "         + std::to_string(minNumberOfWorkers_)
          + "\nMax number of workers : "         + std::to_string(maxNumberOfWorkers_)
-         + "\nNeeds to postpone execution : "   + (needsPostponeExecution_ ? "true" : "false");
+         + "\nNeeds to postpone execution : "   + (needsPostponeExecution_ ? "true" : "false")
+         + "\nQueue delay to increase workers : " + std::to_string(queueDelayToIncreaseWorkersInMicroseconds_)
+         + "\nWorker keep alive time : "        + std::to_string(workerKeepAliveTimeInMicroseconds_)
+         + "\nWorkers scaling cooldown : "      + std::to_string(workersScalingCooldownInMicroseconds_)
+         + "\nAffinity policy : "               + ThreadPoolOptions::affinityPolicyToString(affinityPolicy_)
+         + "\nIs NUMA aware : "                 + (isNumaAware_ ? "true" : "false")
+         + "\nMax number of blocking workers : " + std::to_string(maxNumberOfBlockingWorkers_)
+         + "\nBlocking worker keep alive time : " + std::to_string(blockingWorkerKeepAliveTimeInMicroseconds_)
+         + "\nNumber of reserved workers : "    + std::to_string(numberOfReservedWorkers_)
+         + "\nReserved workers priority : "     + std::to_string(static_cast<uint32_t>(reservedWorkersPriority_))
+         + "\nTenant weights : "                + tenantWeights
+         + "\nQueue capacity : "                + std::to_string(queueCapacity_)
+         + "\nQueue overflow policy : "         + ThreadPoolOptions::queueOverflowPolicyToString(queueOverflowPolicy_)
+         + "\nQueue block timeout : "           + std::to_string(queueBlockTimeoutInMicroseconds_)
+         + "\nFlight recorder capacity : "      + std::to_string(flightRecorderCapacity_)
+         + "\nTrace file path : "               + traceFilePath_
+         + "\nMetrics exporter : "              + (metricsExporter_ != nullptr ? "set" : "not set")
+         + "\nMetrics export period : "         + std::to_string(metricsExportPeriodInMicroseconds_)
+         + "\nLong task budget : "              + std::to_string(longTaskBudgetInMicroseconds_)
+         + "\nLong task callback : "            + (longTaskCallback_ != nullptr ? "set" : "not set")
+         + "\nNeeds to compensate long tasks : " + (needsCompensateLongTasks_ ? "true" : "false");
 }
\ No newline at end of file
@@ -42,6 +42,121 @@ ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setWaitAllTasksExecutionFin
 }
 
 
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setQueueDelayToIncreaseWorkers(const uint64_t delayInMicroseconds)
+{
+    options_.setQueueDelayToIncreaseWorkers(delayInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setWorkerKeepAliveTime(const uint64_t timeInMicroseconds)
+{
+    options_.setWorkerKeepAliveTime(timeInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setWorkersScalingCooldown(const uint64_t timeInMicroseconds)
+{
+    options_.setWorkersScalingCooldown(timeInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setAffinityPolicy(const ThreadPoolOptions::AffinityPolicy affinityPolicy)
+{
+    options_.setAffinityPolicy(affinityPolicy);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setAffinityCpus(const std::vector<uint32_t> & cpus)
+{
+    options_.setAffinityCpus(cpus);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setNumaAware(const bool isNumaAware)
+{
+    options_.setNumaAware(isNumaAware);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setMaxNumberOfBlockingWorkers(const uint32_t maxNumberOfBlockingWorkers)
+{
+    options_.setMaxNumberOfBlockingWorkers(maxNumberOfBlockingWorkers);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setBlockingWorkerKeepAliveTime(const uint64_t timeInMicroseconds)
+{
+    options_.setBlockingWorkerKeepAliveTime(timeInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setReservedWorkers(const uint32_t numberOfReservedWorkers, const Priority priority)
+{
+    options_.setReservedWorkers(numberOfReservedWorkers, priority);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setTenantWeight(const std::string & tenant, const uint32_t weight)
+{
+    options_.setTenantWeight(tenant, weight);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setQueueCapacity(const uint32_t capacity, const ThreadPoolOptions::QueueOverflowPolicy queueOverflowPolicy)
+{
+    options_.setQueueCapacity(capacity, queueOverflowPolicy);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setQueueBlockTimeout(const int64_t timeoutInMicroseconds)
+{
+    options_.setQueueBlockTimeout(timeoutInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setFlightRecorderCapacity(const uint32_t numberOfEvents)
+{
+    options_.setFlightRecorderCapacity(numberOfEvents);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setTraceFilePath(const std::string & traceFilePath)
+{
+    options_.setTraceFilePath(traceFilePath);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setMetricsExporter(const std::shared_ptr<IMetricsExporter> & metricsExporter,
+                                                                        const uint64_t periodInMicroseconds)
+{
+    options_.setMetricsExporter(metricsExporter, periodInMicroseconds);
+    return *this;
+}
+
+
+ThreadPoolOptionsBuilder & ThreadPoolOptionsBuilder::setLongTaskWatchdog(const uint64_t budgetInMicroseconds,
+                                                                         const ThreadPoolOptions::LongTaskCallback & longTaskCallback,
+                                                                         const bool needsCompensateLongTasks)
+{
+    options_.setLongTaskWatchdog(budgetInMicroseconds, longTaskCallback, needsCompensateLongTasks);
+    return *this;
+}
+
+
 ThreadPoolOptions ThreadPoolOptionsBuilder::build() const
 {
     return options_;
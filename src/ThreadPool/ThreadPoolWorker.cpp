@@ -2,13 +2,27 @@
 #include "FirstComeFirstServedTaskScheduler.h"
 
 
+const uint64_t ThreadPoolWorker::CPU_TIME_UPDATE_PERIOD_IN_MICROSECONDS;
+
+thread_local ThreadPoolWorker * ThreadPoolWorker::currentWorker_{ nullptr };
+
+
 ThreadPoolWorker::ThreadPoolWorker(ITaskScheduler * taskScheduler, OSAL::Monitor & freeStateMonitor, Logging * logging)
     : ManagedThread{ logging }
     , freeStateMonitor_{ freeStateMonitor }
     , taskScheduler_{ nullptr == taskScheduler ? std::unique_ptr<ITaskScheduler>{ new FirstComeFirstServedTaskScheduler{ logging } }
                                                : std::unique_ptr<ITaskScheduler>{ taskScheduler} }
     , waitTaskForExecutionTimeoutInMicroseconds_{ 5000000u }
-    , waitingTimeMutex_{ logging_->getNewLoggingInstance("WaitingTimeMutex") }
+    , waitingTimeMutex_{ logging_->getSubInstance("WaitingTimeMutex") }
+    , slot_{ 0u }
+    , idleWorkersBitmap_{}
+    , workersStatistic_{}
+    , statisticShard_{ nullptr }
+    , flightRecorder_{}
+    , isBlocking_{ false }
+    , attachedTime_{ OSAL::Time::getCurrentTime() }
+    , lastCpuTime_{ 0u }
+    , lastCpuTimeUpdateTime_{ 0u }
 {
 }
 
@@ -35,6 +49,24 @@ size_t ThreadPoolWorker::getTasksSize() const
 }
 
 
+size_t ThreadPoolWorker::getApproximateTasksSize() const
+{
+    return taskScheduler_->getApproximateSize();
+}
+
+
+uint64_t ThreadPoolWorker::getApproximateTasksWork() const
+{
+    return taskScheduler_->getApproximateWork();
+}
+
+
+uint64_t ThreadPoolWorker::getApproximateOldestTaskAddedTime() const
+{
+    return taskScheduler_->getApproximateOldestTaskAddedTime();
+}
+
+
 bool ThreadPoolWorker::isTaskAdded(const uint64_t taskId) const
 {
     return taskScheduler_->isScheduled(taskId);
@@ -51,9 +83,130 @@ uint64_t ThreadPoolWorker::getWaitingTime()
 }
 
 
+void ThreadPoolWorker::attach(const uint32_t slot,
+                              const std::shared_ptr<IdleWorkersBitmap> & idleWorkersBitmap,
+                              const std::shared_ptr<WorkersStatistic> & workersStatistic,
+                              const std::shared_ptr<FlightRecorder> & flightRecorder)
+{
+    slot_ = slot;
+    idleWorkersBitmap_ = idleWorkersBitmap;
+    workersStatistic_ = workersStatistic;
+    statisticShard_ = nullptr;
+    flightRecorder_ = flightRecorder;
+    attachedTime_ = OSAL::Time::getCurrentTime();
+
+    if (workersStatistic_ != nullptr && slot_ < workersStatistic_->getCapacity())
+    {
+        workersStatistic_->acquire(slot_, getState());
+        statisticShard_ = &workersStatistic_->getShard(slot_);
+    }
+}
+
+
+uint32_t ThreadPoolWorker::getSlot() const
+{
+    return slot_;
+}
+
+
+uint64_t ThreadPoolWorker::getLifetime() const
+{
+    return OSAL::Time::getCurrentTime() - attachedTime_;
+}
+
+
+void ThreadPoolWorker::setBlocking(const bool isBlocking)
+{
+    isBlocking_ = isBlocking;
+}
+
+
+bool ThreadPoolWorker::isBlocking() const
+{
+    return isBlocking_;
+}
+
+
+ThreadPoolWorker * ThreadPoolWorker::getCurrentWorker()
+{
+    return currentWorker_;
+}
+
+
+bool ThreadPoolWorker::enterBlockingRegion()
+{
+    if (isBlocking_ || nullptr == workersStatistic_)
+    {
+        return false;
+    }
+
+    workersStatistic_->enterBlockingRegion();
+
+    // Owner waits on the same monitor for tasks and free workers
+    freeStateMonitor_.lock();
+    freeStateMonitor_.notifyAll();
+    freeStateMonitor_.unlock();
+
+    return true;
+}
+
+
+void ThreadPoolWorker::leaveBlockingRegion()
+{
+    workersStatistic_->leaveBlockingRegion();
+
+    freeStateMonitor_.lock();
+    freeStateMonitor_.notifyAll();
+    freeStateMonitor_.unlock();
+}
+
+
+Result ThreadPoolWorker::create()
+{
+    const Result result{ OSAL::ManagedThread::create() };
+    publishCurrentState();
+
+    return result;
+}
+
+
+Result ThreadPoolWorker::pauseExecution()
+{
+    const Result result{ OSAL::ManagedThread::pauseExecution() };
+    publishCurrentState();
+
+    return result;
+}
+
+
+Result ThreadPoolWorker::resumeExecution()
+{
+    const Result result{ OSAL::ManagedThread::resumeExecution() };
+    publishCurrentState();
+
+    return result;
+}
+
+
+Result ThreadPoolWorker::stopExecution()
+{
+    const Result result{ OSAL::ManagedThread::stopExecution() };
+    publishCurrentState();
+
+    return result;
+}
+
+
 std::shared_ptr<IThreadPoolTask> ThreadPoolWorker::stealTask()
 {
-    return taskScheduler_->steal();
+    std::shared_ptr<IThreadPoolTask> stolenTask{ taskScheduler_->steal() };
+
+    if (statisticShard_ != nullptr && stolenTask != nullptr)
+    {
+        ++statisticShard_->numberOfStolenTasks;
+    }
+
+    return stolenTask;
 }
 
 
@@ -81,6 +234,12 @@ std::vector<std::shared_ptr<IThreadPoolTask>> ThreadPoolWorker::removeAllTasks()
 }
 
 
+std::shared_ptr<IThreadPoolTask> ThreadPoolWorker::removeOldestTask()
+{
+    return taskScheduler_->unscheduleOldest();
+}
+
+
 Result ThreadPoolWorker::clearAllTasks()
 {
     return taskScheduler_->clearAll();
@@ -102,46 +261,206 @@ void ThreadPoolWorker::managedRun()
     {
         stateMonitor_.lock();
         state_ = State::WAITING;
+        publishState(state_);
         stateMonitor_.unlock();
 
-        logging_->logDebug("%" PRIu64 " is waiting...", id_);
+        LOGGING_DEBUG(logging_, "%" PRIu64 " is waiting...", id_);
+
+        // Publish availability before notification, so owner finds this worker without scanning
+        if (idleWorkersBitmap_ != nullptr && !threadMustEnd_)
+        {
+            idleWorkersBitmap_->set(slot_);
+        }
 
         // Notify owner about availability
         freeStateMonitor_.lock();
         freeStateMonitor_.notifyAll();
         freeStateMonitor_.unlock();
 
+        const uint64_t parkedTime{ OSAL::Time::getCurrentTime() };
+
+        // Thread doesn't consume CPU while it's parked, so CPU time is up to date till it gets the next task
+        publishCpuTime(parkedTime);
+
         // Avoid waiting if thread must end
         if (!threadMustEnd_)
         {
+            if (flightRecorder_ != nullptr)
+            {
+                flightRecorder_->record(slot_, FlightRecorder::EventType::PARK, 0u, 0u, parkedTime);
+            }
+
             const Result result = taskScheduler_->waitTaskForExecution(waitTaskForExecutionTimeoutInMicroseconds_);
-            logging_->logDebug("%" PRIu64 " finish waiting with result %s", id_, resultToStr(result).c_str());
+            const uint64_t unparkedTime{ OSAL::Time::getCurrentTime() };
+
+            if (statisticShard_ != nullptr)
+            {
+                statisticShard_->idleTime += unparkedTime - parkedTime;
+            }
+
+            if (flightRecorder_ != nullptr)
+            {
+                flightRecorder_->record(slot_, FlightRecorder::EventType::UNPARK, 0u, 0u, unparkedTime);
+            }
+
+            LOGGING_DEBUG(logging_, "%" PRIu64 " finish waiting with result %s", id_, resultToStr(result).c_str());
         }
         else
         {
-            logging_->logDebug("%" PRIu64 " skip waiting since thread must end", id_);
+            LOGGING_DEBUG(logging_, "%" PRIu64 " skip waiting since thread must end", id_);
         }
     }
     else
     {
+        if (idleWorkersBitmap_ != nullptr)
+        {
+            idleWorkersBitmap_->reset(slot_);
+        }
+
         waitingTimeMutex_.lock();
         waitingTime_.restart();
         waitingTimeMutex_.unlock();
 
         stateMonitor_.lock();
         state_ = State::RUNNING;
+        publishState(state_);
         stateMonitor_.unlock();
 
-        logging_->logDebug("%" PRIi64 " is running with task %" PRIu64, id_, gotTaskForExecution->getId());
+        const uint64_t takenTime{ OSAL::Time::getCurrentTime() };
+
+        if (flightRecorder_ != nullptr)
+        {
+            flightRecorder_->record(slot_, FlightRecorder::EventType::START, gotTaskForExecution->getId(), 0u, takenTime);
+        }
+
+        LOGGING_DEBUG(logging_, "%" PRIi64 " is running with task %" PRIu64, id_, gotTaskForExecution->getId());
+
+        Result result{ Result::CANCELED };
+        const bool isExpired{ isTaskExpired(*gotTaskForExecution, takenTime) };
+
+        // Stale task is shed before it burns worker time, canceling releases its captures
+        if (isExpired)
+        {
+            gotTaskForExecution->cancel();
+        }
+        else
+        {
+            // Owner's watchdog reads them without locking, id is published before start time marks it valid
+            if (statisticShard_ != nullptr)
+            {
+                statisticShard_->currentTaskId.store(gotTaskForExecution->getId(), std::memory_order_release);
+                statisticShard_->currentTaskStartTime.store(takenTime, std::memory_order_release);
+            }
+
+            currentWorker_ = this;
+            result = gotTaskForExecution->execute();
+            currentWorker_ = nullptr;
+
+            if (statisticShard_ != nullptr)
+            {
+                statisticShard_->currentTaskStartTime.store(0u, std::memory_order_release);
+            }
+        }
+
+        const uint64_t finishedTime{ OSAL::Time::getCurrentTime() };
+
+        if (flightRecorder_ != nullptr)
+        {
+            flightRecorder_->record(slot_, FlightRecorder::EventType::END, gotTaskForExecution->getId(), 0u, finishedTime);
+        }
 
-        const Result result{ gotTaskForExecution->execute() };
-        if (result != Result::OK)
+        if (isExpired)
+        {
+            LOGGING_DEBUG(logging_, "%" PRIi64 " drops expired task %" PRIu64, id_, gotTaskForExecution->getId());
+        }
+        else if (result != Result::OK)
         {
-            logging_->logWarning("%" PRIi64 " can't execute task %" PRIu64, id_, gotTaskForExecution->getId());
+            LOGGING_WARNING(logging_, "%" PRIi64 " can't execute task %" PRIu64, id_, gotTaskForExecution->getId());
         }
         else
         {
-            logging_->logDebug("%" PRIi64 " finish execution of task %" PRIu64, id_, gotTaskForExecution->getId());
+            LOGGING_DEBUG(logging_, "%" PRIi64 " finish execution of task %" PRIu64, id_, gotTaskForExecution->getId());
         }
+
+        if (statisticShard_ != nullptr)
+        {
+            ++(result == Result::OK ? statisticShard_->numberOfExecutedTasks : statisticShard_->numberOfNotExecutedTasks);
+
+            if (isExpired)
+            {
+                ++statisticShard_->numberOfExpiredTasks;
+            }
+
+            const uint8_t bucket{ gotTaskForExecution->getSchedulingBucket() < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS
+                                  ? gotTaskForExecution->getSchedulingBucket() : IThreadPoolTask::NO_SCHEDULING_BUCKET };
+
+            // Tasks added directly to the worker have no added time
+            const uint64_t addedTime{ gotTaskForExecution->getAddedTime() };
+            if (addedTime != 0u && addedTime <= takenTime)
+            {
+                statisticShard_->queueWaitTime[bucket].record(takenTime - addedTime);
+            }
+
+            statisticShard_->executionTime[bucket].record(finishedTime - takenTime);
+            statisticShard_->busyTime += finishedTime - takenTime;
+
+            if (finishedTime - lastCpuTimeUpdateTime_ >= CPU_TIME_UPDATE_PERIOD_IN_MICROSECONDS)
+            {
+                publishCpuTime(finishedTime);
+            }
+        }
+
+        // Waiting time measures idle time, so it starts again after execution
+        waitingTimeMutex_.lock();
+        waitingTime_.restart();
+        waitingTimeMutex_.unlock();
+    }
+}
+
+
+//! ATTENTION! This method is called with the stateMonitor_ locked
+void ThreadPoolWorker::publishState(const State state)
+{
+    if (statisticShard_ != nullptr)
+    {
+        statisticShard_->state.store(state, std::memory_order_relaxed);
+    }
+}
+
+
+//! State is read under stateMonitor_, so the last published state is always the last assigned one
+void ThreadPoolWorker::publishCurrentState()
+{
+    stateMonitor_.lock();
+    publishState(state_);
+    stateMonitor_.unlock();
+}
+
+
+//! ATTENTION! This method is called by the worker thread only
+void ThreadPoolWorker::publishCpuTime(const uint64_t currentTime)
+{
+    if (nullptr == statisticShard_)
+    {
+        return;
+    }
+
+    const uint64_t cpuTime{ OSAL::Thread::getCurrentThreadCpuTime() };
+
+    // Shard is reset when the worker is attached, so the thread CPU time is published as increments
+    if (cpuTime > lastCpuTime_)
+    {
+        statisticShard_->cpuTime += cpuTime - lastCpuTime_;
+        lastCpuTime_ = cpuTime;
     }
+
+    lastCpuTimeUpdateTime_ = currentTime;
+}
+
+
+bool ThreadPoolWorker::isTaskExpired(const IThreadPoolTask & task, const uint64_t currentTime)
+{
+    const uint64_t deadline{ task.getDeadline() };
+
+    return task.isCancellationRequested() || (deadline != 0u && deadline < currentTime);
 }
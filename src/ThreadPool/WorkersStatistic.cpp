@@ -0,0 +1,279 @@
+#include <thread>
+
+#include "WorkersStatistic.h"
+
+
+WorkersStatistic::WorkersStatistic(const uint32_t capacity)
+    : capacity_{ capacity }
+    , shards_{ new CacheLinePadded<Shard>[capacity] }
+    , releaseSequence_{ 0u }
+    , numberOfWorkersInBlockingRegion_{ 0u }
+{
+    for (uint32_t i = 0u; i < capacity_; ++i)
+    {
+        shards_[i].value.isUsed.store(false, std::memory_order_relaxed);
+        resetShard(shards_[i].value, OSAL::Thread::State::READY);
+    }
+
+    released_.value.isUsed.store(false, std::memory_order_relaxed);
+    resetShard(released_.value, OSAL::Thread::State::READY);
+}
+
+
+uint32_t WorkersStatistic::getCapacity() const
+{
+    return capacity_;
+}
+
+
+WorkersStatistic::Shard & WorkersStatistic::getShard(const uint32_t slot)
+{
+    return shards_[slot].value;
+}
+
+
+void WorkersStatistic::acquire(const uint32_t slot, const OSAL::Thread::State state)
+{
+    if (slot < capacity_)
+    {
+        resetShard(shards_[slot].value, state);
+        shards_[slot].value.isUsed.store(true, std::memory_order_release);
+    }
+}
+
+
+void WorkersStatistic::release(const uint32_t slot)
+{
+    if (slot < capacity_)
+    {
+        Shard & shard = shards_[slot].value;
+
+        // Sequence lock: readers retry, if they could see the shard both merged and still used or neither
+        releaseSequence_.fetch_add(1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        released_.value.numberOfExecutedTasks       += shard.numberOfExecutedTasks.load();
+        released_.value.numberOfNotExecutedTasks    += shard.numberOfNotExecutedTasks.load();
+        released_.value.numberOfStolenTasks         += shard.numberOfStolenTasks.load();
+        released_.value.numberOfExpiredTasks        += shard.numberOfExpiredTasks.load();
+        released_.value.busyTime                    += shard.busyTime.load();
+        released_.value.idleTime                    += shard.idleTime.load();
+        released_.value.cpuTime                     += shard.cpuTime.load();
+
+        for (uint8_t bucket = 0u; bucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS; ++bucket)
+        {
+            released_.value.queueWaitTime[bucket].merge(shard.queueWaitTime[bucket]);
+            released_.value.executionTime[bucket].merge(shard.executionTime[bucket]);
+        }
+
+        shard.isUsed.store(false, std::memory_order_relaxed);
+
+        releaseSequence_.fetch_add(1u, std::memory_order_release);
+    }
+}
+
+
+WorkersStatistic::Snapshot WorkersStatistic::getSnapshot() const
+{
+    Snapshot snapshot{};
+    uint32_t sequence{ 0u };
+
+    do
+    {
+        sequence = beginRead();
+        snapshot = collectSnapshot();
+    }
+    while (!endRead(sequence));
+
+    return snapshot;
+}
+
+
+WorkersStatistic::Snapshot WorkersStatistic::collectSnapshot() const
+{
+    Snapshot snapshot{};
+
+    snapshot.numberOfExecutedTasks      = released_.value.numberOfExecutedTasks.load();
+    snapshot.numberOfNotExecutedTasks   = released_.value.numberOfNotExecutedTasks.load();
+    snapshot.numberOfStolenTasks        = released_.value.numberOfStolenTasks.load();
+    snapshot.numberOfExpiredTasks       = released_.value.numberOfExpiredTasks.load();
+    snapshot.busyTime                   = released_.value.busyTime.load();
+    snapshot.idleTime                   = released_.value.idleTime.load();
+    snapshot.cpuTime                    = released_.value.cpuTime.load();
+    snapshot.numberOfWorkersInBlockingRegion = getNumberOfWorkersInBlockingRegion();
+
+    for (uint32_t i = 0u; i < capacity_; ++i)
+    {
+        const Shard & shard = shards_[i].value;
+
+        if (!shard.isUsed.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        ++snapshot.numberOfWorkers;
+
+        switch (shard.state.load(std::memory_order_relaxed))
+        {
+            case OSAL::Thread::State::READY:
+                ++snapshot.numberOfWorkersInReadyState;
+                break;
+            case OSAL::Thread::State::RUNNING:
+                ++snapshot.numberOfWorkersInRunningState;
+                break;
+            case OSAL::Thread::State::WAITING:
+                ++snapshot.numberOfWorkersInWaitingState;
+                break;
+            case OSAL::Thread::State::PAUSED:
+                ++snapshot.numberOfWorkersInPausedState;
+                break;
+            default:
+                break;
+        }
+
+        snapshot.numberOfExecutedTasks      += shard.numberOfExecutedTasks.load();
+        snapshot.numberOfNotExecutedTasks   += shard.numberOfNotExecutedTasks.load();
+        snapshot.numberOfStolenTasks        += shard.numberOfStolenTasks.load();
+        snapshot.numberOfExpiredTasks       += shard.numberOfExpiredTasks.load();
+        snapshot.busyTime                   += shard.busyTime.load();
+        snapshot.idleTime                   += shard.idleTime.load();
+        snapshot.cpuTime                    += shard.cpuTime.load();
+    }
+
+    return snapshot;
+}
+
+
+void WorkersStatistic::enterBlockingRegion()
+{
+    numberOfWorkersInBlockingRegion_.fetch_add(1u, std::memory_order_acq_rel);
+}
+
+
+void WorkersStatistic::leaveBlockingRegion()
+{
+    numberOfWorkersInBlockingRegion_.fetch_sub(1u, std::memory_order_acq_rel);
+}
+
+
+uint32_t WorkersStatistic::getNumberOfWorkersInBlockingRegion() const
+{
+    return numberOfWorkersInBlockingRegion_.load(std::memory_order_acquire);
+}
+
+
+bool WorkersStatistic::getCurrentTask(const uint32_t slot, uint64_t & taskId, uint64_t & startTime) const
+{
+    if (slot >= capacity_)
+    {
+        return false;
+    }
+
+    const Shard & shard = shards_[slot].value;
+
+    startTime = shard.currentTaskStartTime.load(std::memory_order_acquire);
+    taskId = shard.currentTaskId.load(std::memory_order_acquire);
+
+    // Worker could switch to the next task between two loads, then id doesn't match start time
+    return startTime != 0u && startTime == shard.currentTaskStartTime.load(std::memory_order_acquire);
+}
+
+
+LatencyHistogram::Snapshot WorkersStatistic::getQueueWaitTime(const uint8_t schedulingBucket) const
+{
+    LatencyHistogram::Snapshot snapshot{};
+
+    if (schedulingBucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS)
+    {
+        uint32_t sequence{ 0u };
+
+        do
+        {
+            sequence = beginRead();
+            snapshot = released_.value.queueWaitTime[schedulingBucket].getSnapshot();
+
+            for (uint32_t i = 0u; i < capacity_; ++i)
+            {
+                if (shards_[i].value.isUsed.load(std::memory_order_acquire))
+                {
+                    snapshot.merge(shards_[i].value.queueWaitTime[schedulingBucket].getSnapshot());
+                }
+            }
+        }
+        while (!endRead(sequence));
+    }
+
+    return snapshot;
+}
+
+
+LatencyHistogram::Snapshot WorkersStatistic::getExecutionTime(const uint8_t schedulingBucket) const
+{
+    LatencyHistogram::Snapshot snapshot{};
+
+    if (schedulingBucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS)
+    {
+        uint32_t sequence{ 0u };
+
+        do
+        {
+            sequence = beginRead();
+            snapshot = released_.value.executionTime[schedulingBucket].getSnapshot();
+
+            for (uint32_t i = 0u; i < capacity_; ++i)
+            {
+                if (shards_[i].value.isUsed.load(std::memory_order_acquire))
+                {
+                    snapshot.merge(shards_[i].value.executionTime[schedulingBucket].getSnapshot());
+                }
+            }
+        }
+        while (!endRead(sequence));
+    }
+
+    return snapshot;
+}
+
+
+uint32_t WorkersStatistic::beginRead() const
+{
+    uint32_t sequence{ releaseSequence_.load(std::memory_order_acquire) };
+
+    // Odd sequence means a shard is being merged right now, it takes a moment only
+    while ((sequence & 1u) != 0u)
+    {
+        std::this_thread::yield();
+        sequence = releaseSequence_.load(std::memory_order_acquire);
+    }
+
+    return sequence;
+}
+
+
+bool WorkersStatistic::endRead(const uint32_t sequence) const
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return releaseSequence_.load(std::memory_order_relaxed) == sequence;
+}
+
+
+void WorkersStatistic::resetShard(Shard & shard, const OSAL::Thread::State state)
+{
+    shard.state.store(state, std::memory_order_relaxed);
+    shard.currentTaskStartTime.store(0u, std::memory_order_relaxed);
+    shard.currentTaskId.store(0u, std::memory_order_relaxed);
+    shard.numberOfExecutedTasks.reset();
+    shard.numberOfNotExecutedTasks.reset();
+    shard.numberOfStolenTasks.reset();
+    shard.numberOfExpiredTasks.reset();
+    shard.busyTime.reset();
+    shard.idleTime.reset();
+    shard.cpuTime.reset();
+
+    for (uint8_t bucket = 0u; bucket < IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS; ++bucket)
+    {
+        shard.queueWaitTime[bucket].reset();
+        shard.executionTime[bucket].reset();
+    }
+}
@@ -22,4 +22,10 @@ BurstTime BurstTimeTask::getBurstTime() const
 void BurstTimeTask::setBurstTime(const BurstTime burstTime)
 {
     burstTime_.store(burstTime, std::memory_order_relaxed);
+}
+
+
+uint8_t BurstTimeTask::getSchedulingBucket() const
+{
+    return static_cast<uint8_t>(getBurstTime());
 }
\ No newline at end of file
@@ -22,4 +22,10 @@ Priority PriorityTask::getPriority() const
 void PriorityTask::setPriority(const Priority priority)
 {
     priority_.store(priority, std::memory_order_relaxed);
+}
+
+
+uint8_t PriorityTask::getSchedulingBucket() const
+{
+    return static_cast<uint8_t>(getPriority());
 }
\ No newline at end of file
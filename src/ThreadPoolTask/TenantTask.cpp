@@ -0,0 +1,22 @@
+#include "TenantTask.h"
+
+
+const std::string TenantTask::DEFAULT_TENANT{};
+
+
+TenantTask::TenantTask()
+    : tenant_{ DEFAULT_TENANT }
+{
+}
+
+
+TenantTask::TenantTask(const std::string & tenant)
+    : tenant_{ tenant }
+{
+}
+
+
+const std::string & TenantTask::getTenant() const
+{
+    return tenant_;
+}
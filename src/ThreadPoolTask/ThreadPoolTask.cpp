@@ -1,8 +1,18 @@
 #include "ThreadPoolTask.h"
 
 
+const int64_t IThreadPoolTask::ANY_NUMA_NODE;
+const uint8_t IThreadPoolTask::NO_SCHEDULING_BUCKET;
+const uint8_t IThreadPoolTask::NUMBER_OF_SCHEDULING_BUCKETS;
+
+
 ThreadPoolTask::ThreadPoolTask()
     : state_{ IThreadPoolTask::State::CREATED }
+    , addedTime_{ 0u }
+    , numaNode_{ IThreadPoolTask::ANY_NUMA_NODE }
+    , isBlocking_{ false }
+    , deadline_{ 0u }
+    , isQueuedTasksCounterAttached_{ false }
 {
     static std::atomic<uint64_t> id{ 1u };
     id_ = id.load();
@@ -27,22 +37,91 @@ uint64_t ThreadPoolTask::getId() const
 }
 
 
+uint64_t ThreadPoolTask::getAddedTime() const
+{
+    return addedTime_.load(std::memory_order_relaxed);
+}
+
+
+void ThreadPoolTask::setAddedTime(const uint64_t addedTime)
+{
+    addedTime_.store(addedTime, std::memory_order_relaxed);
+}
+
+
+int64_t ThreadPoolTask::getNumaNode() const
+{
+    return numaNode_.load(std::memory_order_relaxed);
+}
+
+
+void ThreadPoolTask::setNumaNode(const int64_t numaNode)
+{
+    numaNode_.store(numaNode, std::memory_order_relaxed);
+}
+
+
+bool ThreadPoolTask::isBlocking() const
+{
+    return isBlocking_.load(std::memory_order_relaxed);
+}
+
+
+void ThreadPoolTask::setBlocking(const bool isBlocking)
+{
+    isBlocking_.store(isBlocking, std::memory_order_relaxed);
+}
+
+
+uint8_t ThreadPoolTask::getSchedulingBucket() const
+{
+    return IThreadPoolTask::NO_SCHEDULING_BUCKET;
+}
+
+
+uint64_t ThreadPoolTask::getDeadline() const
+{
+    return deadline_.load(std::memory_order_relaxed);
+}
+
+
+void ThreadPoolTask::setDeadline(const uint64_t deadline)
+{
+    deadline_.store(deadline, std::memory_order_relaxed);
+}
+
+
+bool ThreadPoolTask::isCancellationRequested() const
+{
+    return cancellationToken_.isCancellationRequested();
+}
+
+
+void ThreadPoolTask::setCancellationToken(const CancellationToken & cancellationToken)
+{
+    cancellationToken_ = cancellationToken;
+}
+
+
 Result ThreadPoolTask::execute()
 {
     Result result{ Result::CANCELED };
+    IThreadPoolTask::State state{ IThreadPoolTask::State::SUBMITTED };
 
-    if (!wrappedFunction_)
-    {
-        result = Result::ERROR;
-    }
-    else if (state_.load() == IThreadPoolTask::State::SUBMITTED)
+    // Cancellation competes for the same transition, so the function is never released under the executing task
+    if (state_.compare_exchange_strong(state, IThreadPoolTask::State::IN_EXECUTION))
     {
-        state_.store(IThreadPoolTask::State::IN_EXECUTION);
+        releaseQueuedTasksCounter();
+
         wrappedFunction_();
         state_.store(IThreadPoolTask::State::EXECUTED);
 
         result = Result::OK;
     }
+    else if (IThreadPoolTask::State::CREATED == state)
+    {
+        result = Result::ERROR;
+    }
 
     return result;
 }
@@ -50,13 +129,147 @@ Result ThreadPoolTask::execute()
 
 Result ThreadPoolTask::cancel()
 {
-    Result result{ Result::CANCELED };
+    Result result{ Result::ERROR };
+    std::function<void()> releasedFunction{};
+
+    countersMutex_.lock();
 
-    if (state_.load() != IThreadPoolTask::State::CANCELED)
+    IThreadPoolTask::State state{ state_.load() };
+    bool isCanceled{ false };
+
+    while (!isCanceled && (IThreadPoolTask::State::CREATED == state || IThreadPoolTask::State::SUBMITTED == state))
     {
-        state_.store(IThreadPoolTask::State::CANCELED);
+        isCanceled = state_.compare_exchange_weak(state, IThreadPoolTask::State::CANCELED);
+    }
+
+    if (isCanceled)
+    {
+        if (tombstonesCounter_ != nullptr)
+        {
+            tombstonesCounter_->fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        releaseQueuedTasksCounter();
+
+        // Nobody executes the function any more, so it's safe to take it
+        releasedFunction.swap(wrappedFunction_);
         result = Result::OK;
     }
+    else if (IThreadPoolTask::State::CANCELED == state)
+    {
+        result = Result::CANCELED;
+    }
+
+    countersMutex_.unlock();
+
+    // Captures are destroyed here, outside of the lock, future of the task gets broken promise
+    releasedFunction = nullptr;
 
     return result;
 }
+
+
+bool ThreadPoolTask::attachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter)
+{
+    countersMutex_.lock();
+
+    const bool isCanceled{ IThreadPoolTask::State::CANCELED == state_.load() };
+
+    // Same task may be scheduled again without leaving previous scheduler, then the tombstone moves to the new one
+    if (isCanceled)
+    {
+        if (tombstonesCounter_ != nullptr)
+        {
+            tombstonesCounter_->fetch_sub(1u, std::memory_order_relaxed);
+        }
+
+        tombstonesCounter->fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    tombstonesCounter_ = tombstonesCounter;
+
+    countersMutex_.unlock();
+
+    return isCanceled;
+}
+
+
+bool ThreadPoolTask::detachTombstonesCounter(const std::shared_ptr<TombstonesCounter> & tombstonesCounter)
+{
+    countersMutex_.lock();
+
+    const bool isCanceled{ IThreadPoolTask::State::CANCELED == state_.load() };
+
+    if (tombstonesCounter_ == tombstonesCounter)
+    {
+        if (isCanceled)
+        {
+            tombstonesCounter_->fetch_sub(1u, std::memory_order_relaxed);
+        }
+
+        tombstonesCounter_.reset();
+    }
+
+    countersMutex_.unlock();
+
+    return isCanceled;
+}
+
+
+bool ThreadPoolTask::attachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter)
+{
+    countersMutex_.lock();
+
+    // Task added again while it's still queued keeps the first counter, so it's released once
+    bool isAttached{ IThreadPoolTask::State::SUBMITTED == state_.load() && !isQueuedTasksCounterAttached_.load() };
+
+    if (isAttached)
+    {
+        queuedTasksCounter_ = queuedTasksCounter;
+        isQueuedTasksCounterAttached_.store(true);
+
+        // Execution doesn't lock, so it could start before the counter is published, then the counter is taken back
+        // unless execution has already released it
+        if (state_.load() != IThreadPoolTask::State::SUBMITTED && isQueuedTasksCounterAttached_.exchange(false))
+        {
+            isAttached = false;
+        }
+    }
+
+    countersMutex_.unlock();
+
+    return isAttached;
+}
+
+
+bool ThreadPoolTask::detachQueuedTasksCounter(const std::shared_ptr<QueuedTasksCounter> & queuedTasksCounter)
+{
+    countersMutex_.lock();
+
+    const bool isDetached{ queuedTasksCounter_ == queuedTasksCounter && releaseQueuedTasksCounter() };
+
+    countersMutex_.unlock();
+
+    return isDetached;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////
+///
+/// Private ThreadPoolTask methods
+///
+///////////////////////////////////////////////////////////////////////////////////////////////
+
+//! Whoever clears the flag releases the counter, so it's called by execute without locking countersMutex_,
+//! the counter itself is replaced only by attachQueuedTasksCounter, while the flag is cleared
+bool ThreadPoolTask::releaseQueuedTasksCounter()
+{
+    const bool isReleased{ isQueuedTasksCounterAttached_.exchange(false) };
+
+    if (isReleased)
+    {
+        queuedTasksCounter_->fetch_sub(1u, std::memory_order_relaxed);
+    }
+
+    return isReleased;
+}